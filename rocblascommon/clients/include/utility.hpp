@@ -8,6 +8,7 @@
 //#include "cblas_interface.hpp"
 //#include "logging.h"
 #include "rocblas.h"
+#include "rocsolver.h"
 #include "rocblas_test.hpp"
 //#include "rocblas_vector.hpp"
 //#include "utility.h"
@@ -63,6 +64,8 @@ public:
     }
     ~rocblas_local_handle()
     {
+        // (the state rocSOLVER may keep for the handle must be released first)
+        rocsolver_release_handle_resources(handle);
         rocblas_destroy_handle(handle);
     }
 
@@ -10,6 +10,11 @@
 #include "testing_gelq2_gelqf.hpp"
 #include "testing_getri.hpp"
 #include "testing_getrs.hpp"
+#include "testing_gesv.hpp"
+#include "testing_gesv_ir.hpp"
+#include "testing_vbatched.hpp"
+#include "testing_interleaved.hpp"
+#include "testing_factor_cache.hpp"
 #include "testing_potf2_potrf.hpp"
 #include "testing_larfg.hpp"
 #include "testing_larf.hpp"
@@ -437,6 +442,26 @@ try
         else if (precision == 'z')
             testing_getf2_getrf<false,true,1,rocblas_double_complex>(argus);
     }
+    else if (function == "getrf_ooc") {
+        if (precision == 's')
+            testing_getrf_variant<float>(argus, getrf_ooc);
+        else if (precision == 'd')
+            testing_getrf_variant<double>(argus, getrf_ooc);
+        else if (precision == 'c')
+            testing_getrf_variant<rocblas_float_complex>(argus, getrf_ooc);
+        else if (precision == 'z')
+            testing_getrf_variant<rocblas_double_complex>(argus, getrf_ooc);
+    }
+    else if (function == "getrf_cache") {
+        if (precision == 's')
+            testing_getrf_cache<float>(argus);
+        else if (precision == 'd')
+            testing_getrf_cache<double>(argus);
+        else if (precision == 'c')
+            testing_getrf_cache<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrf_cache<rocblas_double_complex>(argus);
+    }
     else if (function == "geqr2") {
         if (precision == 's')
             testing_geqr2_geqrf<false,false,0,float>(argus);
@@ -597,6 +622,122 @@ try
         else if (precision == 'z')
             testing_getrs<false,true,rocblas_double_complex>(argus);
     }
+    else if (function == "gesv_batched") {
+        if (precision == 's')
+            testing_gesv<true,float>(argus);
+        else if (precision == 'd')
+            testing_gesv<true,double>(argus);
+        else if (precision == 'c')
+            testing_gesv<true,rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_gesv<true,rocblas_double_complex>(argus);
+    }
+    else if (function == "gesv_strided_batched") {
+        if (precision == 's')
+            testing_gesv<false,float>(argus);
+        else if (precision == 'd')
+            testing_gesv<false,double>(argus);
+        else if (precision == 'c')
+            testing_gesv<false,rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_gesv<false,rocblas_double_complex>(argus);
+    }
+    else if (function == "gesv_ir") {
+        if (precision == 'd')
+            testing_gesv_ir<double>(argus);
+        else if (precision == 'z')
+            testing_gesv_ir<rocblas_double_complex>(argus);
+    }
+    else if (function == "getrf_vbatched") {
+        if (precision == 's')
+            testing_getrf_vbatched<float>(argus);
+        else if (precision == 'd')
+            testing_getrf_vbatched<double>(argus);
+        else if (precision == 'c')
+            testing_getrf_vbatched<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrf_vbatched<rocblas_double_complex>(argus);
+    }
+    else if (function == "getrs_cache") {
+        if (precision == 's')
+            testing_getrs_cache<float>(argus);
+        else if (precision == 'd')
+            testing_getrs_cache<double>(argus);
+        else if (precision == 'c')
+            testing_getrs_cache<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrs_cache<rocblas_double_complex>(argus);
+    }
+    else if (function == "getrs_vbatched") {
+        if (precision == 's')
+            testing_getrs_vbatched<float>(argus);
+        else if (precision == 'd')
+            testing_getrs_vbatched<double>(argus);
+        else if (precision == 'c')
+            testing_getrs_vbatched<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrs_vbatched<rocblas_double_complex>(argus);
+    }
+    else if (function == "pack_interleaved_batched") {
+        if (precision == 's')
+            testing_pack_unpack_interleaved<true,float>(argus);
+        else if (precision == 'd')
+            testing_pack_unpack_interleaved<true,double>(argus);
+        else if (precision == 'c')
+            testing_pack_unpack_interleaved<true,rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_pack_unpack_interleaved<true,rocblas_double_complex>(argus);
+    }
+    else if (function == "unpack_interleaved_batched") {
+        if (precision == 's')
+            testing_pack_unpack_interleaved<false,float>(argus);
+        else if (precision == 'd')
+            testing_pack_unpack_interleaved<false,double>(argus);
+        else if (precision == 'c')
+            testing_pack_unpack_interleaved<false,rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_pack_unpack_interleaved<false,rocblas_double_complex>(argus);
+    }
+    else if (function == "getrf_interleaved_batched") {
+        if (precision == 's')
+            testing_getrf_interleaved<float>(argus);
+        else if (precision == 'd')
+            testing_getrf_interleaved<double>(argus);
+        else if (precision == 'c')
+            testing_getrf_interleaved<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrf_interleaved<rocblas_double_complex>(argus);
+    }
+    else if (function == "getrs_interleaved_batched") {
+        if (precision == 's')
+            testing_getrs_interleaved<float>(argus);
+        else if (precision == 'd')
+            testing_getrs_interleaved<double>(argus);
+        else if (precision == 'c')
+            testing_getrs_interleaved<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getrs_interleaved<rocblas_double_complex>(argus);
+    }
+    else if (function == "getri_interleaved_batched") {
+        if (precision == 's')
+            testing_getri_interleaved<float>(argus);
+        else if (precision == 'd')
+            testing_getri_interleaved<double>(argus);
+        else if (precision == 'c')
+            testing_getri_interleaved<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_getri_interleaved<rocblas_double_complex>(argus);
+    }
+    else if (function == "potrf_interleaved_batched") {
+        if (precision == 's')
+            testing_potrf_interleaved<float>(argus);
+        else if (precision == 'd')
+            testing_potrf_interleaved<double>(argus);
+        else if (precision == 'c')
+            testing_potrf_interleaved<rocblas_float_complex>(argus);
+        else if (precision == 'z')
+            testing_potrf_interleaved<rocblas_double_complex>(argus);
+    }
     else if (function == "getri") {
         if (precision == 's')
             testing_getri<false,false,float>(argus);
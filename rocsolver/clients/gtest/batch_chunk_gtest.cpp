@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "workspace.hpp"
+#include <gtest/gtest.h>
+
+// the computation of the chunk sizes is tested on the host (no device is needed)
+
+// workspace of a typical batched function: a fixed part plus a part per instance
+static size_t linear_size(rocblas_int bc)
+{
+    return workspace_total_size(1000 * size_t(bc), sizeof(void*) * bc, 64);
+}
+
+TEST(checkin_auxiliary_batch_chunk, no_budget)
+{
+    EXPECT_EQ(rocsolver_compute_batch_chunk(0, 1, 5000, linear_size), 5000);
+    EXPECT_EQ(rocsolver_compute_batch_chunk(size_t(1) << 40, 1, 5000, linear_size), 5000);
+    EXPECT_EQ(rocsolver_compute_batch_chunk(1, 1, 0, linear_size), 0);
+    EXPECT_EQ(rocsolver_compute_batch_chunk(1, 1, 1, linear_size), 1);
+}
+
+TEST(checkin_auxiliary_batch_chunk, largest_fitting_chunk)
+{
+    for (size_t budget : {size_t(10000), size_t(123456), size_t(1) << 20})
+    {
+        rocblas_int chunk = rocsolver_compute_batch_chunk(budget, 1, 5000, linear_size);
+        EXPECT_GE(chunk, 1);
+        EXPECT_LT(chunk, 5000);
+        EXPECT_LE(linear_size(chunk), budget);
+        EXPECT_GT(linear_size(chunk + 1), budget);
+    }
+}
+
+TEST(checkin_auxiliary_batch_chunk, minimum_chunk)
+{
+    // the minimum chunk is used even if it does not fit in the budget
+    EXPECT_EQ(rocsolver_compute_batch_chunk(10, 1, 5000, linear_size), 1);
+    EXPECT_EQ(rocsolver_compute_batch_chunk(10, 64, 5000, linear_size), 64);
+    EXPECT_EQ(rocsolver_compute_batch_chunk(10, 64, 40, linear_size), 40);
+
+    // otherwise it is only a lower bound
+    rocblas_int chunk = rocsolver_compute_batch_chunk(1 << 20, 64, 5000, linear_size);
+    EXPECT_GT(chunk, 64);
+    EXPECT_EQ(chunk, rocsolver_compute_batch_chunk(1 << 20, 1, 5000, linear_size));
+}
+
+TEST(checkin_auxiliary_batch_chunk, chunks_cover_batch)
+{
+    // processing the batch in chunks visits every instance exactly once
+    rocblas_int batch_count = 1001;
+    rocblas_int chunk = rocsolver_compute_batch_chunk(50000, 1, batch_count, linear_size);
+    std::vector<int> visits(batch_count, 0);
+    for (rocblas_int b = 0; b < batch_count; b += chunk)
+        for (rocblas_int i = b; i < b + std::min(chunk, batch_count - b); ++i)
+            visits[i]++;
+    for (int v : visits)
+        EXPECT_EQ(v, 1);
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "workspace.hpp"
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver.hpp"
+#include "clientcommon.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// the host side of the capture mode is tested with a mock device that records 
+// the operations (no device is needed); the functions themselves are then 
+// captured on a real stream and the graph is replayed.
+
+// host backend that records every operation and flags the ones issued
+// while the stream is being captured
+struct recording_backend : public rocsolver_host_memory_backend
+{
+    bool capturing = false;
+    std::vector<std::string> ops;
+    std::vector<std::string> illegal_ops;
+
+    void record(const char* op)
+    {
+        ops.push_back(op);
+        if (capturing)
+            illegal_ops.push_back(op);
+    }
+
+    void* allocate(size_t size) override
+    {
+        record("allocate");
+        return rocsolver_host_memory_backend::allocate(size);
+    }
+
+    void deallocate(void* ptr) override
+    {
+        record("deallocate");
+        rocsolver_host_memory_backend::deallocate(ptr);
+    }
+
+    bool upload(void* dst, const void* src, size_t size) override
+    {
+        record("upload");
+        return rocsolver_host_memory_backend::upload(dst, src, size);
+    }
+};
+
+// handle data using the mock device
+static void init_data(rocsolver_handle_data& data, recording_backend* backend)
+{
+    data.backend.reset(backend);
+    data.arena.reset(new rocsolver_memory_arena(backend));
+}
+
+// reproduces the host side of a function: it takes the workspace and the constants
+static bool run_function(rocsolver_handle_data* data, size_t size1, size_t size2)
+{
+    rocsolver_device_malloc mem(data, nullptr, size1, size2);
+    if (!mem)
+        return false;
+    double* scalars = rocsolver_get_constants<double>(data);
+    if (!scalars)
+        return false;
+    return true;
+}
+
+TEST(checkin_auxiliary_capture, default_mode)
+{
+    recording_backend* backend = new recording_backend;
+    rocsolver_handle_data data;
+    init_data(data, backend);
+
+    // out of capture mode the first call allocates the workspace and creates the constants
+    EXPECT_TRUE(run_function(&data, 1000, 2000));
+    EXPECT_EQ(std::count(backend->ops.begin(), backend->ops.end(), "allocate"), 2);
+    EXPECT_EQ(std::count(backend->ops.begin(), backend->ops.end(), "upload"), 1);
+
+    // the constants are {-1, 0, 1}
+    double* scalars = rocsolver_get_constants<double>(&data);
+    ASSERT_NE(scalars, nullptr);
+    EXPECT_EQ(scalars[0], -1);
+    EXPECT_EQ(scalars[1], 0);
+    EXPECT_EQ(scalars[2], 1);
+}
+
+TEST(checkin_auxiliary_capture, no_illegal_operations)
+{
+    recording_backend* backend = new recording_backend;
+    rocsolver_handle_data data;
+    init_data(data, backend);
+
+    // enabling the mode (before the capture) creates the constants
+    ASSERT_TRUE(rocsolver_set_capture(&data, true));
+    EXPECT_EQ(backend->ops, std::vector<std::string>({"allocate", "upload"}));
+    EXPECT_NE(data.constants, nullptr);
+
+    // the user workspace is used directly
+    std::vector<char> workspace(workspace_total_size(1000, 2000));
+    data.workspace = workspace.data();
+    data.workspace_size = workspace.size();
+
+    backend->capturing = true;
+    {
+        rocsolver_device_malloc mem(&data, nullptr, 1000, 2000);
+        ASSERT_TRUE(bool(mem));
+        EXPECT_EQ(mem[0], workspace.data());
+        EXPECT_EQ(mem[1], workspace.data() + workspace_align(1000));
+    }
+    EXPECT_TRUE(run_function(&data, 1000, 2000));
+    EXPECT_TRUE(run_function(&data, 0, 100));
+
+    // a call that needs more workspace than provided fails without touching the device
+    EXPECT_FALSE(run_function(&data, 1000, 4000));
+    backend->capturing = false;
+
+    EXPECT_TRUE(backend->illegal_ops.empty());
+    EXPECT_EQ(data.arena->get_stats().allocations, 0);
+
+    // once the mode is disabled the arena is used again
+    ASSERT_TRUE(rocsolver_set_capture(&data, false));
+    EXPECT_TRUE(run_function(&data, 1000, 4000));
+    EXPECT_EQ(data.arena->get_stats().allocations, 1);
+}
+
+TEST(checkin_auxiliary_capture, no_workspace)
+{
+    recording_backend* backend = new recording_backend;
+    rocsolver_handle_data data;
+    init_data(data, backend);
+    ASSERT_TRUE(rocsolver_set_capture(&data, true));
+
+    // without user workspace only the functions that need none can be captured
+    backend->capturing = true;
+    EXPECT_FALSE(run_function(&data, 1000, 0));
+    EXPECT_TRUE(run_function(&data, 0, 0));
+    backend->capturing = false;
+
+    EXPECT_TRUE(backend->illegal_ops.empty());
+}
+
+// runs the functions on copies of hA and hB and returns the results (hX from B, hInv from A)
+template <typename F>
+static void capture_run(F run, hipStream_t stream, host_strided_batch_vector<double> &hA, host_strided_batch_vector<double> &hB,
+                        device_strided_batch_vector<double> &dA, device_strided_batch_vector<double> &dB,
+                        host_strided_batch_vector<double> &hX, host_strided_batch_vector<double> &hInv)
+{
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    run();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hX.transfer_from(dB));
+    CHECK_HIP_ERROR(hInv.transfer_from(dA));
+}
+
+TEST(checkin_lapack_capture, getrf_getrs_getri)
+{
+    rocblas_local_handle handle;
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+    // (large enough to use the blocked algorithms and the rocBLAS functions)
+    rocblas_int n = 300, nrhs = 4, lda = n, ldb = n;
+    host_strided_batch_vector<double> hA(lda*n,1,lda*n,1);
+    host_strided_batch_vector<double> hB(ldb*nrhs,1,ldb*nrhs,1);
+    host_strided_batch_vector<double> hXRes(ldb*nrhs,1,ldb*nrhs,1);
+    host_strided_batch_vector<double> hInvRes(lda*n,1,lda*n,1);
+    host_strided_batch_vector<double> hX(ldb*nrhs,1,ldb*nrhs,1);
+    host_strided_batch_vector<double> hInv(lda*n,1,lda*n,1);
+    device_strided_batch_vector<double> dA(lda*n,1,lda*n,1);
+    device_strided_batch_vector<double> dB(ldb*nrhs,1,ldb*nrhs,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    rocblas_init<double>(hA, true);
+    rocblas_init<double>(hB, true);
+    for (rocblas_int i = 0; i < n; i++)
+        hA[0][i + i*lda] += 400;
+
+    rocblas_status status[3];
+    auto run = [&]() {
+        status[0] = rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data());
+        status[1] = rocsolver_dgetrs(handle, rocblas_operation_none, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb);
+        status[2] = rocsolver_dgetri(handle, n, dA.data(), lda, dIpiv.data(), dinfo.data());
+    };
+
+    // reference results, out of capture mode 
+    // (this also reserves the memory that rocBLAS keeps in the handle)
+    capture_run(run, stream, hA, hB, dA, dB, hXRes, hInvRes);
+    for (rocblas_status st : status)
+        ASSERT_EQ(st, rocblas_status_success);
+
+    // workspace for the three functions
+    size_t size;
+    void* work;
+    CHECK_ROCBLAS_ERROR(rocsolver_start_workspace_size_query(handle));
+    run();
+    CHECK_ROCBLAS_ERROR(rocsolver_stop_workspace_size_query(handle, &size));
+    CHECK_HIP_ERROR(hipMalloc(&work, size));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, work, size));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_capture_mode(handle, rocsolver_capture_enabled));
+
+    // the capture fails if any function allocates, frees or synchronizes
+    hipGraph_t graph;
+    hipGraphExec_t exec;
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    run();
+    ASSERT_EQ(hipStreamEndCapture(stream, &graph), hipSuccess);
+    for (rocblas_status st : status)
+        EXPECT_EQ(st, rocblas_status_success);
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+
+    // the graph gives the same results every time it is launched
+    for (int replay = 0; replay < 2; ++replay)
+    {
+        auto launch = [&]() { CHECK_HIP_ERROR(hipGraphLaunch(exec, stream)); };
+        capture_run(launch, stream, hA, hB, dA, dB, hX, hInv);
+        EXPECT_LE(norm_error('F',n,nrhs,ldb,hXRes[0],hX[0]), n * get_epsilon<double>());
+        EXPECT_LE(norm_error('F',n,n,lda,hInvRes[0],hInv[0]), n * get_epsilon<double>());
+    }
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_capture_mode(handle, rocsolver_capture_disabled));
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_HIP_ERROR(hipFree(work));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_factor_cache.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+// the cache holds the inverses of the diagonal blocks of the factors
+// (blocks of ROCBLAS_TRSM_BLOCK = 128); the sizes cover one, several, and
+// partial diagonal blocks
+
+/******************** GETRF_CACHE ********************/
+
+typedef vector<int> getrf_cache_tuple;
+
+// each matrix_size vector is a {N, lda}
+
+// case when N = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrf_cache_size_range = {
+    {0, 1},                         //quick return
+    {-1, 1}, {20, 5},               //invalid
+    {1, 1}, {10, 11}, {128, 128}, {130, 140}, {300, 301}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrf_cache_size_range = {
+    {640, 640}, {1000, 1024}
+};
+
+
+Arguments getrf_cache_setup_arguments(getrf_cache_tuple tup) {
+    Arguments arg;
+
+    arg.N = tup[0];
+    arg.lda = tup[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GETRF_CACHE : public ::TestWithParam<getrf_cache_tuple> {
+protected:
+    GETRF_CACHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRF_CACHE, __float) {
+    Arguments arg = getrf_cache_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getrf_cache_bad_arg<float>();
+
+    testing_getrf_cache<float>(arg);
+}
+
+TEST_P(GETRF_CACHE, __double) {
+    Arguments arg = getrf_cache_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getrf_cache_bad_arg<double>();
+
+    testing_getrf_cache<double>(arg);
+}
+
+TEST_P(GETRF_CACHE, __float_complex) {
+    Arguments arg = getrf_cache_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getrf_cache_bad_arg<rocblas_float_complex>();
+
+    testing_getrf_cache<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRF_CACHE, __double_complex) {
+    Arguments arg = getrf_cache_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getrf_cache_bad_arg<rocblas_double_complex>();
+
+    testing_getrf_cache<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_CACHE,
+                         ValuesIn(large_getrf_cache_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_CACHE,
+                         ValuesIn(getrf_cache_size_range));
+/********************************************************/
+
+
+/******************** GETRS_CACHE ********************/
+
+typedef std::tuple<vector<int>, vector<int>> getrs_cache_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range vector is a {nrhs, trans};
+// if trans = 0 then no transpose
+// if trans = 1 then transpose
+// if trans = 2 then conjugate transpose
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrs_cache_sizeA_range = {
+    {0, 1, 1},                                  //quick return
+    {-1, 1, 1}, {20, 10, 20}, {20, 20, 10},     //invalid
+    {1, 1, 1}, {10, 11, 12}, {128, 128, 128}, {130, 140, 135}, {300, 301, 302}
+};
+const vector<vector<int>> getrs_cache_sizeB_range = {
+    {0, 0},     //quick return
+    {-1, 0},    //invalid
+    {1, 0}, {5, 1}, {30, 2}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrs_cache_sizeA_range = {
+    {640, 640, 640}, {1000, 1024, 1000}
+};
+const vector<vector<int>> large_getrs_cache_sizeB_range = {
+    {100, 0}, {200, 1}, {150, 2}
+};
+
+
+Arguments getrs_cache_setup_arguments(getrs_cache_tuple tup) {
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB[0];
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+
+    if (matrix_sizeB[1] == 0)
+        arg.transA_option = 'N';
+    else if(matrix_sizeB[1] == 1)
+        arg.transA_option = 'T';
+    else
+        arg.transA_option = 'C';
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GETRS_CACHE : public ::TestWithParam<getrs_cache_tuple> {
+protected:
+    GETRS_CACHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRS_CACHE, __float) {
+    Arguments arg = getrs_cache_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_cache_bad_arg<float>();
+
+    testing_getrs_cache<float>(arg);
+}
+
+TEST_P(GETRS_CACHE, __double) {
+    Arguments arg = getrs_cache_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_cache_bad_arg<double>();
+
+    testing_getrs_cache<double>(arg);
+}
+
+TEST_P(GETRS_CACHE, __float_complex) {
+    Arguments arg = getrs_cache_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_cache_bad_arg<rocblas_float_complex>();
+
+    testing_getrs_cache<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRS_CACHE, __double_complex) {
+    Arguments arg = getrs_cache_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_cache_bad_arg<rocblas_double_complex>();
+
+    testing_getrs_cache<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRS_CACHE,
+                         Combine(ValuesIn(large_getrs_cache_sizeA_range),
+                                 ValuesIn(large_getrs_cache_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRS_CACHE,
+                         Combine(ValuesIn(getrs_cache_sizeA_range),
+                                 ValuesIn(getrs_cache_sizeB_range)));
+/********************************************************/
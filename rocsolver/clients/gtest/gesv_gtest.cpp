@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> gesv_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range value is the number of right hand sides nrhs
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// in the computation tests, the middle instance of the batch is singular,
+// so that the values of info and the unmodified B are also checked
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    {0, 1, 1},                              //quick return
+    {-1, 1, 1}, {10, 2, 10}, {10, 10, 2},   //invalid
+    {1, 1, 1}, {10, 10, 10}, {20, 30, 20}, {33, 33, 40}, {64, 64, 64},   //solved by the fused kernel
+    {65, 65, 65}, {100, 120, 110}                                       //getrf + getrs
+};
+const vector<int> matrix_sizeB_range = {
+    0, -1, 1, 3, 10
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {192, 192, 192}, {300, 310, 300}, {640, 640, 700}, {1000, 1000, 1000}
+};
+const vector<int> large_matrix_sizeB_range = {
+    1, 64, 200
+};
+
+
+Arguments gesv_setup_arguments(gesv_tuple tup) {
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    int matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB;
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in batched tests
+    arg.bsp = arg.M;
+    arg.bsa = arg.lda * arg.M;
+    arg.bsb = arg.ldb * arg.N;
+
+    return arg;
+}
+
+class GESV : public ::TestWithParam<gesv_tuple> {
+protected:
+    GESV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+// batched tests
+
+TEST_P(GESV, batched__float) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true,float>();
+
+    arg.batch_count = 3;
+    testing_gesv<true,float>(arg);
+}
+
+TEST_P(GESV, batched__double) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true,double>();
+
+    arg.batch_count = 3;
+    testing_gesv<true,double>(arg);
+}
+
+TEST_P(GESV, batched__float_complex) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true,rocblas_float_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<true,rocblas_float_complex>(arg);
+}
+
+TEST_P(GESV, batched__double_complex) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true,rocblas_double_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<true,rocblas_double_complex>(arg);
+}
+
+
+
+// strided_batched tests
+
+TEST_P(GESV, strided_batched__float) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false,float>();
+
+    arg.batch_count = 3;
+    testing_gesv<false,float>(arg);
+}
+
+TEST_P(GESV, strided_batched__double) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false,double>();
+
+    arg.batch_count = 3;
+    testing_gesv<false,double>(arg);
+}
+
+TEST_P(GESV, strided_batched__float_complex) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false,rocblas_float_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<false,rocblas_float_complex>(arg);
+}
+
+TEST_P(GESV, strided_batched__double_complex) {
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false,rocblas_double_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<false,rocblas_double_complex>(arg);
+}
+
+
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GESV,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GESV,
+                         Combine(ValuesIn(matrix_sizeA_range),
+                                 ValuesIn(matrix_sizeB_range)));
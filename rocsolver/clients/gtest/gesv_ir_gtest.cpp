@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_ir.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> gesv_ir_tuple;
+
+// each A_range vector is a {N, lda, ldb, ldx};
+
+// each B_range value is the number of right hand sides nrhs
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// the computation tests solve a non-singular system, for which the refinement
+// must converge, and a singular one (iter = -3)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    {0, 1, 1, 1},                                           //quick return
+    {-1, 1, 1, 1}, {10, 2, 10, 10}, {10, 10, 2, 10}, {10, 10, 10, 2},  //invalid
+    {1, 1, 1, 1}, {10, 10, 10, 10}, {50, 60, 50, 52}, {100, 100, 110, 100}
+};
+const vector<int> matrix_sizeB_range = {
+    0, -1, 1, 3, 10
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {300, 300, 300, 300}, {640, 650, 640, 660}, {1000, 1000, 1000, 1000}
+};
+const vector<int> large_matrix_sizeB_range = {
+    1, 64
+};
+
+
+Arguments gesv_ir_setup_arguments(gesv_ir_tuple tup) {
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    int matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB;
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+    arg.ldc = matrix_sizeA[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESV_IR : public ::TestWithParam<gesv_ir_tuple> {
+protected:
+    GESV_IR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+// non-batch tests
+
+TEST_P(GESV_IR, __double) {
+    Arguments arg = gesv_ir_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_ir_bad_arg<double>();
+
+    testing_gesv_ir<double>(arg);
+}
+
+TEST_P(GESV_IR, __double_complex) {
+    Arguments arg = gesv_ir_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_gesv_ir_bad_arg<rocblas_double_complex>();
+
+    testing_gesv_ir<rocblas_double_complex>(arg);
+}
+
+
+// the fallbacks to the factorization in the precision of A that
+// depend on the options of the handle or on the values of the data
+
+template <typename T>
+void gesv_ir_fallback()
+{
+    rocblas_local_handle handle;
+    rocblas_int n = 100, nrhs = 2;
+    host_strided_batch_vector<T> hA(n*n,1,n*n,1);
+    host_strided_batch_vector<T> hB(n*nrhs,1,n*nrhs,1);
+    host_strided_batch_vector<rocblas_int> hIter(1,1,1,1);
+    host_strided_batch_vector<rocblas_int> hInfo(1,1,1,1);
+    device_strided_batch_vector<T> dA(n*n,1,n*n,1);
+    device_strided_batch_vector<T> dB(n*nrhs,1,n*nrhs,1);
+    device_strided_batch_vector<T> dX(n*nrhs,1,n*nrhs,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,1);
+    device_strided_batch_vector<rocblas_int> dIter(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dIter.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // no refinement allowed: the single precision solution is not accurate enough
+    gesv_ir_initData<true,true,T>(handle, n, nrhs, dA, n, dB, n, hA, hB, false);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_refinement_iterations(handle, 0));
+    CHECK_ROCBLAS_ERROR(rocsolver_gesv_ir(handle, n, nrhs, dA.data(), n, dIpiv.data(), dB.data(), n,
+                                          dX.data(), n, dIter.data(), dInfo.data()));
+    CHECK_HIP_ERROR(hIter.transfer_from(dIter));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    EXPECT_EQ(hInfo[0][0], 0);
+    EXPECT_EQ(hIter[0][0], -1);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_refinement_iterations(handle, 30));
+
+    // B too large for single precision
+    gesv_ir_initData<true,false,T>(handle, n, nrhs, dA, n, dB, n, hA, hB, false);
+    hB[0][5] = T(1e300);
+    gesv_ir_initData<false,true,T>(handle, n, nrhs, dA, n, dB, n, hA, hB, false);
+    CHECK_ROCBLAS_ERROR(rocsolver_gesv_ir(handle, n, nrhs, dA.data(), n, dIpiv.data(), dB.data(), n,
+                                          dX.data(), n, dIter.data(), dInfo.data()));
+    CHECK_HIP_ERROR(hIter.transfer_from(dIter));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    EXPECT_EQ(hInfo[0][0], 0);
+    EXPECT_EQ(hIter[0][0], -2);
+}
+
+TEST(checkin_lapack_gesv_ir, fallback__double) {
+    gesv_ir_fallback<double>();
+}
+
+TEST(checkin_lapack_gesv_ir, fallback__double_complex) {
+    gesv_ir_fallback<rocblas_double_complex>();
+}
+
+
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GESV_IR,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GESV_IR,
+                         Combine(ValuesIn(matrix_sizeA_range),
+                                 ValuesIn(matrix_sizeB_range)));
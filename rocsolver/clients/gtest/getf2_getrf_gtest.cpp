@@ -26,7 +26,7 @@ typedef std::tuple<vector<int>, int> getrf_tuple;
 const vector<vector<int>> matrix_size_range = {
     {0, 1},             //quick return
     {-1, 1}, {20, 5},   //invalid
-    {32, 32}, {50, 50}, {70, 100}
+    {32, 32}, {50, 50}, {70, 100}, {150, 150}
 };
 
 const vector<int> n_size_range = {
@@ -37,7 +37,7 @@ const vector<int> n_size_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {
-    {192, 192}, {640, 640}, {1000, 1024}, 
+    {192, 192}, {640, 640}, {1000, 1024}, {2500, 2500},
 };
 
 const vector<int> large_n_size_range = {
@@ -612,3 +612,160 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF,
                          Combine(ValuesIn(matrix_size_range),
                                  ValuesIn(n_size_range)));
+
+
+// the variants of getrf (look-ahead, tournament pivoting, hybrid and
+// out-of-core getrf) share the fixture GETRF_VARIANTS
+
+typedef std::tuple<vector<int>, getrf_variant> getrf_variant_tuple;
+
+// each variant_size_range vector is a {m, n, lda}
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// the tall matrices use the tournament pivoting of the panels and the
+// hybrid getrf (m >= GETRF_HYBRID_MIN_SIZE)
+
+const vector<getrf_variant> variant_range = {
+    getrf_lookahead, getrf_tournament, getrf_hybrid, getrf_ooc
+};
+
+// for checkin_lapack tests
+const vector<vector<int>> variant_size_range = {
+    {0, 0, 1},                  //quick return
+    {-1, 1, 1}, {20, 20, 5},    //invalid
+    {300, 300, 300}, {700, 600, 710}, {3000, 40, 3000}, {3000, 200, 3000}, {3000, 300, 3010}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_variant_size_range = {
+    {2048, 2048, 2048}, {5000, 500, 5000}, {8000, 128, 8000}
+};
+
+
+Arguments getrf_variant_setup_arguments(getrf_variant_tuple tup) {
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GETRF_VARIANTS : public ::TestWithParam<getrf_variant_tuple> {
+protected:
+    GETRF_VARIANTS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRF_VARIANTS, __float) {
+    Arguments arg = getrf_variant_setup_arguments(GetParam());
+    getrf_variant variant = std::get<1>(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_variant_bad_arg<float>(variant);
+
+    testing_getrf_variant<float>(arg, variant);
+}
+
+TEST_P(GETRF_VARIANTS, __double) {
+    Arguments arg = getrf_variant_setup_arguments(GetParam());
+    getrf_variant variant = std::get<1>(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_variant_bad_arg<double>(variant);
+
+    testing_getrf_variant<double>(arg, variant);
+}
+
+TEST_P(GETRF_VARIANTS, __float_complex) {
+    Arguments arg = getrf_variant_setup_arguments(GetParam());
+    getrf_variant variant = std::get<1>(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_variant_bad_arg<rocblas_float_complex>(variant);
+
+    testing_getrf_variant<rocblas_float_complex>(arg, variant);
+}
+
+TEST_P(GETRF_VARIANTS, __double_complex) {
+    Arguments arg = getrf_variant_setup_arguments(GetParam());
+    getrf_variant variant = std::get<1>(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_variant_bad_arg<rocblas_double_complex>(variant);
+
+    testing_getrf_variant<rocblas_double_complex>(arg, variant);
+}
+
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_VARIANTS,
+                         Combine(ValuesIn(large_variant_size_range),
+                                 ValuesIn(variant_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_VARIANTS,
+                         Combine(ValuesIn(variant_size_range),
+                                 ValuesIn(variant_range)));
+
+
+// getf2 with an all-NaN column (fixture GETF2_NAN)
+
+typedef vector<int> getf2_nan_tuple;
+
+// each vector is a {M, N, strided}, where strided = 1 for the strided_batched function
+// (the sizes select the optimized kernels that search the pivots in parallel)
+const vector<vector<int>> getf2_nan_size_range = {
+    {100, 40, 0}, {100, 40, 1},     //LUfact_small
+    {600, 40, 0}, {600, 40, 1},     //LUfact_panel
+    {600, 64, 0}, {600, 64, 1},     //LUfact_panel (blocked kernel)
+    {200, 100, 1},                  //LUfact_tiled
+    {300, 300, 1}                   //getf2_fused_kernel
+};
+
+class GETF2_NAN : public ::TestWithParam<getf2_nan_tuple> {
+protected:
+    GETF2_NAN() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETF2_NAN, __float) {
+    getf2_nan_tuple tup = GetParam();
+
+    if (tup[2]) testing_getf2_nan<true,float>(tup[0], tup[1]);
+    else testing_getf2_nan<false,float>(tup[0], tup[1]);
+}
+
+TEST_P(GETF2_NAN, __double) {
+    getf2_nan_tuple tup = GetParam();
+
+    if (tup[2]) testing_getf2_nan<true,double>(tup[0], tup[1]);
+    else testing_getf2_nan<false,double>(tup[0], tup[1]);
+}
+
+TEST_P(GETF2_NAN, __float_complex) {
+    getf2_nan_tuple tup = GetParam();
+
+    if (tup[2]) testing_getf2_nan<true,rocblas_float_complex>(tup[0], tup[1]);
+    else testing_getf2_nan<false,rocblas_float_complex>(tup[0], tup[1]);
+}
+
+TEST_P(GETF2_NAN, __double_complex) {
+    getf2_nan_tuple tup = GetParam();
+
+    if (tup[2]) testing_getf2_nan<true,rocblas_double_complex>(tup[0], tup[1]);
+    else testing_getf2_nan<false,rocblas_double_complex>(tup[0], tup[1]);
+}
+
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETF2_NAN,
+                         ValuesIn(getf2_nan_size_range));
@@ -28,12 +28,13 @@ typedef std::tuple<vector<int>, vector<int>> getrs_tuple;
 const vector<vector<int>> matrix_sizeA_range = {
     {0, 1, 1},                              //quick return
     {-1, 1, 1}, {10, 2, 10}, {10, 10, 2},   //invalid 
-    {20, 20, 20}, {30, 50, 30}, {30, 30, 50}, {50, 60, 60}
+    {20, 20, 20}, {30, 50, 30}, {30, 30, 50}, {50, 60, 60}, {64, 64, 64}
 };
 const vector<vector<int>> matrix_sizeB_range = {
     {0, 0},     //quick return
     {-1, 0},    //invalid 
     {10, 0}, {20, 1}, {30, 2},
+    {1, 0}, {4, 1}, {8, 2},     //few right hand sides (small kernel)
 };
 
 // for daily_lapack tests
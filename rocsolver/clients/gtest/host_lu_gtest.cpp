@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.h"
+#include "host_lu.hpp"
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace std;
+
+// the panel engine of the hybrid getrf is tested on the host (no device is needed)
+// against the LAPACK reference
+
+// (continuous values, so that there are no ties in the pivot search)
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+static T host_lu_random(mt19937& gen)
+{
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    return T(dist(gen));
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+static T host_lu_random(mt19937& gen)
+{
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    double re = dist(gen);
+    return T(re, dist(gen));
+}
+
+template <typename T>
+static void host_lu_initData(vector<T>& A, const rocblas_int m, const rocblas_int n, const rocblas_int lda)
+{
+    mt19937 gen(m * 1000 + n);
+    for (rocblas_int j = 0; j < n; ++j)
+        for (rocblas_int i = 0; i < m; ++i)
+            A[i + j*lda] = host_lu_random<T>(gen);
+}
+
+template <typename T>
+static void host_lu_check(const rocblas_int m, const rocblas_int n, const int nthreads, const rocblas_int zerocol = -1)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int lda = m + 3;
+    rocblas_int dim = min(m, n);
+    vector<T> A(lda * n), ARef;
+    vector<rocblas_int> ipiv(dim), ipivRef(dim);
+    rocblas_int infoRef;
+
+    host_lu_initData(A, m, n, lda);
+    if (zerocol >= 0)
+        for (rocblas_int i = 0; i < m; ++i)
+            A[i + zerocol*lda] = 0;
+    ARef = A;
+
+    // (the calling thread is one of the nthreads)
+    host_lu_thread_pool pool(nthreads - 1);
+    rocblas_int info = rocsolver_host_getrf_panel<T>(m, n, A.data(), lda, ipiv.data(), true, &pool);
+    cblas_getrf<T>(m, n, ARef.data(), lda, ipivRef.data(), &infoRef);
+
+    EXPECT_EQ(info, infoRef);
+    for (rocblas_int k = 0; k < dim; ++k)
+        EXPECT_EQ(ipiv[k], ipivRef[k]);
+    EXPECT_LE(norm_error('F', m, n, lda, ARef.data(), A.data()), m * get_epsilon<S>());
+}
+
+TEST(checkin_auxiliary_host_lu, quick_return)
+{
+    double A[1] = {1};
+    rocblas_int ipiv[1] = {-1};
+    EXPECT_EQ(rocsolver_host_getrf_panel<double>(0, 5, A, 1, ipiv), 0);
+    EXPECT_EQ(rocsolver_host_getrf_panel<double>(5, 0, A, 5, ipiv), 0);
+    EXPECT_EQ(ipiv[0], -1);
+}
+
+TEST(checkin_auxiliary_host_lu, real_panels)
+{
+    for (int nthreads : {1, 4})
+    {
+        host_lu_check<double>(64, 64, nthreads);
+        host_lu_check<double>(300, 17, nthreads);
+        host_lu_check<double>(3000, 64, nthreads);
+        host_lu_check<float>(2000, 40, nthreads);
+    }
+}
+
+TEST(checkin_auxiliary_host_lu, complex_panels)
+{
+    for (int nthreads : {1, 4})
+    {
+        host_lu_check<rocblas_double_complex>(300, 17, nthreads);
+        host_lu_check<rocblas_double_complex>(2500, 64, nthreads);
+    }
+}
+
+TEST(checkin_auxiliary_host_lu, thread_pool)
+{
+    // the workers are reused by consecutive runs, and every part runs exactly once
+    host_lu_thread_pool pool(3);
+    EXPECT_EQ(pool.size(), 3);
+    for (int nparts : {4, 2, 4, 3})
+    {
+        vector<int> count(nparts, 0);
+        pool.run(nparts, [&](int p) { count[p]++; });
+        for (int p = 0; p < nparts; ++p)
+            EXPECT_EQ(count[p], 1);
+    }
+}
+
+TEST(checkin_auxiliary_host_lu, singular_panels)
+{
+    // info is the first zero pivot, in the column by column part or in the recursive part
+    host_lu_check<double>(1000, 64, 2, 3);
+    host_lu_check<double>(1000, 64, 2, 40);
+    host_lu_check<rocblas_double_complex>(700, 32, 3, 20);
+}
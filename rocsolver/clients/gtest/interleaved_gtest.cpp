@@ -0,0 +1,555 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_interleaved.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+// the interleaved functions process one instance per thread; the batches
+// have 257 instances so that the last thread block is partially used
+static const rocblas_int interleaved_bc = 257;
+
+
+/******************** PACK_UNPACK_INTERLEAVED ********************/
+
+typedef vector<int> pack_interleaved_tuple;
+
+// each matrix_size vector is a {M, N, lda (strided), ldb (interleaved)}
+
+// case when M = N = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> pack_interleaved_size_range = {
+    {0, 0, 1, 1},                                           //quick return
+    {-1, 1, 1, 1}, {1, -1, 1, 1}, {10, 10, 5, 10}, {10, 10, 10, 5},   //invalid
+    {1, 1, 1, 1}, {5, 7, 5, 5}, {16, 16, 20, 18}, {30, 10, 32, 30}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_pack_interleaved_size_range = {
+    {64, 64, 64, 70}, {100, 50, 120, 100}
+};
+
+
+Arguments pack_interleaved_setup_arguments(pack_interleaved_tuple tup) {
+    Arguments arg;
+
+    arg.M = tup[0];
+    arg.N = tup[1];
+    arg.lda = tup[2];
+    arg.ldb = tup[3];
+
+    arg.timing = 0;
+    arg.batch_count = interleaved_bc;
+    arg.bsa = arg.lda * arg.N;
+
+    return arg;
+}
+
+class PACK_INTERLEAVED : public ::TestWithParam<pack_interleaved_tuple> {
+protected:
+    PACK_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class UNPACK_INTERLEAVED : public ::TestWithParam<pack_interleaved_tuple> {
+protected:
+    UNPACK_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(PACK_INTERLEAVED, __float) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<true,float>();
+
+    testing_pack_unpack_interleaved<true,float>(arg);
+}
+
+TEST_P(PACK_INTERLEAVED, __double) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<true,double>();
+
+    testing_pack_unpack_interleaved<true,double>(arg);
+}
+
+TEST_P(PACK_INTERLEAVED, __float_complex) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<true,rocblas_float_complex>();
+
+    testing_pack_unpack_interleaved<true,rocblas_float_complex>(arg);
+}
+
+TEST_P(PACK_INTERLEAVED, __double_complex) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<true,rocblas_double_complex>();
+
+    testing_pack_unpack_interleaved<true,rocblas_double_complex>(arg);
+}
+
+TEST_P(UNPACK_INTERLEAVED, __float) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<false,float>();
+
+    testing_pack_unpack_interleaved<false,float>(arg);
+}
+
+TEST_P(UNPACK_INTERLEAVED, __double) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<false,double>();
+
+    testing_pack_unpack_interleaved<false,double>(arg);
+}
+
+TEST_P(UNPACK_INTERLEAVED, __float_complex) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<false,rocblas_float_complex>();
+
+    testing_pack_unpack_interleaved<false,rocblas_float_complex>(arg);
+}
+
+TEST_P(UNPACK_INTERLEAVED, __double_complex) {
+    Arguments arg = pack_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_pack_unpack_interleaved_bad_arg<false,rocblas_double_complex>();
+
+    testing_pack_unpack_interleaved<false,rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, PACK_INTERLEAVED,
+                         ValuesIn(large_pack_interleaved_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, UNPACK_INTERLEAVED,
+                         ValuesIn(large_pack_interleaved_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, PACK_INTERLEAVED,
+                         ValuesIn(pack_interleaved_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, UNPACK_INTERLEAVED,
+                         ValuesIn(pack_interleaved_size_range));
+/********************************************************/
+
+
+/******************** GETRF_INTERLEAVED ********************/
+
+typedef vector<int> getrf_interleaved_tuple;
+
+// each matrix_size vector is a {M, N, lda}
+
+// case when M = N = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrf_interleaved_size_range = {
+    {0, 0, 1},                                  //quick return
+    {-1, 1, 1}, {1, -1, 1}, {10, 10, 5},        //invalid
+    {1, 1, 1}, {2, 2, 2}, {5, 5, 6}, {8, 8, 8}, {16, 16, 17}, {12, 7, 12}, {7, 12, 8}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrf_interleaved_size_range = {
+    {24, 24, 24}, {32, 32, 33}, {40, 30, 40}
+};
+
+
+Arguments getrf_interleaved_setup_arguments(getrf_interleaved_tuple tup) {
+    Arguments arg;
+
+    arg.M = tup[0];
+    arg.N = tup[1];
+    arg.lda = tup[2];
+
+    arg.timing = 0;
+    arg.batch_count = interleaved_bc;
+
+    return arg;
+}
+
+class GETRF_INTERLEAVED : public ::TestWithParam<getrf_interleaved_tuple> {
+protected:
+    GETRF_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRF_INTERLEAVED, __float) {
+    Arguments arg = getrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_interleaved_bad_arg<float>();
+
+    testing_getrf_interleaved<float>(arg);
+}
+
+TEST_P(GETRF_INTERLEAVED, __double) {
+    Arguments arg = getrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_interleaved_bad_arg<double>();
+
+    testing_getrf_interleaved<double>(arg);
+}
+
+TEST_P(GETRF_INTERLEAVED, __float_complex) {
+    Arguments arg = getrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_interleaved_bad_arg<rocblas_float_complex>();
+
+    testing_getrf_interleaved<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRF_INTERLEAVED, __double_complex) {
+    Arguments arg = getrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_interleaved_bad_arg<rocblas_double_complex>();
+
+    testing_getrf_interleaved<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_INTERLEAVED,
+                         ValuesIn(large_getrf_interleaved_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_INTERLEAVED,
+                         ValuesIn(getrf_interleaved_size_range));
+/********************************************************/
+
+
+/******************** GETRS_INTERLEAVED ********************/
+
+typedef std::tuple<vector<int>, vector<int>> getrs_interleaved_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range vector is a {nrhs, trans};
+// if trans = 0 then no transpose
+// if trans = 1 then transpose
+// if trans = 2 then conjugate transpose
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrs_interleaved_sizeA_range = {
+    {0, 1, 1},                                  //quick return
+    {-1, 1, 1}, {10, 5, 10}, {10, 10, 5},       //invalid
+    {1, 1, 1}, {2, 2, 2}, {5, 6, 5}, {8, 8, 9}, {16, 16, 16}
+};
+const vector<vector<int>> getrs_interleaved_sizeB_range = {
+    {0, 0},     //quick return
+    {-1, 0},    //invalid
+    {1, 0}, {2, 1}, {5, 2}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrs_interleaved_sizeA_range = {
+    {24, 24, 24}, {32, 33, 32}
+};
+const vector<vector<int>> large_getrs_interleaved_sizeB_range = {
+    {16, 0}, {32, 1}
+};
+
+
+Arguments getrs_interleaved_setup_arguments(getrs_interleaved_tuple tup) {
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB[0];
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+
+    if (matrix_sizeB[1] == 0)
+        arg.transA_option = 'N';
+    else if(matrix_sizeB[1] == 1)
+        arg.transA_option = 'T';
+    else
+        arg.transA_option = 'C';
+
+    arg.timing = 0;
+    arg.batch_count = interleaved_bc;
+
+    return arg;
+}
+
+class GETRS_INTERLEAVED : public ::TestWithParam<getrs_interleaved_tuple> {
+protected:
+    GETRS_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRS_INTERLEAVED, __float) {
+    Arguments arg = getrs_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_interleaved_bad_arg<float>();
+
+    testing_getrs_interleaved<float>(arg);
+}
+
+TEST_P(GETRS_INTERLEAVED, __double) {
+    Arguments arg = getrs_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_interleaved_bad_arg<double>();
+
+    testing_getrs_interleaved<double>(arg);
+}
+
+TEST_P(GETRS_INTERLEAVED, __float_complex) {
+    Arguments arg = getrs_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_interleaved_bad_arg<rocblas_float_complex>();
+
+    testing_getrs_interleaved<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRS_INTERLEAVED, __double_complex) {
+    Arguments arg = getrs_interleaved_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_interleaved_bad_arg<rocblas_double_complex>();
+
+    testing_getrs_interleaved<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRS_INTERLEAVED,
+                         Combine(ValuesIn(large_getrs_interleaved_sizeA_range),
+                                 ValuesIn(large_getrs_interleaved_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRS_INTERLEAVED,
+                         Combine(ValuesIn(getrs_interleaved_sizeA_range),
+                                 ValuesIn(getrs_interleaved_sizeB_range)));
+/********************************************************/
+
+
+/******************** GETRI_INTERLEAVED ********************/
+
+typedef vector<int> getri_interleaved_tuple;
+
+// each matrix_size vector is a {N, lda}
+
+// case when N = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getri_interleaved_size_range = {
+    {0, 1},                     //quick return
+    {-1, 1}, {10, 5},           //invalid
+    {1, 1}, {2, 2}, {5, 6}, {8, 8}, {16, 17}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getri_interleaved_size_range = {
+    {24, 24}, {32, 33}
+};
+
+
+Arguments getri_interleaved_setup_arguments(getri_interleaved_tuple tup) {
+    Arguments arg;
+
+    arg.N = tup[0];
+    arg.lda = tup[1];
+
+    arg.timing = 0;
+    arg.batch_count = interleaved_bc;
+
+    return arg;
+}
+
+class GETRI_INTERLEAVED : public ::TestWithParam<getri_interleaved_tuple> {
+protected:
+    GETRI_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRI_INTERLEAVED, __float) {
+    Arguments arg = getri_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getri_interleaved_bad_arg<float>();
+
+    testing_getri_interleaved<float>(arg);
+}
+
+TEST_P(GETRI_INTERLEAVED, __double) {
+    Arguments arg = getri_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getri_interleaved_bad_arg<double>();
+
+    testing_getri_interleaved<double>(arg);
+}
+
+TEST_P(GETRI_INTERLEAVED, __float_complex) {
+    Arguments arg = getri_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getri_interleaved_bad_arg<rocblas_float_complex>();
+
+    testing_getri_interleaved<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRI_INTERLEAVED, __double_complex) {
+    Arguments arg = getri_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0)
+        testing_getri_interleaved_bad_arg<rocblas_double_complex>();
+
+    testing_getri_interleaved<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRI_INTERLEAVED,
+                         ValuesIn(large_getri_interleaved_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRI_INTERLEAVED,
+                         ValuesIn(getri_interleaved_size_range));
+/********************************************************/
+
+
+/******************** POTRF_INTERLEAVED ********************/
+
+typedef std::tuple<vector<int>, char> potrf_interleaved_tuple;
+
+// each matrix_size vector is a {N, lda}
+
+// case when N = 0 and uplo = 'U' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> potrf_interleaved_uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> potrf_interleaved_size_range = {
+    {0, 1},                     //quick return
+    {-1, 1}, {10, 5},           //invalid
+    {1, 1}, {2, 2}, {5, 6}, {8, 8}, {16, 17}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_potrf_interleaved_size_range = {
+    {24, 24}, {32, 33}
+};
+
+
+Arguments potrf_interleaved_setup_arguments(potrf_interleaved_tuple tup) {
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+    arg.batch_count = interleaved_bc;
+
+    return arg;
+}
+
+class POTRF_INTERLEAVED : public ::TestWithParam<potrf_interleaved_tuple> {
+protected:
+    POTRF_INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(POTRF_INTERLEAVED, __float) {
+    Arguments arg = potrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0 && arg.uplo_option == 'U')
+        testing_potrf_interleaved_bad_arg<float>();
+
+    testing_potrf_interleaved<float>(arg);
+}
+
+TEST_P(POTRF_INTERLEAVED, __double) {
+    Arguments arg = potrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0 && arg.uplo_option == 'U')
+        testing_potrf_interleaved_bad_arg<double>();
+
+    testing_potrf_interleaved<double>(arg);
+}
+
+TEST_P(POTRF_INTERLEAVED, __float_complex) {
+    Arguments arg = potrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0 && arg.uplo_option == 'U')
+        testing_potrf_interleaved_bad_arg<rocblas_float_complex>();
+
+    testing_potrf_interleaved<rocblas_float_complex>(arg);
+}
+
+TEST_P(POTRF_INTERLEAVED, __double_complex) {
+    Arguments arg = potrf_interleaved_setup_arguments(GetParam());
+
+    if (arg.N == 0 && arg.uplo_option == 'U')
+        testing_potrf_interleaved_bad_arg<rocblas_double_complex>();
+
+    testing_potrf_interleaved<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, POTRF_INTERLEAVED,
+                         Combine(ValuesIn(large_potrf_interleaved_size_range),
+                                 ValuesIn(potrf_interleaved_uplo_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, POTRF_INTERLEAVED,
+                         Combine(ValuesIn(potrf_interleaved_size_range),
+                                 ValuesIn(potrf_interleaved_uplo_range)));
+/********************************************************/
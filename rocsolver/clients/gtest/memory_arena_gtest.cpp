@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "memory_arena.hpp"
+#include <gtest/gtest.h>
+
+// the arena is tested with host memory (no device is needed)
+
+// host backend that counts the calls and can simulate a limited capacity
+struct counting_backend : public rocsolver_host_memory_backend
+{
+    size_t capacity = size_t(-1);
+    size_t outstanding = 0;
+    size_t allocs = 0;
+    size_t deallocs = 0;
+    std::unordered_map<void*, size_t> sizes;
+
+    void* allocate(size_t size) override
+    {
+        if (outstanding + size > capacity)
+            return nullptr;
+        void* ptr = rocsolver_host_memory_backend::allocate(size);
+        sizes[ptr] = size;
+        outstanding += size;
+        allocs++;
+        return ptr;
+    }
+
+    void deallocate(void* ptr) override
+    {
+        outstanding -= sizes[ptr];
+        sizes.erase(ptr);
+        deallocs++;
+        rocsolver_host_memory_backend::deallocate(ptr);
+    }
+};
+
+TEST(checkin_auxiliary_arena, size_classes)
+{
+    EXPECT_EQ(rocsolver_memory_arena::size_class(1), ARENA_MIN_BLOCK);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(ARENA_MIN_BLOCK), ARENA_MIN_BLOCK);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(ARENA_MIN_BLOCK + 1), 2 * ARENA_MIN_BLOCK);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(4096), 4096);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(4097), 5120);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(6000), 6144);
+    EXPECT_EQ(rocsolver_memory_arena::size_class(7169), 8192);
+
+    // the overhead of a size class is at most 25%
+    for (size_t s = 1024; s < (1 << 24); s = s * 3 / 2 + 7)
+    {
+        size_t c = rocsolver_memory_arena::size_class(s);
+        EXPECT_GE(c, s);
+        EXPECT_LE(c, s + s / 4 + ARENA_MIN_BLOCK);
+    }
+}
+
+TEST(checkin_auxiliary_arena, reuse_and_stats)
+{
+    counting_backend backend;
+    {
+        rocsolver_memory_arena arena(&backend);
+
+        // repeated requests of the same shape reuse the same block
+        void* p1 = arena.allocate(10000);
+        ASSERT_NE(p1, nullptr);
+        arena.deallocate(p1);
+        void* p2 = arena.allocate(9800);
+        EXPECT_EQ(p1, p2);
+        arena.deallocate(p2);
+        EXPECT_EQ(backend.allocs, 1);
+
+        const rocsolver_arena_stats& stats = arena.get_stats();
+        EXPECT_EQ(stats.allocations, 2);
+        EXPECT_EQ(stats.allocations_avoided, 1);
+        EXPECT_EQ(stats.bytes_in_use, 0);
+        EXPECT_EQ(stats.peak_bytes_in_use, rocsolver_memory_arena::size_class(10000));
+        EXPECT_EQ(stats.bytes_reserved, rocsolver_memory_arena::size_class(10000));
+
+        // blocks in use at the same time are different
+        void* a = arena.allocate(100);
+        void* b = arena.allocate(100);
+        EXPECT_NE(a, b);
+        EXPECT_EQ(stats.bytes_in_use, 2 * ARENA_MIN_BLOCK);
+        arena.deallocate(a);
+        arena.deallocate(b);
+
+        // zero size requests do not allocate
+        EXPECT_EQ(arena.allocate(0), nullptr);
+
+        arena.trim();
+        EXPECT_EQ(stats.bytes_reserved, 0);
+        EXPECT_EQ(backend.outstanding, 0);
+    }
+    EXPECT_EQ(backend.allocs, backend.deallocs);
+}
+
+TEST(checkin_auxiliary_arena, owners)
+{
+    counting_backend backend;
+    rocsolver_memory_arena arena(&backend);
+    int stream1, stream2;
+
+    // a released block is only reused by its owner
+    void* p1 = arena.allocate(10000, &stream1);
+    ASSERT_NE(p1, nullptr);
+    arena.deallocate(p1);
+    void* p2 = arena.allocate(10000, &stream2);
+    ASSERT_NE(p2, nullptr);
+    arena.deallocate(p2);
+
+    // (the block of the other owner was returned to the backend to respect the peak usage)
+    EXPECT_EQ(backend.allocs, 2);
+    EXPECT_EQ(backend.outstanding, rocsolver_memory_arena::size_class(10000));
+
+    void* p3 = arena.allocate(10000, &stream2);
+    EXPECT_EQ(p3, p2);
+    arena.deallocate(p3);
+    EXPECT_EQ(arena.get_stats().allocations_avoided, 1);
+}
+
+TEST(checkin_auxiliary_arena, high_water_mark)
+{
+    counting_backend backend;
+    rocsolver_memory_arena arena(&backend);
+    const rocsolver_arena_stats& stats = arena.get_stats();
+
+    // alternating shapes do not make the cache grow beyond the peak usage
+    size_t sizes[] = {1 << 20, 3 << 19, 1 << 20, 7 << 18, 1 << 19};
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        for (size_t s : sizes)
+        {
+            void* p = arena.allocate(s);
+            ASSERT_NE(p, nullptr);
+            arena.deallocate(p);
+            EXPECT_LE(stats.bytes_reserved, stats.peak_bytes_in_use);
+        }
+    }
+    EXPECT_EQ(stats.peak_bytes_in_use, rocsolver_memory_arena::size_class(7 << 18));
+    EXPECT_EQ(backend.outstanding, stats.bytes_reserved);
+}
+
+TEST(checkin_auxiliary_arena, out_of_memory)
+{
+    counting_backend backend;
+    backend.capacity = 1 << 20;
+    {
+        rocsolver_memory_arena arena(&backend);
+
+        // two blocks of different classes fit together...
+        void* a = arena.allocate(1 << 19);
+        void* b = arena.allocate(1 << 18);
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        arena.deallocate(a);
+        arena.deallocate(b);
+
+        // ...a larger one only fits after the cache has been released
+        void* c = arena.allocate(7 << 17);
+        EXPECT_NE(c, nullptr);
+
+        // a request that can never be satisfied fails cleanly
+        EXPECT_EQ(arena.allocate(1 << 20), nullptr);
+        EXPECT_EQ(arena.get_stats().bytes_in_use, rocsolver_memory_arena::size_class(7 << 17));
+        arena.deallocate(c);
+    }
+    EXPECT_EQ(backend.outstanding, 0);
+}
@@ -0,0 +1,271 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.h"
+#include "host_lu.hpp"
+#include "norm.hpp"
+#include "ooc_lu.hpp"
+#include "rocsolver_test.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace std;
+
+// the slab scheduler of the out-of-core getrf is tested on the host (no device is needed)
+// with a stand-in of the device that checks the order of the transfers and computations
+
+template <typename T>
+class ooc_host_device
+{
+    enum slot_state
+    {
+        empty,
+        loaded,     // the load was enqueued
+        busy,       // acquired by the computations
+        released
+    };
+
+    rocblas_int m, n, lda, w;
+    bool pivot;
+    T* A;
+    vector<T> slots[3];
+    slot_state state[3] = {empty, empty, empty};
+    rocblas_int first_row[3] = {0, 0, 0}, first_col[3] = {0, 0, 0}, ncols[3] = {0, 0, 0};
+    vector<bool> stored;    // columns of the host matrix that are already factored
+    bool synced = false;
+
+public:
+    vector<rocblas_int> ipiv;
+    rocblas_int info = 0;
+    size_t loaded_entries = 0;
+
+    ooc_host_device(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, rocblas_int w, bool pivot)
+        : m(m), n(n), lda(lda), w(w), pivot(pivot), A(A), stored(n, false), ipiv(min(m, n), 0)
+    {
+        for (auto& s : slots)
+            s.resize(size_t(m) * w);
+    }
+
+    void load(int slot, rocblas_int r0, rocblas_int c0, rocblas_int nc)
+    {
+        EXPECT_NE(state[slot], busy);
+        ASSERT_LE(nc, w);
+        for (rocblas_int j = 0; j < nc; ++j) {
+            if (slot != OOC_SLAB) {
+                EXPECT_TRUE(stored[c0 + j]);
+            }
+            for (rocblas_int i = r0; i < m; ++i)
+                slots[slot][(i - r0) + j*m] = A[i + (c0 + j)*lda];
+        }
+        loaded_entries += size_t(m - r0) * nc;
+        state[slot] = loaded;
+        first_row[slot] = r0;
+        first_col[slot] = c0;
+        ncols[slot] = nc;
+    }
+
+    void store(int slot, rocblas_int r0, rocblas_int c0, rocblas_int nc)
+    {
+        EXPECT_EQ(slot, OOC_SLAB);
+        EXPECT_EQ(state[slot], released);
+        EXPECT_EQ(first_col[slot], c0);
+        for (rocblas_int j = 0; j < nc; ++j) {
+            for (rocblas_int i = r0; i < m; ++i)
+                A[i + (c0 + j)*lda] = slots[slot][(i - r0) + j*m];
+            stored[c0 + j] = true;
+        }
+    }
+
+    void acquire(int slot)
+    {
+        EXPECT_EQ(state[slot], loaded);
+        state[slot] = busy;
+    }
+
+    void release(int slot)
+    {
+        EXPECT_EQ(state[slot], busy);
+        state[slot] = released;
+    }
+
+    void swap(rocblas_int nc, rocblas_int k1, rocblas_int k2)
+    {
+        EXPECT_EQ(state[OOC_SLAB], busy);
+        host_lu_laswp<T>(nc, slots[OOC_SLAB].data(), m, k1, k2, ipiv.data());
+    }
+
+    void update(int slot, rocblas_int k0, rocblas_int kw, rocblas_int nc)
+    {
+        EXPECT_EQ(state[OOC_SLAB], busy);
+        EXPECT_EQ(state[slot], busy);
+        EXPECT_EQ(first_row[slot], k0);
+        EXPECT_EQ(first_col[slot], k0);
+        EXPECT_EQ(ncols[slot], kw);
+        T* L = slots[slot].data();
+        T* S = slots[OOC_SLAB].data();
+
+        for (rocblas_int c = 0; c < nc; ++c) {
+            for (rocblas_int k = 0; k < kw; ++k) {
+                T t = S[k0 + k + c*m];
+                for (rocblas_int i = k + 1; i < m - k0; ++i)
+                    S[k0 + i + c*m] -= L[i + k*m] * t;
+            }
+        }
+    }
+
+    void factor(rocblas_int c0, rocblas_int nc)
+    {
+        EXPECT_EQ(state[OOC_SLAB], busy);
+        EXPECT_EQ(first_col[OOC_SLAB], c0);
+        T* S = slots[OOC_SLAB].data() + c0;
+        rocblas_int kw = min(m - c0, nc);
+
+        rocblas_int pinfo = rocsolver_host_getrf_panel<T>(m - c0, kw, S, m, ipiv.data() + c0, pivot);
+        if (info == 0 && pinfo > 0)
+            info = pinfo + c0;
+
+        // (wide slab: the columns to the right of the square block only need the interchanges and the trsm)
+        if (kw < nc) {
+            if (pivot)
+                host_lu_laswp<T>(nc - kw, S + kw*m, m, 0, kw, ipiv.data() + c0);
+            for (rocblas_int c = kw; c < nc; ++c)
+                for (rocblas_int k = 0; k < kw; ++k)
+                    for (rocblas_int i = k + 1; i < kw; ++i)
+                        S[i + c*m] -= S[i + k*m] * S[k + c*m];
+        }
+
+        if (pivot)
+            for (rocblas_int k = c0; k < c0 + kw; ++k)
+                ipiv[k] += c0;
+    }
+
+    void synchronize()
+    {
+        for (int s = 0; s < 3; ++s)
+            EXPECT_NE(state[s], busy);
+        synced = true;
+    }
+
+    void swap_left(rocblas_int c0, rocblas_int nc, rocblas_int k1, rocblas_int k2)
+    {
+        EXPECT_TRUE(synced);
+        host_lu_laswp<T>(nc, A + c0*lda, lda, k1, k2, ipiv.data());
+    }
+};
+
+template <typename T>
+static void ooc_lu_initData(vector<T>& A, const rocblas_int m, const rocblas_int n, const rocblas_int lda, const bool dominant)
+{
+    mt19937 gen(m * 1000 + n);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (rocblas_int j = 0; j < n; ++j)
+        for (rocblas_int i = 0; i < m; ++i)
+            A[i + j*lda] = T(dist(gen)) + T(dominant && i == j ? n : 0);
+}
+
+template <typename T>
+static void ooc_lu_check(const rocblas_int m, const rocblas_int n, const rocblas_int w, const rocblas_int zerocol = -1)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int lda = m + 2;
+    rocblas_int dim = min(m, n);
+    vector<T> A(lda * n), ARef;
+    vector<rocblas_int> ipivRef(dim);
+    rocblas_int infoRef;
+
+    ooc_lu_initData(A, m, n, lda, false);
+    if (zerocol >= 0)
+        for (rocblas_int i = 0; i < m; ++i)
+            A[i + zerocol*lda] = 0;
+    ARef = A;
+
+    ooc_host_device<T> dev(m, n, A.data(), lda, w, true);
+    rocsolver_ooc_getrf_schedule(dev, m, n, w, true);
+    cblas_getrf<T>(m, n, ARef.data(), lda, ipivRef.data(), &infoRef);
+
+    EXPECT_EQ(dev.info, infoRef);
+    for (rocblas_int k = 0; k < dim; ++k)
+        EXPECT_EQ(dev.ipiv[k], ipivRef[k]);
+    EXPECT_LE(norm_error('F', m, n, lda, ARef.data(), A.data()), max(m, n) * get_epsilon<S>());
+}
+
+TEST(checkin_auxiliary_ooc_lu, slab_width)
+{
+    // device memory of a matrix with 1000 rows: three slabs and the pivots
+    auto size_of = [](rocblas_int w) { return 3 * sizeof(double) * 1000 * size_t(w) + 4000; };
+
+    EXPECT_EQ(rocsolver_ooc_slab_width(500, 64, size_t(1) << 30, size_of), 500);
+    EXPECT_EQ(rocsolver_ooc_slab_width(0, 64, 0, size_of), 0);
+    EXPECT_EQ(rocsolver_ooc_slab_width(5000, 64, 1000, size_of), 0);
+
+    // multiple of the step, or less than a step if the budget is tight
+    rocblas_int w = rocsolver_ooc_slab_width(5000, 64, 10000000, size_of);
+    EXPECT_EQ(w % 64, 0);
+    EXPECT_LE(size_of(w), 10000000u);
+    EXPECT_GT(size_of(w + 64), 10000000u);
+    w = rocsolver_ooc_slab_width(5000, 64, 1000000, size_of);
+    EXPECT_LT(w, 64);
+    EXPECT_LE(size_of(w), 1000000u);
+    EXPECT_GT(size_of(w + 1), 1000000u);
+}
+
+TEST(checkin_auxiliary_ooc_lu, square)
+{
+    ooc_lu_check<double>(300, 300, 64);
+    ooc_lu_check<double>(300, 300, 300);
+    ooc_lu_check<double>(257, 257, 32);
+    ooc_lu_check<float>(200, 200, 50);
+    ooc_lu_check<rocblas_double_complex>(150, 150, 40);
+}
+
+TEST(checkin_auxiliary_ooc_lu, rectangular)
+{
+    // tall, wide, and wide with a slab across the last row
+    ooc_lu_check<double>(400, 130, 64);
+    ooc_lu_check<double>(130, 400, 64);
+    ooc_lu_check<double>(100, 400, 64);
+    ooc_lu_check<rocblas_double_complex>(90, 250, 32);
+}
+
+TEST(checkin_auxiliary_ooc_lu, singular)
+{
+    ooc_lu_check<double>(200, 200, 32, 5);
+    ooc_lu_check<double>(200, 200, 32, 100);
+}
+
+TEST(checkin_auxiliary_ooc_lu, no_pivoting)
+{
+    using T = double;
+    rocblas_int m = 300, n = 250, lda = 300, w = 48;
+    vector<T> A(lda * n), ARef;
+    vector<rocblas_int> ipiv(n);
+    ooc_lu_initData(A, m, n, lda, true);
+    ARef = A;
+
+    ooc_host_device<T> dev(m, n, A.data(), lda, w, false);
+    rocsolver_ooc_getrf_schedule(dev, m, n, w, false);
+    rocsolver_host_getrf_panel<T>(m, n, ARef.data(), lda, ipiv.data(), false);
+
+    EXPECT_EQ(dev.info, 0);
+    EXPECT_LE(norm_error('F', m, n, lda, ARef.data(), A.data()), m * get_epsilon<T>());
+}
+
+TEST(checkin_auxiliary_ooc_lu, transfers)
+{
+    // every slab is loaded once, and every factored slab once per slab to its right
+    // (only the rows below its diagonal block)
+    using T = double;
+    rocblas_int m = 256, n = 256, lda = 256, w = 64;
+    vector<T> A(lda * n);
+    ooc_lu_initData(A, m, n, lda, false);
+
+    ooc_host_device<T> dev(m, n, A.data(), lda, w, true);
+    rocsolver_ooc_getrf_schedule(dev, m, n, w, true);
+
+    size_t expected = size_t(m) * n;
+    for (rocblas_int k0 = 0; k0 < n; k0 += w)
+        expected += size_t(m - k0) * w * ((n - k0 - w) / w);
+    EXPECT_EQ(dev.loaded_entries, expected);
+}
@@ -0,0 +1,281 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver.hpp"
+#include "clientcommon.hpp"
+
+using namespace std;
+
+// tests for the solver plans. The results of a plan must be identical to those
+// of the corresponding function (they run the same computation).
+
+template <typename H>
+static void plan_initData(H &hA, const rocblas_int m, const rocblas_int n,
+                          const rocblas_int lda, const rocblas_int bc)
+{
+    rocblas_init<double>(hA, true);
+    for (rocblas_int b = 0; b < bc; ++b)
+        for (rocblas_int j = 0; j < n; j++)
+            for (rocblas_int i = 0; i < m; i++)
+                hA[b][i + j*lda] += (i == j) ? 400 : -4;
+}
+
+TEST(checkin_lapack_plan, bad_arg)
+{
+    rocblas_local_handle handle;
+    rocsolver_plan plan;
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_create(nullptr, rocsolver_plan_getrf, rocblas_datatype_f64_r,
+                                                10, 10, 10, 0, 0, 1, &plan), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_create(handle, rocsolver_plan_getrf, rocblas_datatype_f64_r,
+                                                10, 10, 10, 0, 0, 1, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_create(handle, rocsolver_plan_getrf, rocblas_datatype_i32_r,
+                                                10, 10, 10, 0, 0, 1, &plan), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_create(handle, rocsolver_plan_getrf, rocblas_datatype_f64_r,
+                                                10, 10, 5, 0, 0, 1, &plan), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_create(handle, rocsolver_plan_getri, rocblas_datatype_f64_r,
+                                                10, 8, 10, 0, 0, 1, &plan), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_execute(nullptr, nullptr, nullptr, nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_destroy(nullptr), rocblas_status_invalid_handle);
+
+    // pointers are checked at execution
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_create(handle, rocsolver_plan_getrf, rocblas_datatype_f64_r,
+                                              10, 10, 10, 0, 0, 1, &plan));
+    EXPECT_ROCBLAS_STATUS(rocsolver_plan_execute(plan, nullptr, nullptr, nullptr), rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_destroy(plan));
+}
+
+// (with lookahead, the reference and the plan are computed with the look-ahead enabled, and 
+//  the option is disabled before the plan is executed: the plan must keep the options it had
+//  at creation)
+static void plan_getrf_compare(const rocblas_int m, const rocblas_int n, const bool lookahead = false)
+{
+    rocblas_local_handle handle;
+    rocblas_int lda = m, bc = 3;
+    rocblas_stride stA = lda * n, stP = min(m, n);
+
+    host_strided_batch_vector<double> hA(stA,1,stA,bc);
+    host_strided_batch_vector<double> hARes(stA,1,stA,bc);
+    host_strided_batch_vector<double> hAPlan(stA,1,stA,bc);
+    host_strided_batch_vector<rocblas_int> hIpivRes(stP,1,stP,bc);
+    host_strided_batch_vector<rocblas_int> hIpivPlan(stP,1,stP,bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1,1,1,bc);
+    host_strided_batch_vector<rocblas_int> hinfoPlan(1,1,1,bc);
+    device_strided_batch_vector<double> dA(stA,1,stA,bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP,1,stP,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    plan_initData(hA, m, n, lda, bc);
+
+    // reference results
+    if (lookahead)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, rocsolver_lookahead_enabled));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_strided_batched(handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // the plan is executed several times on the same data
+    rocsolver_plan plan;
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_create(handle, rocsolver_plan_getrf_strided_batched, rocblas_datatype_f64_r,
+                                              m, n, lda, stA, stP, bc, &plan));
+    if (lookahead)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, rocsolver_lookahead_disabled));
+    for (int rep = 0; rep < 2; ++rep)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocsolver_plan_execute(plan, dA.data(), dIpiv.data(), dinfo.data()));
+        CHECK_HIP_ERROR(hAPlan.transfer_from(dA));
+        CHECK_HIP_ERROR(hIpivPlan.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hinfoPlan.transfer_from(dinfo));
+
+        for (rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(norm_error('F',m,n,lda,hARes[b],hAPlan[b]), 0);
+            EXPECT_EQ(hinfoRes[b][0], hinfoPlan[b][0]);
+            for (rocblas_int i = 0; i < stP; ++i)
+                EXPECT_EQ(hIpivRes[b][i], hIpivPlan[b][i]);
+        }
+    }
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_destroy(plan));
+    if (lookahead)
+        CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+}
+
+TEST(checkin_lapack_plan, getrf_small)
+{
+    plan_getrf_compare(20, 20);
+}
+
+TEST(checkin_lapack_plan, getrf_blocked)
+{
+    plan_getrf_compare(150, 130);
+}
+
+TEST(checkin_lapack_plan, getrf_lookahead)
+{
+    plan_getrf_compare(300, 300, true);
+}
+
+
+// matrices of a plan test in the layout of the routine: arrays of pointers for 
+// the batched routines, strided otherwise (a single matrix for the non-batched ones)
+template <bool BATCHED>
+struct plan_matrices;
+
+template <>
+struct plan_matrices<true>
+{
+    host_batch_vector<double> hA, hARes, hAPlan;
+    device_batch_vector<double> dA;
+
+    plan_matrices(const rocblas_stride size, const rocblas_int bc)
+        : hA(size,1,bc), hARes(size,1,bc), hAPlan(size,1,bc), dA(size,1,bc)
+    {
+    }
+};
+
+template <>
+struct plan_matrices<false>
+{
+    host_strided_batch_vector<double> hA, hARes, hAPlan;
+    device_strided_batch_vector<double> dA;
+
+    plan_matrices(const rocblas_stride size, const rocblas_int bc)
+        : hA(size,1,size,bc), hARes(size,1,size,bc), hAPlan(size,1,size,bc), dA(size,1,size,bc)
+    {
+    }
+};
+
+template <bool BATCHED, bool STRIDED>
+static void plan_getri_compare(const rocsolver_plan_routine routine, const rocblas_int n)
+{
+    rocblas_local_handle handle;
+    rocblas_int lda = n, bc = (BATCHED || STRIDED) ? 3 : 1;
+    rocblas_stride stA = lda * n, stP = n;
+
+    plan_matrices<BATCHED> mat(stA, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP,1,stP,bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1,1,1,bc);
+    host_strided_batch_vector<rocblas_int> hinfoPlan(1,1,1,bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP,1,stP,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(mat.dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // the matrices are taken as their own LU factors (the diagonal dominance keeps 
+    // them well conditioned), with an interchange every other row
+    plan_initData(mat.hA, n, n, lda, bc);
+    for (rocblas_int b = 0; b < bc; ++b)
+        for (rocblas_int i = 0; i < n; ++i)
+            hIpiv[b][i] = (i % 2 == 0 && i + 1 < n) ? i + 2 : i + 1;
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    // reference results
+    // (the client wrapper of the batched routines calls GETRI_BATCHED when STRIDED is set)
+    CHECK_HIP_ERROR(mat.dA.transfer_from(mat.hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_getri(BATCHED || STRIDED, handle, n, mat.dA.data(), mat.dA.data(), lda, stA,
+                                        dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_HIP_ERROR(mat.hARes.transfer_from(mat.dA));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // the plan is executed several times on the same data
+    rocsolver_plan plan;
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_create(handle, routine, rocblas_datatype_f64_r,
+                                              n, n, lda, stA, stP, bc, &plan));
+    for (int rep = 0; rep < 2; ++rep)
+    {
+        CHECK_HIP_ERROR(mat.dA.transfer_from(mat.hA));
+        CHECK_ROCBLAS_ERROR(rocsolver_plan_execute(plan, mat.dA.data(), dIpiv.data(), dinfo.data()));
+        CHECK_HIP_ERROR(mat.hAPlan.transfer_from(mat.dA));
+        CHECK_HIP_ERROR(hinfoPlan.transfer_from(dinfo));
+
+        for (rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(norm_error('F',n,n,lda,mat.hARes[b],mat.hAPlan[b]), 0);
+            EXPECT_EQ(hinfoRes[b][0], hinfoPlan[b][0]);
+        }
+    }
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_destroy(plan));
+}
+
+template <bool BATCHED, bool STRIDED>
+static void plan_geqrf_compare(const rocsolver_plan_routine routine, const rocblas_int m, const rocblas_int n)
+{
+    rocblas_local_handle handle;
+    rocblas_int lda = m, bc = (BATCHED || STRIDED) ? 3 : 1;
+    rocblas_stride stA = lda * n, stP = min(m, n);
+
+    plan_matrices<BATCHED> mat(stA, bc);
+    host_strided_batch_vector<double> hTauRes(stP,1,stP,bc);
+    host_strided_batch_vector<double> hTauPlan(stP,1,stP,bc);
+    device_strided_batch_vector<double> dTau(stP,1,stP,bc);
+    CHECK_HIP_ERROR(mat.dA.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    plan_initData(mat.hA, m, n, lda, bc);
+
+    // reference results
+    CHECK_HIP_ERROR(mat.dA.transfer_from(mat.hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(STRIDED, true, handle, m, n, mat.dA.data(), lda, stA,
+                                              dTau.data(), stP, bc));
+    CHECK_HIP_ERROR(mat.hARes.transfer_from(mat.dA));
+    CHECK_HIP_ERROR(hTauRes.transfer_from(dTau));
+
+    // the plan is executed several times on the same data
+    rocsolver_plan plan;
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_create(handle, routine, rocblas_datatype_f64_r,
+                                              m, n, lda, stA, stP, bc, &plan));
+    for (int rep = 0; rep < 2; ++rep)
+    {
+        CHECK_HIP_ERROR(mat.dA.transfer_from(mat.hA));
+        CHECK_ROCBLAS_ERROR(rocsolver_plan_execute(plan, mat.dA.data(), dTau.data(), nullptr));
+        CHECK_HIP_ERROR(mat.hAPlan.transfer_from(mat.dA));
+        CHECK_HIP_ERROR(hTauPlan.transfer_from(dTau));
+
+        for (rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(norm_error('F',m,n,lda,mat.hARes[b],mat.hAPlan[b]), 0);
+            for (rocblas_int i = 0; i < stP; ++i)
+                EXPECT_EQ(hTauRes[b][i], hTauPlan[b][i]);
+        }
+    }
+    CHECK_ROCBLAS_ERROR(rocsolver_plan_destroy(plan));
+}
+
+TEST(checkin_lapack_plan, getri)
+{
+    plan_getri_compare<false,false>(rocsolver_plan_getri, 100);
+}
+
+TEST(checkin_lapack_plan, getri_batched)
+{
+    plan_getri_compare<true,false>(rocsolver_plan_getri_batched, 100);
+}
+
+TEST(checkin_lapack_plan, getri_strided_batched)
+{
+    plan_getri_compare<false,true>(rocsolver_plan_getri_strided_batched, 100);
+}
+
+TEST(checkin_lapack_plan, geqrf)
+{
+    plan_geqrf_compare<false,false>(rocsolver_plan_geqrf, 200, 150);
+}
+
+TEST(checkin_lapack_plan, geqrf_batched)
+{
+    plan_geqrf_compare<true,false>(rocsolver_plan_geqrf_batched, 200, 150);
+}
+
+TEST(checkin_lapack_plan, geqrf_strided_batched)
+{
+    plan_geqrf_compare<false,true>(rocsolver_plan_geqrf_strided_batched, 200, 150);
+}
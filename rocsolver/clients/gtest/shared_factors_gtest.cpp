@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver.hpp"
+#include "clientcommon.hpp"
+
+using namespace std;
+
+// tests for the strided_batched functions when all the instances share the
+// same factors (strideA = strideP = 0): the results must be those of the
+// functions applied to a single instance.
+
+static void shared_factors_initData(host_strided_batch_vector<double> &hA, const rocblas_int n, const rocblas_int lda)
+{
+    rocblas_init<double>(hA, true);
+    for (rocblas_int j = 0; j < n; j++)
+        for (rocblas_int i = 0; i < n; i++)
+            hA[0][i + j*lda] += (i == j) ? 400 : -4;
+}
+
+TEST(checkin_lapack_shared_factors, getrs)
+{
+    rocblas_local_handle handle;
+    rocblas_int nrhs = 3, bc = 7;
+
+    for (rocblas_int n : {10, 100, 300})
+    {
+        // contiguous right hand sides (solved as a single system) and with padding
+        for (rocblas_int pad : {0, 5})
+        {
+            rocblas_int lda = n, ldb = n;
+            rocblas_stride stB = ldb*nrhs + pad;
+            host_strided_batch_vector<double> hA(lda*n,1,lda*n,1);
+            host_strided_batch_vector<double> hB(stB,1,stB,bc);
+            host_strided_batch_vector<double> hBRes(stB,1,stB,bc);
+            host_strided_batch_vector<double> hBShared(stB,1,stB,bc);
+            device_strided_batch_vector<double> dA(lda*n,1,lda*n,1);
+            device_strided_batch_vector<double> dB(stB,1,stB,bc);
+            device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,1);
+            device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dB.memcheck());
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+            CHECK_HIP_ERROR(dinfo.memcheck());
+            shared_factors_initData(hA, n, lda);
+            rocblas_init<double>(hB, true);
+
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+
+            // reference results, one instance at a time
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            for (rocblas_int b = 0; b < bc; b++)
+                CHECK_ROCBLAS_ERROR(rocsolver_dgetrs(handle, rocblas_operation_none, n, nrhs, dA.data(), lda, dIpiv.data(),
+                                                     dB.data() + b*stB, ldb));
+            CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+            // shared factors
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_ROCBLAS_ERROR(rocsolver_dgetrs_strided_batched(handle, rocblas_operation_none, n, nrhs, dA.data(), lda, 0,
+                                                                 dIpiv.data(), 0, dB.data(), ldb, stB, bc));
+            CHECK_HIP_ERROR(hBShared.transfer_from(dB));
+
+            for (rocblas_int b = 0; b < bc; b++)
+                EXPECT_LE(norm_error('F',n,nrhs,ldb,hBRes[b],hBShared[b]), n * get_epsilon<double>());
+        }
+    }
+}
+
+TEST(checkin_lapack_shared_factors, getri)
+{
+    rocblas_local_handle handle;
+    rocblas_int n = 50, lda = 50, bc = 4;
+    host_strided_batch_vector<double> hA(lda*n,1,lda*n,1);
+    host_strided_batch_vector<double> hARes(lda*n,1,lda*n,1);
+    host_strided_batch_vector<double> hAShared(lda*n,1,lda*n,1);
+    host_strided_batch_vector<rocblas_int> hInfo(1,1,1,bc);
+    device_strided_batch_vector<double> dA(lda*n,1,lda*n,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    shared_factors_initData(hA, n, lda);
+
+    // reference results
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetri(handle, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // shared factors (the info of every instance is set)
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dinfo));
+    for (rocblas_int b = 1; b < bc; b++)
+        hInfo[b][0] = -1;
+    CHECK_HIP_ERROR(dinfo.transfer_from(hInfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetri_strided_batched(handle, n, dA.data(), lda, 0, dIpiv.data(), 0, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hAShared.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dinfo));
+
+    EXPECT_LE(norm_error('F',n,n,lda,hARes[0],hAShared[0]), n * get_epsilon<double>());
+    for (rocblas_int b = 0; b < bc; b++)
+        EXPECT_EQ(hInfo[b][0], 0);
+}
@@ -0,0 +1,225 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+// the sizes in the arguments are the maximum sizes of the instances
+// (see vbatched_size); the batches have 8 instances, with repeated sizes,
+// and, for the small sizes, empty instances
+
+/******************** GETRF_VBATCHED ********************/
+
+typedef vector<int> getrf_vbatched_tuple;
+
+// each matrix_size vector is a {M, N, lda}
+
+// case when M = N = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrf_vbatched_size_range = {
+    {0, 0, 1},                                  //quick return (empty instances)
+    {-1, 10, 1}, {10, -1, 10}, {20, 20, 10},    //invalid
+    {1, 1, 1}, {3, 5, 3}, {20, 20, 20}, {40, 30, 50}, {64, 64, 64},   //small kernel
+    {150, 150, 150}, {300, 70, 310}, {70, 300, 80}                    //getrf
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrf_vbatched_size_range = {
+    {256, 64, 256}, {600, 600, 600}, {1000, 800, 1024}
+};
+
+
+Arguments getrf_vbatched_setup_arguments(getrf_vbatched_tuple tup) {
+    Arguments arg;
+
+    arg.M = tup[0];
+    arg.N = tup[1];
+    arg.lda = tup[2];
+
+    arg.timing = 0;
+    arg.batch_count = 8;
+
+    return arg;
+}
+
+class GETRF_VBATCHED : public ::TestWithParam<getrf_vbatched_tuple> {
+protected:
+    GETRF_VBATCHED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRF_VBATCHED, __float) {
+    Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_vbatched_bad_arg<float>();
+
+    testing_getrf_vbatched<float>(arg);
+}
+
+TEST_P(GETRF_VBATCHED, __double) {
+    Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_vbatched_bad_arg<double>();
+
+    testing_getrf_vbatched<double>(arg);
+}
+
+TEST_P(GETRF_VBATCHED, __float_complex) {
+    Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_vbatched_bad_arg<rocblas_float_complex>();
+
+    testing_getrf_vbatched<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRF_VBATCHED, __double_complex) {
+    Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrf_vbatched_bad_arg<rocblas_double_complex>();
+
+    testing_getrf_vbatched<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_VBATCHED,
+                         ValuesIn(large_getrf_vbatched_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_VBATCHED,
+                         ValuesIn(getrf_vbatched_size_range));
+/********************************************************/
+
+
+/******************** GETRS_VBATCHED ********************/
+
+typedef std::tuple<vector<int>, vector<int>> getrs_vbatched_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range vector is a {nrhs, trans};
+// if trans = 0 then no transpose
+// if trans = 1 then transpose
+// if trans = 2 then conjugate transpose
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> getrs_vbatched_sizeA_range = {
+    {0, 1, 1},                                  //empty instances
+    {-1, 1, 1}, {20, 10, 20}, {20, 20, 10},     //invalid
+    {1, 1, 1}, {20, 20, 20}, {60, 64, 70}, {150, 160, 150}
+};
+const vector<vector<int>> getrs_vbatched_sizeB_range = {
+    {0, 0},     //empty instances
+    {-1, 0},    //invalid
+    {1, 0}, {10, 1}, {30, 2}
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_getrs_vbatched_sizeA_range = {
+    {300, 300, 300}, {700, 710, 700}
+};
+const vector<vector<int>> large_getrs_vbatched_sizeB_range = {
+    {100, 0}, {200, 1}
+};
+
+
+Arguments getrs_vbatched_setup_arguments(getrs_vbatched_tuple tup) {
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB[0];
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+
+    if (matrix_sizeB[1] == 0)
+        arg.transA_option = 'N';
+    else if(matrix_sizeB[1] == 1)
+        arg.transA_option = 'T';
+    else
+        arg.transA_option = 'C';
+
+    arg.timing = 0;
+    arg.batch_count = 8;
+
+    return arg;
+}
+
+class GETRS_VBATCHED : public ::TestWithParam<getrs_vbatched_tuple> {
+protected:
+    GETRS_VBATCHED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+
+TEST_P(GETRS_VBATCHED, __float) {
+    Arguments arg = getrs_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_vbatched_bad_arg<float>();
+
+    testing_getrs_vbatched<float>(arg);
+}
+
+TEST_P(GETRS_VBATCHED, __double) {
+    Arguments arg = getrs_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_vbatched_bad_arg<double>();
+
+    testing_getrs_vbatched<double>(arg);
+}
+
+TEST_P(GETRS_VBATCHED, __float_complex) {
+    Arguments arg = getrs_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_vbatched_bad_arg<rocblas_float_complex>();
+
+    testing_getrs_vbatched<rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRS_VBATCHED, __double_complex) {
+    Arguments arg = getrs_vbatched_setup_arguments(GetParam());
+
+    if (arg.M == 0 && arg.N == 0)
+        testing_getrs_vbatched_bad_arg<rocblas_double_complex>();
+
+    testing_getrs_vbatched<rocblas_double_complex>(arg);
+}
+
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRS_VBATCHED,
+                         Combine(ValuesIn(large_getrs_vbatched_sizeA_range),
+                                 ValuesIn(large_getrs_vbatched_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRS_VBATCHED,
+                         Combine(ValuesIn(getrs_vbatched_sizeA_range),
+                                 ValuesIn(getrs_vbatched_sizeB_range)));
+/********************************************************/
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver.hpp"
+#include "clientcommon.hpp"
+
+using namespace std;
+
+// tests for the workspace size queries and the user provided workspace.
+// getrf is used as representative function (it needs several pieces of workspace
+// plus the memory that rocblas trsm allocates in the handle).
+
+static void workspace_initData(host_strided_batch_vector<double> &hA,
+                               const rocblas_int m, const rocblas_int n, const rocblas_int lda)
+{
+    rocblas_init<double>(hA, true);
+    for (rocblas_int j = 0; j < n; j++)
+        for (rocblas_int i = 0; i < m; i++)
+            hA[0][i + j*lda] += (i == j) ? 400 : -4;
+}
+
+TEST(checkin_lapack_workspace, query_mode)
+{
+    rocblas_local_handle handle;
+    size_t size;
+
+    // stop without start and nested start are mismatches
+    EXPECT_ROCBLAS_STATUS(rocsolver_stop_workspace_size_query(handle, &size), rocblas_status_size_query_mismatch);
+    EXPECT_ROCBLAS_STATUS(rocsolver_start_workspace_size_query(handle), rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_start_workspace_size_query(handle), rocblas_status_size_query_mismatch);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stop_workspace_size_query(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stop_workspace_size_query(handle, &size), rocblas_status_success);
+    EXPECT_EQ(size, 0);
+
+    // bad arguments
+    EXPECT_ROCBLAS_STATUS(rocsolver_start_workspace_size_query(nullptr), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_workspace(handle, nullptr, 1), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_workspace(nullptr, nullptr, 0), rocblas_status_invalid_handle);
+
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+}
+
+TEST(checkin_lapack_workspace, no_state_without_settings)
+{
+    rocblas_local_handle handle;
+    rocblas_int m = 100, n = 100, lda = 100, bc = 3;
+    rocblas_stride stA = lda * n;
+    host_strided_batch_vector<double> hA(stA,1,stA,bc);
+    device_strided_batch_vector<double> dA(stA,1,stA,bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    rocblas_init<double>(hA, true);
+
+    // the functions do not keep any state for a handle without settings (their workspace
+    // comes from the cache shared by the device, that is not reported for the handle)
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, m, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_strided_batched(handle, m, n, dA.data(), lda, stA, dIpiv.data(), n, dinfo.data(), bc));
+
+    rocsolver_memory_stats stats;
+    size_t budget;
+    rocblas_int min_chunk, last_chunk;
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_stats(handle, &stats));
+    EXPECT_EQ(stats.allocations, 0);
+    EXPECT_EQ(stats.bytes_reserved, 0);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_budget(handle, &budget, &min_chunk, &last_chunk));
+    EXPECT_EQ(last_chunk, 0);
+
+    // once a setting is used, the memory is cached until the resources are released
+    CHECK_ROCBLAS_ERROR(rocsolver_set_memory_budget(handle, 0, 1));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, m, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_stats(handle, &stats));
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_GT(stats.bytes_reserved, 0);
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_stats(handle, &stats));
+    EXPECT_EQ(stats.bytes_reserved, 0);
+}
+
+TEST(checkin_lapack_workspace, user_workspace)
+{
+    rocblas_local_handle handle;
+    rocblas_int m = 100, n = 100, lda = 100;
+    size_t size_A = size_t(lda) * n;
+
+    host_strided_batch_vector<double> hA(size_A,1,size_A,1);
+    host_strided_batch_vector<double> hARes(size_A,1,size_A,1);
+    host_strided_batch_vector<double> hAWork(size_A,1,size_A,1);
+    host_strided_batch_vector<rocblas_int> hIpivRes(n,1,n,1);
+    host_strided_batch_vector<rocblas_int> hIpivWork(n,1,n,1);
+    device_strided_batch_vector<double> dA(size_A,1,size_A,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(n,1,n,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    workspace_initData(hA, m, n, lda);
+
+    // the query must not modify the data
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocsolver_start_workspace_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, m, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_stop_workspace_size_query(handle, &size));
+    EXPECT_GT(size, 0);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    EXPECT_EQ(norm_error('F',m,n,lda,hA[0],hARes[0]), 0);
+
+    // reference results with internal allocations
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, m, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+
+    // same computation with the user workspace must give the same results
+    void *work;
+    CHECK_HIP_ERROR(hipMalloc(&work, size));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, work, size));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, m, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hAWork.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivWork.transfer_from(dIpiv));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, nullptr, 0));
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_HIP_ERROR(hipFree(work));
+
+    EXPECT_EQ(norm_error('F',m,n,lda,hARes[0],hAWork[0]), 0);
+    for (rocblas_int i = 0; i < n; ++i)
+        EXPECT_EQ(hIpivRes[0][i], hIpivWork[0][i]);
+}
+
+TEST(checkin_lapack_workspace, memory_budget)
+{
+    rocblas_local_handle handle;
+    rocblas_int m = 80, n = 80, lda = 80, bc = 20;
+    rocblas_stride stA = lda * n, stP = n;
+
+    host_strided_batch_vector<double> hA(stA,1,stA,bc);
+    host_strided_batch_vector<double> hARes(stA,1,stA,bc);
+    host_strided_batch_vector<double> hAChunk(stA,1,stA,bc);
+    host_strided_batch_vector<rocblas_int> hIpivRes(stP,1,stP,bc);
+    host_strided_batch_vector<rocblas_int> hIpivChunk(stP,1,stP,bc);
+    device_strided_batch_vector<double> dA(stA,1,stA,bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP,1,stP,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    rocblas_init<double>(hA, true);
+
+    // bad arguments
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_memory_budget(nullptr, 0, 1), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_memory_budget(handle, 0, 0), rocblas_status_invalid_size);
+
+    // reference results without budget
+    size_t size, budget;
+    rocblas_int min_chunk, last_chunk;
+    CHECK_ROCBLAS_ERROR(rocsolver_start_workspace_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_strided_batched(handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_stop_workspace_size_query(handle, &size));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_strided_batched(handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_budget(handle, &budget, &min_chunk, &last_chunk));
+    EXPECT_EQ(budget, 0);
+    EXPECT_EQ(last_chunk, bc);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+
+    // with a budget of a third of the workspace the batch is split in chunks 
+    CHECK_ROCBLAS_ERROR(rocsolver_set_memory_budget(handle, size / 3, 1));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf_strided_batched(handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_budget(handle, &budget, &min_chunk, &last_chunk));
+    EXPECT_EQ(budget, size / 3);
+    EXPECT_LT(last_chunk, bc);
+    EXPECT_GE(last_chunk, 1);
+    CHECK_HIP_ERROR(hAChunk.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivChunk.transfer_from(dIpiv));
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+
+    for (rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(norm_error('F',m,n,lda,hARes[b],hAChunk[b]), 0);
+        for (rocblas_int i = 0; i < n; ++i)
+            EXPECT_EQ(hIpivRes[b][i], hIpivChunk[b][i]);
+    }
+}
+
+TEST(checkin_lapack_workspace, memory_budget_potrf)
+{
+    rocblas_local_handle handle;
+    rocblas_int n = 80, lda = 80, bc = 20;
+    rocblas_stride stA = lda * n;
+
+    host_strided_batch_vector<double> hA(stA,1,stA,bc);
+    host_strided_batch_vector<double> hARes(stA,1,stA,bc);
+    host_strided_batch_vector<double> hAChunk(stA,1,stA,bc);
+    device_strided_batch_vector<double> dA(stA,1,stA,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // symmetric positive definite matrices (diagonally dominant)
+    rocblas_init<double>(hA, true);
+    for (rocblas_int b = 0; b < bc; ++b)
+    {
+        for (rocblas_int i = 0; i < n; ++i)
+        {
+            for (rocblas_int j = 0; j < i; ++j)
+                hA[b][i + j*lda] = hA[b][j + i*lda];
+            hA[b][i + i*lda] += 400;
+        }
+    }
+
+    // reference results without budget
+    size_t size;
+    rocblas_int min_chunk, last_chunk;
+    size_t budget;
+    CHECK_ROCBLAS_ERROR(rocsolver_start_workspace_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, dA.data(), lda, stA, dinfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_stop_workspace_size_query(handle, &size));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, dA.data(), lda, stA, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // with a budget of a third of the workspace the batch is split in chunks 
+    CHECK_ROCBLAS_ERROR(rocsolver_set_memory_budget(handle, size / 3, 1));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, dA.data(), lda, stA, dinfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_memory_budget(handle, &budget, &min_chunk, &last_chunk));
+    EXPECT_LT(last_chunk, bc);
+    EXPECT_GE(last_chunk, 1);
+    CHECK_HIP_ERROR(hAChunk.transfer_from(dA));
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+
+    for (rocblas_int b = 0; b < bc; ++b)
+        EXPECT_EQ(norm_error('F',n,n,lda,hARes[b],hAChunk[b]), 0);
+}
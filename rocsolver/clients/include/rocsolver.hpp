@@ -713,6 +713,60 @@ inline rocblas_status rocsolver_getf2_getrf(bool STRIDED, bool GETRF, rocblas_ha
 /********************************************************/
 
 
+/******************** GETRF_OOC ********************/
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle, rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info)
+{
+    return rocsolver_sgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle, rocblas_int m, rocblas_int n, double *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info)
+{
+    return rocsolver_dgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_float_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info)
+{
+    return rocsolver_cgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_double_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info)
+{
+    return rocsolver_zgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+/********************************************************/
+
+
+/******************** GETRF_CACHE ********************/
+inline rocblas_status rocsolver_getrf_cache(rocblas_handle handle, rocblas_int n, float *A,
+                        rocblas_int lda, rocblas_int *ipiv, float *cache, rocblas_int *info)
+{
+    return rocsolver_sgetrf_cache(handle, n, A, lda, ipiv, cache, info);
+}
+
+inline rocblas_status rocsolver_getrf_cache(rocblas_handle handle, rocblas_int n, double *A,
+                        rocblas_int lda, rocblas_int *ipiv, double *cache, rocblas_int *info)
+{
+    return rocsolver_dgetrf_cache(handle, n, A, lda, ipiv, cache, info);
+}
+
+inline rocblas_status rocsolver_getrf_cache(rocblas_handle handle, rocblas_int n, rocblas_float_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *cache, rocblas_int *info)
+{
+    return rocsolver_cgetrf_cache(handle, n, A, lda, ipiv, cache, info);
+}
+
+inline rocblas_status rocsolver_getrf_cache(rocblas_handle handle, rocblas_int n, rocblas_double_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *cache, rocblas_int *info)
+{
+    return rocsolver_zgetrf_cache(handle, n, A, lda, ipiv, cache, info);
+}
+/********************************************************/
+
+
 /******************** GETRS ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getrs(bool STRIDED, rocblas_handle handle, rocblas_operation trans, rocblas_int n,
@@ -782,6 +836,37 @@ inline rocblas_status rocsolver_getrs(bool STRIDED, rocblas_handle handle, rocbl
 /********************************************************/
 
 
+/******************** GETRS_CACHE ********************/
+inline rocblas_status rocsolver_getrs_cache(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                        rocblas_int nrhs, float *A, rocblas_int lda, const rocblas_int *ipiv, float *cache,
+                        float *B, rocblas_int ldb)
+{
+    return rocsolver_sgetrs_cache(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_cache(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                        rocblas_int nrhs, double *A, rocblas_int lda, const rocblas_int *ipiv, double *cache,
+                        double *B, rocblas_int ldb)
+{
+    return rocsolver_dgetrs_cache(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_cache(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                        rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda, const rocblas_int *ipiv, rocblas_float_complex *cache,
+                        rocblas_float_complex *B, rocblas_int ldb)
+{
+    return rocsolver_cgetrs_cache(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_cache(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                        rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda, const rocblas_int *ipiv, rocblas_double_complex *cache,
+                        rocblas_double_complex *B, rocblas_int ldb)
+{
+    return rocsolver_zgetrs_cache(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+/********************************************************/
+
+
 /******************** GETRI ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getri(bool STRIDED, rocblas_handle handle, rocblas_int n, float *A1,
@@ -1195,4 +1280,281 @@ inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED, bool GEBRD, rocblas_ha
 /********************************************************/
 
 
+/******************** GESV ********************/
+// strided_batched
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, float *B, rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, double *B, rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, rocblas_float_complex *B, rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, rocblas_double_complex *B, rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, info, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *const A[], rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, float *const B[], rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *const A[], rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, double *const B[], rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *const A[], rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, rocblas_float_complex *const B[], rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *const A[], rocblas_int lda,
+                        rocblas_stride stA, rocblas_int *ipiv, rocblas_stride stP, rocblas_double_complex *const B[], rocblas_int ldb, rocblas_stride stB,
+                        rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+
+/******************** GESV_IR ********************/
+inline rocblas_status rocsolver_gesv_ir(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda,
+                        rocblas_int *ipiv, double *B, rocblas_int ldb, double *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info)
+{
+    return rocsolver_dgesv_ir(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+inline rocblas_status rocsolver_gesv_ir(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda,
+                        rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb, rocblas_double_complex *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info)
+{
+    return rocsolver_zgesv_ir(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+/********************************************************/
+
+
+/******************** GETRF_VBATCHED ********************/
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, rocblas_int *m, rocblas_int *n, float *const A[],
+                        rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_sgetrf_vbatched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, rocblas_int *m, rocblas_int *n, double *const A[],
+                        rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dgetrf_vbatched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, rocblas_int *m, rocblas_int *n, rocblas_float_complex *const A[],
+                        rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cgetrf_vbatched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, rocblas_int *m, rocblas_int *n, rocblas_double_complex *const A[],
+                        rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zgetrf_vbatched(handle, m, n, A, lda, ipiv, info, bc);
+}
+/********************************************************/
+
+
+/******************** GETRS_VBATCHED ********************/
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle, rocblas_operation trans, rocblas_int *n, rocblas_int *nrhs,
+                        float *const A[], rocblas_int *lda, const rocblas_int *const ipiv[], float *const B[], rocblas_int *ldb,
+                        rocblas_int bc)
+{
+    return rocsolver_sgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle, rocblas_operation trans, rocblas_int *n, rocblas_int *nrhs,
+                        double *const A[], rocblas_int *lda, const rocblas_int *const ipiv[], double *const B[], rocblas_int *ldb,
+                        rocblas_int bc)
+{
+    return rocsolver_dgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle, rocblas_operation trans, rocblas_int *n, rocblas_int *nrhs,
+                        rocblas_float_complex *const A[], rocblas_int *lda, const rocblas_int *const ipiv[], rocblas_float_complex *const B[], rocblas_int *ldb,
+                        rocblas_int bc)
+{
+    return rocsolver_cgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle, rocblas_operation trans, rocblas_int *n, rocblas_int *nrhs,
+                        rocblas_double_complex *const A[], rocblas_int *lda, const rocblas_int *const ipiv[], rocblas_double_complex *const B[], rocblas_int *ldb,
+                        rocblas_int bc)
+{
+    return rocsolver_zgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+/********************************************************/
+
+
+/******************** PACK_UNPACK_INTERLEAVED ********************/
+inline rocblas_status rocsolver_pack_unpack_interleaved(bool PACK, rocblas_handle handle, rocblas_int m, rocblas_int n,
+                        float *S, rocblas_int lds, rocblas_stride stS, float *I, rocblas_int ldi, rocblas_int bc)
+{
+    return PACK ?
+        rocsolver_spack_interleaved_batched(handle, m, n, S, lds, stS, I, ldi, bc) :
+        rocsolver_sunpack_interleaved_batched(handle, m, n, I, ldi, S, lds, stS, bc);
+}
+
+inline rocblas_status rocsolver_pack_unpack_interleaved(bool PACK, rocblas_handle handle, rocblas_int m, rocblas_int n,
+                        double *S, rocblas_int lds, rocblas_stride stS, double *I, rocblas_int ldi, rocblas_int bc)
+{
+    return PACK ?
+        rocsolver_dpack_interleaved_batched(handle, m, n, S, lds, stS, I, ldi, bc) :
+        rocsolver_dunpack_interleaved_batched(handle, m, n, I, ldi, S, lds, stS, bc);
+}
+
+inline rocblas_status rocsolver_pack_unpack_interleaved(bool PACK, rocblas_handle handle, rocblas_int m, rocblas_int n,
+                        rocblas_float_complex *S, rocblas_int lds, rocblas_stride stS, rocblas_float_complex *I, rocblas_int ldi, rocblas_int bc)
+{
+    return PACK ?
+        rocsolver_cpack_interleaved_batched(handle, m, n, S, lds, stS, I, ldi, bc) :
+        rocsolver_cunpack_interleaved_batched(handle, m, n, I, ldi, S, lds, stS, bc);
+}
+
+inline rocblas_status rocsolver_pack_unpack_interleaved(bool PACK, rocblas_handle handle, rocblas_int m, rocblas_int n,
+                        rocblas_double_complex *S, rocblas_int lds, rocblas_stride stS, rocblas_double_complex *I, rocblas_int ldi, rocblas_int bc)
+{
+    return PACK ?
+        rocsolver_zpack_interleaved_batched(handle, m, n, S, lds, stS, I, ldi, bc) :
+        rocsolver_zunpack_interleaved_batched(handle, m, n, I, ldi, S, lds, stS, bc);
+}
+/********************************************************/
+
+
+/******************** GETRF_INTERLEAVED ********************/
+inline rocblas_status rocsolver_getrf_interleaved(rocblas_handle handle, rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_sgetrf_interleaved_batched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(rocblas_handle handle, rocblas_int m, rocblas_int n, double *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dgetrf_interleaved_batched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_float_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cgetrf_interleaved_batched(handle, m, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_double_complex *A,
+                        rocblas_int lda, rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zgetrf_interleaved_batched(handle, m, n, A, lda, ipiv, info, bc);
+}
+/********************************************************/
+
+
+/******************** GETRS_INTERLEAVED ********************/
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs,
+                        float *A, rocblas_int lda, const rocblas_int *ipiv, float *B, rocblas_int ldb, rocblas_int bc)
+{
+    return rocsolver_sgetrs_interleaved_batched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs,
+                        double *A, rocblas_int lda, const rocblas_int *ipiv, double *B, rocblas_int ldb, rocblas_int bc)
+{
+    return rocsolver_dgetrs_interleaved_batched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs,
+                        rocblas_float_complex *A, rocblas_int lda, const rocblas_int *ipiv, rocblas_float_complex *B, rocblas_int ldb, rocblas_int bc)
+{
+    return rocsolver_cgetrs_interleaved_batched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs,
+                        rocblas_double_complex *A, rocblas_int lda, const rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb, rocblas_int bc)
+{
+    return rocsolver_zgetrs_interleaved_batched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, bc);
+}
+/********************************************************/
+
+
+/******************** GETRI_INTERLEAVED ********************/
+inline rocblas_status rocsolver_getri_interleaved(rocblas_handle handle, rocblas_int n, float *A, rocblas_int lda,
+                        rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_sgetri_interleaved_batched(handle, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_interleaved(rocblas_handle handle, rocblas_int n, double *A, rocblas_int lda,
+                        rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dgetri_interleaved_batched(handle, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_interleaved(rocblas_handle handle, rocblas_int n, rocblas_float_complex *A, rocblas_int lda,
+                        rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cgetri_interleaved_batched(handle, n, A, lda, ipiv, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_interleaved(rocblas_handle handle, rocblas_int n, rocblas_double_complex *A, rocblas_int lda,
+                        rocblas_int *ipiv, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zgetri_interleaved_batched(handle, n, A, lda, ipiv, info, bc);
+}
+/********************************************************/
+
+
+/******************** POTRF_INTERLEAVED ********************/
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *A,
+                        rocblas_int lda, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_spotrf_interleaved_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *A,
+                        rocblas_int lda, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_dpotrf_interleaved_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_float_complex *A,
+                        rocblas_int lda, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_cpotrf_interleaved_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_double_complex *A,
+                        rocblas_int lda, rocblas_int *info, rocblas_int bc)
+{
+    return rocsolver_zpotrf_interleaved_batched(handle, uplo, n, A, lda, info, bc);
+}
+/********************************************************/
+
+
 #endif /* ROCSOLVER_HPP */
@@ -0,0 +1,620 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver.hpp"
+#include "cblas_interface.h"
+#include "clientcommon.hpp"
+
+
+// non-singular matrices with the rows shuffled to test pivoting
+template <typename T, typename Th>
+void factor_cache_initMatrix(const rocblas_int n, const rocblas_int lda, Th &hA)
+{
+    T tmp;
+    rocblas_init<T>(hA, true);
+
+    // scale A to avoid singularities
+    for (rocblas_int i = 0; i < n; i++) {
+        for (rocblas_int j = 0; j < n; j++) {
+            if (i == j)
+                hA[0][i + j * lda] += 400;
+            else
+                hA[0][i + j * lda] -= 4;
+        }
+    }
+
+    // shuffle rows to test pivoting
+    // always the same permuation for debugging purposes
+    for (rocblas_int i = 0; i < n/2; i++) {
+        for (rocblas_int j = 0; j < n; j++) {
+            tmp = hA[0][i+j*lda];
+            hA[0][i+j*lda] = hA[0][n-1-i+j*lda];
+            hA[0][n-1-i+j*lda] = tmp;
+        }
+    }
+}
+
+
+/******************** GETRF_CACHE ********************/
+
+template <typename T, typename U>
+void getrf_cache_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         T dCache,
+                         U dinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(nullptr,n,dA,lda,dIpiv,dCache,dinfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle,n,(T)nullptr,lda,dIpiv,dCache,dinfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle,n,dA,lda,(U)nullptr,dCache,dinfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle,n,dA,lda,dIpiv,(T)nullptr,dinfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle,n,dA,lda,dIpiv,dCache,(U)nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle,0,(T)nullptr,lda,(U)nullptr,(T)nullptr,dinfo),
+                          rocblas_status_success);
+
+    // size of the cache
+    size_t size;
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_factor_cache_size(nullptr, n, &size), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_factor_cache_size(handle, -1, &size), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_factor_cache_size(handle, n, nullptr), rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_factor_cache_size(handle, 0, &size));
+    EXPECT_EQ(size, 0);
+    // (the diagonal blocks of L and U, ROCBLAS_TRSM_BLOCK = 128 columns wide)
+    CHECK_ROCBLAS_ERROR(rocsolver_get_factor_cache_size(handle, 300, &size));
+    EXPECT_EQ(size, 2*128*300);
+}
+
+
+template <typename T>
+void testing_getrf_cache_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<T> dCache(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dCache.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // check bad arguments
+    getrf_cache_checkBadArgs(handle,n,dA.data(),lda,dIpiv.data(),dCache.data(),dinfo.data());
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_cache_getError(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dCache,
+                        Ud &dinfo,
+                        Th &hA,
+                        Th &hARes,
+                        Uh &hIpiv,
+                        Uh &hIpivRes,
+                        Uh &hinfo,
+                        Uh &hinfoRes,
+                        double *max_err)
+{
+    // input data initialization
+    factor_cache_initMatrix<T>(n, lda, hA);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_cache(handle, n, dA.data(), lda, dIpiv.data(), dCache.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // CPU lapack
+    cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], hinfo[0]);
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    // (the cache is checked by the tests of getrs_cache)
+    double err;
+    *max_err = norm_error('F',n,n,lda,hA[0],hARes[0]);
+
+    // also check pivoting and info (count the number of incorrect values)
+    err = 0;
+    for (rocblas_int i = 0; i < n; ++i)
+        if (hIpiv[0][i] != hIpivRes[0][i]) err++;
+    if (hinfo[0][0] != hinfoRes[0][0]) err++;
+    *max_err = err > *max_err ? err : *max_err;
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_cache_getPerfData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dCache,
+                        Ud &dinfo,
+                        Th &hA,
+                        Th &hARes,
+                        Uh &hIpiv,
+                        Uh &hinfo,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    factor_cache_initMatrix<T>(n, lda, hA);
+
+    if (!perf)
+    {
+        for (size_t k = 0; k < size_t(lda) * n; ++k)
+            hARes[0][k] = hA[0][k];
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        cblas_getrf<T>(n, n, hARes[0], lda, hIpiv[0], hinfo[0]);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_cache(handle, n, dA.data(), lda, dIpiv.data(), dCache.data(), dinfo.data()));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        start = get_time_us();
+        rocsolver_getrf_cache(handle, n, dA.data(), lda, dIpiv.data(), dCache.data(), dinfo.data());
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrf_cache(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle, n, (T*)nullptr, lda, (rocblas_int*)nullptr, (T*)nullptr, (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    size_t size_C;
+    CHECK_ROCBLAS_ERROR(rocsolver_get_factor_cache_size(handle, n, &size_C));
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,1);
+    host_strided_batch_vector<T> hARes(size_A,1,size_A,1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,1);
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_P,1,size_P,1);
+    host_strided_batch_vector<rocblas_int> hinfo(1,1,1,1);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1,1,1,1);
+    device_strided_batch_vector<T> dA(size_A,1,size_A,1);
+    device_strided_batch_vector<T> dCache(size_C,1,size_C,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P,1,size_P,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_C) CHECK_HIP_ERROR(dCache.memcheck());
+    if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // check quick return
+    if (n == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_cache(handle, n, dA.data(), lda, dIpiv.data(), dCache.data(), dinfo.data()),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrf_cache_getError<T>(handle, n, dA, lda, dIpiv, dCache, dinfo,
+                                hA, hARes, hIpiv, hIpivRes, hinfo, hinfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrf_cache_getPerfData<T>(handle, n, dA, lda, dIpiv, dCache, dinfo,
+                                   hA, hARes, hIpiv, hinfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("n", "lda");
+            rocsolver_bench_output(n, lda);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** GETRS_CACHE ********************/
+
+template <typename T, typename U>
+void getrs_cache_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_operation trans,
+                         const rocblas_int n,
+                         const rocblas_int nrhs,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         T dCache,
+                         T dB,
+                         const rocblas_int ldb)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(nullptr,trans,n,nrhs,dA,lda,dIpiv,dCache,dB,ldb),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,rocblas_operation(-1),n,nrhs,dA,lda,dIpiv,dCache,dB,ldb),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,n,nrhs,(T)nullptr,lda,dIpiv,dCache,dB,ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,n,nrhs,dA,lda,(U)nullptr,dCache,dB,ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,n,nrhs,dA,lda,dIpiv,(T)nullptr,dB,ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,n,nrhs,dA,lda,dIpiv,dCache,(T)nullptr,ldb),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,0,nrhs,(T)nullptr,lda,(U)nullptr,(T)nullptr,(T)nullptr,ldb),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle,trans,n,0,dA,lda,dIpiv,dCache,(T)nullptr,ldb),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getrs_cache_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<T> dB(1,1,1,1);
+    device_strided_batch_vector<T> dCache(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dCache.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_cache_checkBadArgs(handle,trans,n,nrhs,dA.data(),lda,dIpiv.data(),dCache.data(),dB.data(),ldb);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_cache_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dCache,
+                        Ud &dinfo,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB)
+{
+    if (CPU)
+    {
+        factor_cache_initMatrix<T>(n, lda, hA);
+        rocblas_init<T>(hB, true);
+    }
+
+    if (GPU)
+    {
+        // the factors and the cache are computed on the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_cache(handle, n, dA.data(), lda, dIpiv.data(), dCache.data(), dinfo.data()));
+    }
+
+    if (CPU)
+    {
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        int info;
+        cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], &info);
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_cache_getError(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dCache,
+                        Ud &dinfo,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        Th &hBRes,
+                        double *max_err)
+{
+    // input data initialization
+    getrs_cache_initData<true,true,T>(handle, n, nrhs, dA, lda, dIpiv, dCache, dinfo, dB, ldb,
+                                      hA, hIpiv, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_cache(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dCache.data(), dB.data(), ldb));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    cblas_getrs<T>(trans, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I',n,nrhs,ldb,hB[0],hBRes[0]);
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_cache_getPerfData(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dCache,
+                        Ud &dinfo,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    // the factorization is done once; only the solves are timed
+    getrs_cache_initData<true,true,T>(handle, n, nrhs, dA, lda, dIpiv, dCache, dinfo, dB, ldb,
+                                      hA, hIpiv, hB);
+
+    if (!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        cblas_getrs<T>(trans, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_cache(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dCache.data(), dB.data(), ldb));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+        start = get_time_us();
+        rocsolver_getrs_cache(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dCache.data(), dB.data(), ldb);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrs_cache(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    char transC = argus.transA_option;
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle, trans, n, nrhs, (T*)nullptr, lda, (rocblas_int*)nullptr, (T*)nullptr, (T*)nullptr, ldb),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    size_t size_C;
+    CHECK_ROCBLAS_ERROR(rocsolver_get_factor_cache_size(handle, n, &size_C));
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,1);
+    host_strided_batch_vector<T> hB(size_B,1,size_B,1);
+    host_strided_batch_vector<T> hBRes(size_BRes,1,size_BRes,1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,1);
+    device_strided_batch_vector<T> dA(size_A,1,size_A,1);
+    device_strided_batch_vector<T> dB(size_B,1,size_B,1);
+    device_strided_batch_vector<T> dCache(size_C,1,size_C,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P,1,size_P,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_B) CHECK_HIP_ERROR(dB.memcheck());
+    if (size_C) CHECK_HIP_ERROR(dCache.memcheck());
+    if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // check quick return
+    if (n == 0 || nrhs == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_cache(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dCache.data(), dB.data(), ldb),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrs_cache_getError<T>(handle, trans, n, nrhs, dA, lda, dIpiv, dCache, dinfo, dB, ldb,
+                                hA, hIpiv, hB, hBRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrs_cache_getPerfData<T>(handle, trans, n, nrhs, dA, lda, dIpiv, dCache, dinfo, dB, ldb,
+                                   hA, hIpiv, hB, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
@@ -0,0 +1,438 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver.hpp"
+#include "cblas_interface.h"
+#include "clientcommon.hpp"
+
+
+template <typename T, typename U>
+void gesv_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int n,
+                         const rocblas_int nrhs,
+                         T dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         U dIpiv,
+                         const rocblas_stride stP,
+                         T dB,
+                         const rocblas_int ldb,
+                         const rocblas_stride stB,
+                         U dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(nullptr,n,nrhs,dA,lda,stA,dIpiv,stP,dB,ldb,stB,dInfo,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,dA,lda,stA,dIpiv,stP,dB,ldb,stB,dInfo,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,(T)nullptr,lda,stA,dIpiv,stP,dB,ldb,stB,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,dA,lda,stA,(U)nullptr,stP,dB,ldb,stB,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,dA,lda,stA,dIpiv,stP,(T)nullptr,ldb,stB,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,dA,lda,stA,dIpiv,stP,dB,ldb,stB,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,0,nrhs,(T)nullptr,lda,stA,(U)nullptr,stP,(T)nullptr,ldb,stB,dInfo,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,0,dA,lda,stA,dIpiv,stP,(T)nullptr,ldb,stB,dInfo,bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle,n,nrhs,dA,lda,stA,dIpiv,stP,dB,ldb,stB,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <bool BATCHED, typename T>
+void testing_gesv_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    if (BATCHED) {
+        // memory allocations
+        device_batch_vector<T> dA(1,1,1);
+        device_batch_vector<T> dB(1,1,1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+        device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gesv_checkBadArgs(handle,n,nrhs,dA.data(),lda,stA,dIpiv.data(),stP,dB.data(),ldb,stB,dInfo.data(),bc);
+
+    } else {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1,1,1,1);
+        device_strided_batch_vector<T> dB(1,1,1,1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+        device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gesv_checkBadArgs(handle,n,nrhs,dA.data(),lda,stA,dIpiv.data(),stP,dB.data(),ldb,stB,dInfo.data(),bc);
+    }
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gesv_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Ud &dIpiv,
+                        const rocblas_stride stP,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        const bool singular)
+{
+    if (CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to avoid singularities
+        for (rocblas_int b = 0; b < bc; ++b) {
+            for (rocblas_int i = 0; i < n; i++) {
+                for (rocblas_int j = 0; j < n; j++) {
+                    if (i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+
+        // make the middle instance singular (with a zero column) to test
+        // the values of info and that its right hand sides are not modified
+        if (singular && bc > 1) {
+            for (rocblas_int i = 0; i < n; i++)
+                hA[bc/2][i + (n/2) * lda] = 0;
+        }
+    }
+
+    if (GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gesv_getError(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Ud &dIpiv,
+                        const rocblas_stride stP,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        Th &hBRes,
+                        Uh &hInfo,
+                        Uh &hInfoRes,
+                        double *max_err)
+{
+    // input data initialization
+    gesv_initData<true,true,T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                      hA, hIpiv, hB, true);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesv(handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (as in LAPACK, B is not modified if the matrix is singular)
+    for (rocblas_int b = 0; b < bc; ++b) {
+        cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], hInfo[b]);
+        if (hInfo[b][0] == 0)
+            cblas_getrs<T>(rocblas_operation_none, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        err = norm_error('I',n,nrhs,ldb,hB[b],hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info (count the number of incorrect values)
+        err = 0;
+        if (hInfo[b][0] != hInfoRes[b][0]) err++;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gesv_getPerfData(const rocblas_handle handle,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            Td &dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Ud &dIpiv,
+                            const rocblas_stride stP,
+                            Td &dB,
+                            const rocblas_int ldb,
+                            const rocblas_stride stB,
+                            Ud &dInfo,
+                            const rocblas_int bc,
+                            Th &hA,
+                            Uh &hIpiv,
+                            Th &hB,
+                            Uh &hInfo,
+                            double *gpu_time_used,
+                            double *cpu_time_used,
+                            const rocblas_int hot_calls,
+                            const bool perf)
+{
+    if (!perf)
+    {
+        gesv_initData<true,false,T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                        hA, hIpiv, hB, false);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b) {
+            cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], hInfo[b]);
+            cblas_getrs<T>(rocblas_operation_none, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
+        }
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    gesv_initData<true,false,T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                      hA, hIpiv, hB, false);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesv_initData<false,true,T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                        hA, hIpiv, hB, false);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv(handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesv_initData<false,true,T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                        hA, hIpiv, hB, false);
+
+        start = get_time_us();
+        rocsolver_gesv(handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <bool BATCHED, typename T>
+void testing_gesv(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stP = argus.bsp;
+    rocblas_stride stB = argus.bsb;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if (invalid_size) {
+        if (BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle, n, nrhs, (T *const *)nullptr, lda, stA, (rocblas_int*)nullptr, stP, (T *const *)nullptr, ldb, stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle, n, nrhs, (T *)nullptr, lda, stA, (rocblas_int*)nullptr, stP, (T *)nullptr, ldb, stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    if (BATCHED) {
+        // memory allocations
+        host_batch_vector<T> hA(size_A,1,bc);
+        host_batch_vector<T> hB(size_B,1,bc);
+        host_batch_vector<T> hBRes(size_BRes,1,bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,stP,bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1,1,1,bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1,1,1,bc);
+        device_batch_vector<T> dA(size_A,1,bc);
+        device_batch_vector<T> dB(size_B,1,bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P,1,stP,bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1,1,1,bc);
+        if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+        if (size_B) CHECK_HIP_ERROR(dB.memcheck());
+        if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+        if (bc) CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if (n == 0 || bc == 0) {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if (argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if (argus.unit_check || argus.norm_check)
+            gesv_getError<T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                          hA, hIpiv, hB, hBRes, hInfo, hInfoRes, &max_error);
+
+        // collect performance data
+        if (argus.timing)
+            gesv_getPerfData<T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                              hA, hIpiv, hB, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+    }
+
+    else {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A,1,stA,bc);
+        host_strided_batch_vector<T> hB(size_B,1,stB,bc);
+        host_strided_batch_vector<T> hBRes(size_BRes,1,stBRes,bc);
+        host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,stP,bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1,1,1,bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1,1,1,bc);
+        device_strided_batch_vector<T> dA(size_A,1,stA,bc);
+        device_strided_batch_vector<T> dB(size_B,1,stB,bc);
+        device_strided_batch_vector<rocblas_int> dIpiv(size_P,1,stP,bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1,1,1,bc);
+        if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+        if (size_B) CHECK_HIP_ERROR(dB.memcheck());
+        if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+        if (bc) CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if (n == 0 || bc == 0) {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesv(handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if (argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if (argus.unit_check || argus.norm_check)
+            gesv_getError<T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                          hA, hIpiv, hB, hBRes, hInfo, hInfoRes, &max_error);
+
+        // collect performance data
+        if (argus.timing)
+            gesv_getPerfData<T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, dInfo, bc,
+                                              hA, hIpiv, hB, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            if (BATCHED) {
+                rocsolver_bench_output("n", "nrhs", "lda", "ldb", "strideP", "batch_c");
+                rocsolver_bench_output(n, nrhs, lda, ldb, stP, bc);
+            }
+            else {
+                rocsolver_bench_output("n", "nrhs", "lda", "ldb", "strideA", "strideP", "strideB", "batch_c");
+                rocsolver_bench_output(n, nrhs, lda, ldb, stA, stP, stB, bc);
+            }
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver.hpp"
+#include "cblas_interface.h"
+#include "clientcommon.hpp"
+
+
+template <typename T, typename U>
+void gesv_ir_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int n,
+                         const rocblas_int nrhs,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         T dB,
+                         const rocblas_int ldb,
+                         T dX,
+                         const rocblas_int ldx,
+                         U dIter,
+                         U dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(nullptr,n,nrhs,dA,lda,dIpiv,dB,ldb,dX,ldx,dIter,dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,dIpiv,dB,ldb,dX,n-1,dIter,dInfo),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,(T)nullptr,lda,dIpiv,dB,ldb,dX,ldx,dIter,dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,(U)nullptr,dB,ldb,dX,ldx,dIter,dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,dIpiv,(T)nullptr,ldb,dX,ldx,dIter,dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,dIpiv,dB,ldb,(T)nullptr,ldx,dIter,dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,dIpiv,dB,ldb,dX,ldx,(U)nullptr,dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,nrhs,dA,lda,dIpiv,dB,ldb,dX,ldx,dIter,(U)nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,0,nrhs,(T)nullptr,lda,(U)nullptr,(T)nullptr,ldb,(T)nullptr,ldx,dIter,dInfo),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle,n,0,dA,lda,dIpiv,(T)nullptr,ldb,(T)nullptr,ldx,dIter,dInfo),
+                          rocblas_status_success);
+
+    // maximum number of iterations of the refinement
+    rocblas_int max_iter;
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_refinement_iterations(nullptr,1), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_refinement_iterations(handle,-1), rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_refinement_iterations(handle,nullptr), rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_refinement_iterations(handle,&max_iter));
+    EXPECT_EQ(max_iter, 30);
+}
+
+
+template <typename T>
+void testing_gesv_ir_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldx = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<T> dB(1,1,1,1);
+    device_strided_batch_vector<T> dX(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIter(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dIter.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    gesv_ir_checkBadArgs(handle,n,nrhs,dA.data(),lda,dIpiv.data(),dB.data(),ldb,dX.data(),ldx,dIter.data(),dInfo.data());
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesv_ir_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        Th &hA,
+                        Th &hB,
+                        const bool singular)
+{
+    if (CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to avoid singularities
+        for (rocblas_int i = 0; i < n; i++) {
+            for (rocblas_int j = 0; j < n; j++) {
+                if (i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // or make it singular with a zero column
+        if (singular) {
+            for (rocblas_int i = 0; i < n; i++)
+                hA[0][i + (n/2) * lda] = 0;
+        }
+    }
+
+    if (GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gesv_ir_getError(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        Td &dX,
+                        const rocblas_int ldx,
+                        Ud &dIter,
+                        Ud &dInfo,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        Th &hX,
+                        Th &hXRes,
+                        Uh &hIter,
+                        Uh &hInfo,
+                        Uh &hInfoRes,
+                        double *max_err)
+{
+    double err;
+    *max_err = 0;
+
+    // the system is solved with a non-singular matrix, for which the refinement
+    // must converge, and with a singular matrix, for which X is not computed
+    for (bool singular : {false, true}) {
+        // input data initialization
+        gesv_ir_initData<true,true,T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB, singular);
+
+        // execute computations
+        // GPU lapack
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_ir(handle, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb,
+                                              dX.data(), ldx, dIter.data(), dInfo.data()));
+        CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+        CHECK_HIP_ERROR(hIter.transfer_from(dIter));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+        // CPU lapack
+        // (the solution has the accuracy of the precision of A)
+        for (rocblas_int j = 0; j < nrhs; j++)
+            for (rocblas_int i = 0; i < n; i++)
+                hX[0][i + j * ldx] = hB[0][i + j * ldb];
+        cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], hInfo[0]);
+
+        // also check info and iter (count the number of incorrect values)
+        err = 0;
+        if (hInfo[0][0] != hInfoRes[0][0]) err++;
+        if (singular ? hIter[0][0] != -3 : hIter[0][0] < 0) err++;
+        *max_err = err > *max_err ? err : *max_err;
+
+        // error is ||hX - hXRes|| / ||hX||
+        // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+        // IT MIGHT BE REVISITED IN THE FUTURE)
+        // using vector-induced infinity norm
+        if (hInfo[0][0] == 0) {
+            cblas_getrs<T>(rocblas_operation_none, n, nrhs, hA[0], lda, hIpiv[0], hX[0], ldx);
+            err = norm_error('I',n,nrhs,ldx,hX[0],hXRes[0]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gesv_ir_getPerfData(const rocblas_handle handle,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            Td &dA,
+                            const rocblas_int lda,
+                            Ud &dIpiv,
+                            Td &dB,
+                            const rocblas_int ldb,
+                            Td &dX,
+                            const rocblas_int ldx,
+                            Ud &dIter,
+                            Ud &dInfo,
+                            Th &hA,
+                            Uh &hIpiv,
+                            Th &hB,
+                            Uh &hInfo,
+                            double *gpu_time_used,
+                            double *cpu_time_used,
+                            const rocblas_int hot_calls,
+                            const bool perf)
+{
+    if (!perf)
+    {
+        gesv_ir_initData<true,false,T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB, false);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the reference is the solver in the precision of A)
+        *cpu_time_used = get_time_us();
+        cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], hInfo[0]);
+        cblas_getrs<T>(rocblas_operation_none, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    gesv_ir_initData<true,false,T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB, false);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesv_ir_initData<false,true,T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB, false);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_ir(handle, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb,
+                                              dX.data(), ldx, dIter.data(), dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesv_ir_initData<false,true,T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB, false);
+
+        start = get_time_us();
+        rocsolver_gesv_ir(handle, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb,
+                          dX.data(), ldx, dIter.data(), dInfo.data());
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_gesv_ir(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldx = argus.ldc;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_X = size_t(ldx) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle, n, nrhs, (T *)nullptr, lda, (rocblas_int*)nullptr, (T *)nullptr, ldb,
+                                                (T *)nullptr, ldx, (rocblas_int*)nullptr, (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,1);
+    host_strided_batch_vector<T> hB(size_B,1,size_B,1);
+    host_strided_batch_vector<T> hX(size_XRes,1,size_XRes,1);
+    host_strided_batch_vector<T> hXRes(size_XRes,1,size_XRes,1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,1);
+    host_strided_batch_vector<rocblas_int> hIter(1,1,1,1);
+    host_strided_batch_vector<rocblas_int> hInfo(1,1,1,1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1,1,1,1);
+    device_strided_batch_vector<T> dA(size_A,1,size_A,1);
+    device_strided_batch_vector<T> dB(size_B,1,size_B,1);
+    device_strided_batch_vector<T> dX(size_X,1,size_X,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P,1,size_P,1);
+    device_strided_batch_vector<rocblas_int> dIter(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_B) CHECK_HIP_ERROR(dB.memcheck());
+    if (size_X) CHECK_HIP_ERROR(dX.memcheck());
+    if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dIter.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if (n == 0 || nrhs == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesv_ir(handle, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb,
+                                                dX.data(), ldx, dIter.data(), dInfo.data()),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        gesv_ir_getError<T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, dInfo,
+                                      hA, hIpiv, hB, hX, hXRes, hIter, hInfo, hInfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        gesv_ir_getPerfData<T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, dInfo,
+                                          hA, hIpiv, hB, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("n", "nrhs", "lda", "ldb", "ldx");
+            rocsolver_bench_output(n, nrhs, lda, ldb, ldx);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -423,3 +423,543 @@ void testing_getf2_getrf(Arguments argus)
         }
     }
 }
+
+
+// the variants of getrf selected with options of the handle, and the
+// out-of-core getrf (matrix on the host), give the factorization of GETRF
+typedef enum getrf_variant_ {
+    getrf_lookahead,    // rocsolver_set_lookahead
+    getrf_tournament,   // rocsolver_set_pivot_strategy (the pivots may differ)
+    getrf_hybrid,       // rocsolver_set_hybrid_getrf
+    getrf_ooc           // rocsolver_getrf_ooc
+} getrf_variant;
+
+// number of configurations of the handle that are tested for each variant
+inline int getrf_variant_configs(const getrf_variant variant)
+{
+    return (variant == getrf_hybrid) ? 2 : (variant == getrf_ooc) ? 3 : 1;
+}
+
+// sets the configuration k of the handle:
+// 4 and 1 host threads for the hybrid getrf, and for the out-of-core getrf
+// no budget (whole matrix on the device), then budgets of 2 and 1 times the
+// size of the matrix (slabs of a few columns)
+inline void getrf_variant_setup(const rocblas_handle handle, const getrf_variant variant, const int k, const size_t size_A)
+{
+    if (variant == getrf_lookahead)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, rocsolver_lookahead_enabled));
+    else if (variant == getrf_tournament)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_pivot_strategy(handle, rocsolver_pivot_tournament));
+    else if (variant == getrf_hybrid)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_hybrid_getrf(handle, k == 0 ? 4 : 1));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_set_memory_budget(handle, k == 0 ? 0 : size_A * (3 - k), 1));
+}
+
+
+inline void getrf_options_checkBadArgs(const rocblas_handle handle)
+{
+    rocsolver_lookahead_mode mode;
+    rocsolver_pivot_strategy strategy;
+    rocblas_int nthreads;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_lookahead(nullptr, rocsolver_lookahead_enabled), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_pivot_strategy(nullptr, rocsolver_pivot_partial), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_hybrid_getrf(nullptr, 1), rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_lookahead(handle, rocsolver_lookahead_mode(-1)), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_pivot_strategy(handle, rocsolver_pivot_strategy(-1)), rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_hybrid_getrf(handle, -1), rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_lookahead(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_pivot_strategy(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_hybrid_getrf(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // default values (the variants are off)
+    CHECK_ROCBLAS_ERROR(rocsolver_get_lookahead(handle, &mode));
+    EXPECT_EQ(mode, rocsolver_lookahead_disabled);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_pivot_strategy(handle, &strategy));
+    EXPECT_EQ(strategy, rocsolver_pivot_partial);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_hybrid_getrf(handle, &nthreads));
+    EXPECT_EQ(nthreads, 0);
+
+    // values set
+    CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, rocsolver_lookahead_enabled));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_lookahead(handle, &mode));
+    EXPECT_EQ(mode, rocsolver_lookahead_enabled);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_pivot_strategy(handle, rocsolver_pivot_tournament));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_pivot_strategy(handle, &strategy));
+    EXPECT_EQ(strategy, rocsolver_pivot_tournament);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_hybrid_getrf(handle, 4));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_hybrid_getrf(handle, &nthreads));
+    EXPECT_EQ(nthreads, 4);
+}
+
+
+template <typename T>
+void getrf_ooc_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T *hA,
+                         const rocblas_int lda,
+                         rocblas_int *hIpiv,
+                         rocblas_int *hinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(nullptr,m,n,hA,lda,hIpiv,hinfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,m,n,(T*)nullptr,lda,hIpiv,hinfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,m,n,hA,lda,(rocblas_int*)nullptr,hinfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,m,n,hA,lda,hIpiv,(rocblas_int*)nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,0,n,(T*)nullptr,lda,(rocblas_int*)nullptr,hinfo),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,m,0,(T*)nullptr,lda,(rocblas_int*)nullptr,hinfo),
+                          rocblas_status_success);
+
+    // capture mode is not supported
+    CHECK_ROCBLAS_ERROR(rocsolver_set_capture_mode(handle, rocsolver_capture_enabled));
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle,m,n,hA,lda,hIpiv,hinfo),
+                          rocblas_status_not_implemented);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_capture_mode(handle, rocsolver_capture_disabled));
+}
+
+
+template <typename T>
+void testing_getrf_variant_bad_arg(const getrf_variant variant)
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    if (variant == getrf_ooc) {
+        // memory allocations (on the host)
+        host_strided_batch_vector<T> hA(1,1,1,1);
+        host_strided_batch_vector<rocblas_int> hIpiv(1,1,1,1);
+        host_strided_batch_vector<rocblas_int> hinfo(1,1,1,1);
+
+        // check bad arguments
+        getrf_ooc_checkBadArgs(handle,m,n,hA[0],lda,hIpiv[0],hinfo[0]);
+    }
+
+    else {
+        // check bad arguments
+        getrf_options_checkBadArgs(handle);
+    }
+}
+
+
+template <typename T, typename Th>
+void getrf_variant_initData(const getrf_variant variant,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int lda,
+                        Th &hA)
+{
+    T tmp;
+    rocblas_init<T>(hA, true);
+
+    // with tournament pivoting, a general matrix (the pivots are not those
+    // of partial pivoting)
+    if (variant == getrf_tournament)
+        return;
+
+    // scale A to avoid singularities
+    for (rocblas_int i = 0; i < m; i++) {
+        for (rocblas_int j = 0; j < n; j++) {
+            if (i == j)
+                hA[0][i + j * lda] += 400;
+            else
+                hA[0][i + j * lda] -= 4;
+        }
+    }
+
+    // shuffle rows to test pivoting
+    // always the same permuation for debugging purposes
+    for (rocblas_int i = 0; i < m/2; i++) {
+        for (rocblas_int j = 0; j < n; j++) {
+            tmp = hA[0][i+j*lda];
+            hA[0][i+j*lda] = hA[0][m-1-i+j*lda];
+            hA[0][m-1-i+j*lda] = tmp;
+        }
+    }
+}
+
+
+// factorizes hA into hARes with the variant
+// (the handle must be configured already)
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+rocblas_status getrf_variant_run(const rocblas_handle handle,
+                        const getrf_variant variant,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dinfo,
+                        Th &hA,
+                        Th &hARes,
+                        Uh &hIpivRes,
+                        Uh &hinfoRes)
+{
+    rocblas_status status;
+
+    if (variant == getrf_ooc) {
+        for (size_t k = 0; k < size_t(lda) * n; ++k)
+            hARes[0][k] = hA[0][k];
+        status = rocsolver_getrf_ooc(handle, m, n, hARes[0], lda, hIpivRes[0], hinfoRes[0]);
+    }
+
+    else {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        status = rocsolver_getf2_getrf(false, true, handle, m, n, dA.data(), lda, 0, dIpiv.data(), 0, dinfo.data(), 1);
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+        CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    }
+
+    return status;
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_variant_getError(const rocblas_handle handle,
+                        const getrf_variant variant,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dinfo,
+                        Th &hA,
+                        Th &hARef,
+                        Th &hARes,
+                        Uh &hIpivRef,
+                        Uh &hIpivRes,
+                        Uh &hinfoRef,
+                        Uh &hinfoRes,
+                        double *max_err)
+{
+    size_t size_A = size_t(lda) * n;
+    rocblas_int dim = min(m,n);
+
+    // input data initialization
+    getrf_variant_initData<T>(variant, m, n, lda, hA);
+
+    // CPU lapack
+    for (size_t k = 0; k < size_A; ++k)
+        hARef[0][k] = hA[0][k];
+    cblas_getrf<T>(m, n, hARef[0], lda, hIpivRef[0], hinfoRef[0]);
+
+    double err;
+    *max_err = 0;
+    for (int c = 0; c < getrf_variant_configs(variant); ++c) {
+        // execute computations
+        // GPU lapack
+        getrf_variant_setup(handle, variant, c, sizeof(T) * size_A);
+        CHECK_ROCBLAS_ERROR(getrf_variant_run<T>(handle, variant, m, n, dA, lda, dIpiv, dinfo,
+                                                 hA, hARes, hIpivRes, hinfoRes));
+
+        // check info (count the number of incorrect values)
+        err = (hinfoRes[0][0] != hinfoRef[0][0]) ? 1 : 0;
+        *max_err = err > *max_err ? err : *max_err;
+
+        if (variant == getrf_tournament) {
+            // the pivots may differ from those of partial pivoting:
+            // error is ||PA - LU|| / ||PA||
+            // using frobenius norm
+            for (size_t k = 0; k < size_A; ++k)
+                hARef[0][k] = hA[0][k];
+            err = 0;
+            for (rocblas_int k = 0; k < dim; ++k) {
+                rocblas_int p = hIpivRes[0][k] - 1;
+                if (p < k || p >= m) {
+                    err++;
+                    continue;
+                }
+                for (rocblas_int j = 0; j < n; ++j) {
+                    T tmp = hARef[0][k + j*lda];
+                    hARef[0][k + j*lda] = hARef[0][p + j*lda];
+                    hARef[0][p + j*lda] = tmp;
+                }
+            }
+            *max_err = err > *max_err ? err : *max_err;
+
+            std::vector<T> hLU(size_A);
+            for (rocblas_int j = 0; j < n; ++j) {
+                for (rocblas_int i = 0; i < m; ++i) {
+                    T lu = T(0);
+                    for (rocblas_int k = 0; k <= min(i,j) && k < dim; ++k)
+                        lu += (i == k ? T(1) : hARes[0][i + k*lda]) * hARes[0][k + j*lda];
+                    hLU[i + j*lda] = lu;
+                }
+            }
+            err = norm_error('F',m,n,lda,hARef[0],hLU.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+
+        else {
+            // expecting original matrix to be non-singular
+            // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+            // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+            // IT MIGHT BE REVISITED IN THE FUTURE)
+            // using frobenius norm
+            err = norm_error('F',m,n,lda,hARef[0],hARes[0]);
+            *max_err = err > *max_err ? err : *max_err;
+
+            // also check pivoting (count the number of incorrect pivots)
+            err = 0;
+            for (rocblas_int i = 0; i < dim; ++i)
+                if (hIpivRef[0][i] != hIpivRes[0][i]) err++;
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_variant_getPerfData(const rocblas_handle handle,
+                        const getrf_variant variant,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dinfo,
+                        Th &hA,
+                        Th &hARes,
+                        Uh &hIpivRes,
+                        Uh &hinfoRes,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    getrf_variant_initData<T>(variant, m, n, lda, hA);
+
+    if (!perf)
+    {
+        for (size_t k = 0; k < size_t(lda) * n; ++k)
+            hARes[0][k] = hA[0][k];
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        cblas_getrf<T>(m, n, hARes[0], lda, hIpivRes[0], hinfoRes[0]);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // the first configuration of the variant is timed
+    // (including the transfers of the data for the out-of-core getrf)
+    getrf_variant_setup(handle, variant, 0, sizeof(T) * lda * n);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+        CHECK_ROCBLAS_ERROR(getrf_variant_run<T>(handle, variant, m, n, dA, lda, dIpiv, dinfo,
+                                                 hA, hARes, hIpivRes, hinfoRes));
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        if (variant == getrf_ooc) {
+            for (size_t k = 0; k < size_t(lda) * n; ++k)
+                hARes[0][k] = hA[0][k];
+
+            start = get_time_us();
+            rocsolver_getrf_ooc(handle, m, n, hARes[0], lda, hIpivRes[0], hinfoRes[0]);
+            *gpu_time_used += get_time_us() - start;
+        }
+        else {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+            start = get_time_us();
+            rocsolver_getf2_getrf(false, true, handle, m, n, dA.data(), lda, 0, dIpiv.data(), 0, dinfo.data(), 1);
+            *gpu_time_used += get_time_us() - start;
+        }
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrf_variant(Arguments argus, const getrf_variant variant)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (the device arrays are not used by the out-of-core getrf)
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m,n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARef = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRef = (argus.unit_check || argus.norm_check) ? size_P : 0;
+    size_t size_dA = (variant == getrf_ooc) ? 0 : size_A;
+    size_t size_dP = (variant == getrf_ooc) ? 0 : size_P;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m);
+    if (invalid_size) {
+        rocblas_int info;
+        if (variant == getrf_ooc)
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, n, (T*)nullptr, lda, (rocblas_int*)nullptr, &info),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_getf2_getrf(false, true, handle, m, n, (T*)nullptr, lda, 0, (rocblas_int*)nullptr, 0, (rocblas_int*)nullptr, 1),
+                                  rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,1);
+    host_strided_batch_vector<T> hARes(size_A,1,size_A,1);
+    host_strided_batch_vector<T> hARef(size_ARef,1,size_ARef,1);
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_P,1,size_P,1);
+    host_strided_batch_vector<rocblas_int> hIpivRef(size_PRef,1,size_PRef,1);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1,1,1,1);
+    host_strided_batch_vector<rocblas_int> hinfoRef(1,1,1,1);
+    device_strided_batch_vector<T> dA(size_dA,1,size_dA,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_dP,1,size_dP,1);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,1);
+    if (size_dA) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_dP) CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // check quick return
+    if (m == 0 || n == 0) {
+        hinfoRes[0][0] = -1;
+        getrf_variant_setup(handle, variant, 0, 0);
+        EXPECT_ROCBLAS_STATUS(getrf_variant_run<T>(handle, variant, m, n, dA, lda, dIpiv, dinfo,
+                                                   hA, hARes, hIpivRes, hinfoRes),
+                              rocblas_status_success);
+        if (variant == getrf_ooc)
+            EXPECT_EQ(hinfoRes[0][0], 0);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrf_variant_getError<T>(handle, variant, m, n, dA, lda, dIpiv, dinfo,
+                                  hA, hARef, hARes, hIpivRef, hIpivRes, hinfoRef, hinfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrf_variant_getPerfData<T>(handle, variant, m, n, dA, lda, dIpiv, dinfo,
+                                     hA, hARes, hIpivRes, hinfoRes, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    // (the panels are tall, and the updates are applied in a different order)
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,m);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("m", "n", "lda");
+            rocsolver_bench_output(m, n, lda);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+
+
+// getf2 with an all-NaN first column: there is no pivot candidate in any column
+// (the trailing matrix becomes NaN), so the rows must stay in place, and the 
+// rows of A below m (the padding up to lda) must not be touched
+template <bool STRIDED, typename T>
+void testing_getf2_nan(const rocblas_int m, const rocblas_int n)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_local_handle handle;
+    rocblas_int lda = m + 2;
+    rocblas_int bc = STRIDED ? 3 : 1;
+    rocblas_stride stA = lda * n;
+    rocblas_stride stP = min(m, n);
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(stA,1,stA,bc);
+    host_strided_batch_vector<T> hARes(stA,1,stA,bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP,1,stP,bc);
+    device_strided_batch_vector<T> dA(stA,1,stA,bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP,1,stP,bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1,1,1,bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // input data initialization
+    rocblas_init<T>(hA, true);
+    for (rocblas_int b = 0; b < bc; ++b) {
+        for (rocblas_int i = 0; i < m; ++i)
+            hA[b][i] = T(std::numeric_limits<S>::quiet_NaN());
+    }
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // execute computations
+    CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, false, handle, m, n, dA.data(), lda, stA,
+                                              dIpiv.data(), stP, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+
+    for (rocblas_int b = 0; b < bc; ++b) {
+        for (rocblas_int i = 0; i < stP; ++i)
+            EXPECT_EQ(hIpiv[b][i], i + 1) << "instance " << b << ", pivot " << i;
+        for (rocblas_int j = 0; j < n; ++j) {
+            for (rocblas_int i = m; i < lda; ++i)
+                EXPECT_TRUE(hARes[b][i + j*lda] == hA[b][i + j*lda]) << "instance " << b << ", row " << i << ", column " << j;
+        }
+    }
+}
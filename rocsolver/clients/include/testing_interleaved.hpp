@@ -0,0 +1,1477 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver.hpp"
+#include "cblas_interface.h"
+#include "clientcommon.hpp"
+
+
+// In the interleaved layout, the entry (i,j) of instance b is stored in
+// I[b + (i + j*ldi)*bc]. The reference results are computed with the strided
+// layout on the host; these helpers convert from and to the interleaved layout.
+template <typename T>
+void interleaved_pack_host(const rocblas_int m, const rocblas_int n, const rocblas_int bc,
+                           host_strided_batch_vector<T> &hS, const rocblas_int lds,
+                           T *hI, const rocblas_int ldi)
+{
+    for (rocblas_int b = 0; b < bc; ++b)
+        for (rocblas_int j = 0; j < n; j++)
+            for (rocblas_int i = 0; i < m; i++)
+                hI[b + (i + size_t(j)*ldi)*bc] = hS[b][i + size_t(j)*lds];
+}
+
+template <typename T>
+void interleaved_unpack_host(const rocblas_int m, const rocblas_int n, const rocblas_int bc,
+                             const T *hI, const rocblas_int ldi,
+                             host_strided_batch_vector<T> &hS, const rocblas_int lds)
+{
+    for (rocblas_int b = 0; b < bc; ++b)
+        for (rocblas_int j = 0; j < n; j++)
+            for (rocblas_int i = 0; i < m; i++)
+                hS[b][i + size_t(j)*lds] = hI[b + (i + size_t(j)*ldi)*bc];
+}
+
+// diagonally dominant matrices
+template <typename T>
+void interleaved_init_matrix(const rocblas_int m, const rocblas_int n, const rocblas_int bc,
+                             host_strided_batch_vector<T> &hA, const rocblas_int lda)
+{
+    rocblas_init<T>(hA, true);
+    for (rocblas_int b = 0; b < bc; ++b) {
+        for (rocblas_int i = 0; i < m; i++) {
+            for (rocblas_int j = 0; j < n; j++) {
+                if (i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+}
+
+inline void interleaved_bench_results(const Arguments &argus, double cpu_time_used, double gpu_time_used, double max_error)
+{
+    rocblas_cout << "\n============================================\n";
+    rocblas_cout << "Results:\n";
+    rocblas_cout << "============================================\n";
+    if (argus.norm_check) {
+        rocsolver_bench_output("cpu_time", "gpu_time", "error");
+        rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+    }
+    else {
+        rocsolver_bench_output("cpu_time", "gpu_time");
+        rocsolver_bench_output(cpu_time_used, gpu_time_used);
+    }
+    rocblas_cout << std::endl;
+}
+
+
+/******************** PACK_UNPACK_INTERLEAVED ********************/
+
+template <bool PACK, typename T>
+void pack_unpack_interleaved_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T dS,
+                         const rocblas_int lds,
+                         const rocblas_stride stS,
+                         T dI,
+                         const rocblas_int ldi,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,nullptr,m,n,dS,lds,stS,dI,ldi,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,m,n,dS,lds,stS,dI,ldi,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,m,n,(T)nullptr,lds,stS,dI,ldi,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,m,n,dS,lds,stS,(T)nullptr,ldi,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,0,n,(T)nullptr,lds,stS,(T)nullptr,ldi,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,m,0,(T)nullptr,lds,stS,(T)nullptr,ldi,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK,handle,m,n,(T)nullptr,lds,stS,(T)nullptr,ldi,0),
+                          rocblas_status_success);
+}
+
+
+template <bool PACK, typename T>
+void testing_pack_unpack_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lds = 1;
+    rocblas_int ldi = 1;
+    rocblas_stride stS = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dS(1,1,1,1);
+    device_strided_batch_vector<T> dI(1,1,1,1);
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dI.memcheck());
+
+    // check bad arguments
+    pack_unpack_interleaved_checkBadArgs<PACK>(handle,m,n,dS.data(),lds,stS,dI.data(),ldi,bc);
+}
+
+
+template <bool PACK, typename T, typename Td, typename Th>
+void pack_unpack_interleaved_getError(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dS,
+                        const rocblas_int lds,
+                        const rocblas_stride stS,
+                        Td &dI,
+                        const rocblas_int ldi,
+                        const rocblas_int bc,
+                        Th &hS,
+                        Th &hSRes,
+                        Th &hI,
+                        Th &hIRes,
+                        double *max_err)
+{
+    // input data initialization
+    // (the entries out of the matrices must not be modified, so the results
+    // are initialized with other values than the expected ones)
+    rocblas_init<T>(hS, true);
+    rocblas_init<T>(hSRes, true);
+    rocblas_init<T>(hIRes, true);
+    for (size_t k = 0; k < size_t(ldi) * n * bc; ++k)
+        hI[0][k] = hIRes[0][k];
+    interleaved_pack_host(m, n, bc, hS, lds, hI[0], ldi);
+
+    // execute computations
+    // GPU lapack
+    if (PACK) {
+        CHECK_HIP_ERROR(dS.transfer_from(hS));
+        CHECK_HIP_ERROR(dI.transfer_from(hIRes));
+        CHECK_ROCBLAS_ERROR(rocsolver_pack_unpack_interleaved(PACK, handle, m, n, dS.data(), lds, stS, dI.data(), ldi, bc));
+        CHECK_HIP_ERROR(hIRes.transfer_from(dI));
+    }
+    else {
+        CHECK_HIP_ERROR(dI.transfer_from(hI));
+        CHECK_HIP_ERROR(dS.transfer_from(hSRes));
+        CHECK_ROCBLAS_ERROR(rocsolver_pack_unpack_interleaved(PACK, handle, m, n, dS.data(), lds, stS, dI.data(), ldi, bc));
+        CHECK_HIP_ERROR(hSRes.transfer_from(dS));
+    }
+
+    // the copies must be exact (count the number of incorrect values)
+    double err = 0;
+    if (PACK) {
+        for (size_t k = 0; k < size_t(ldi) * n * bc; ++k)
+            if (hI[0][k] != hIRes[0][k]) err++;
+    }
+    else {
+        for (rocblas_int b = 0; b < bc; ++b)
+            for (rocblas_int j = 0; j < n; j++)
+                for (rocblas_int i = 0; i < m; i++)
+                    if (hS[b][i + j*lds] != hSRes[b][i + j*lds]) err++;
+    }
+    *max_err = err;
+}
+
+
+template <bool PACK, typename T, typename Td, typename Th>
+void pack_unpack_interleaved_getPerfData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dS,
+                        const rocblas_int lds,
+                        const rocblas_stride stS,
+                        Td &dI,
+                        const rocblas_int ldi,
+                        const rocblas_int bc,
+                        Th &hS,
+                        Th &hI,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    rocblas_init<T>(hS, true);
+    rocblas_init<T>(hI, true);
+
+    if (!perf)
+    {
+        // cpu performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        if (PACK)
+            interleaved_pack_host(m, n, bc, hS, lds, hI[0], ldi);
+        else
+            interleaved_unpack_host(m, n, bc, hI[0], ldi, hS, lds);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    CHECK_HIP_ERROR(dS.transfer_from(hS));
+    CHECK_HIP_ERROR(dI.transfer_from(hI));
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+        CHECK_ROCBLAS_ERROR(rocsolver_pack_unpack_interleaved(PACK, handle, m, n, dS.data(), lds, stS, dI.data(), ldi, bc));
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        start = get_time_us();
+        rocsolver_pack_unpack_interleaved(PACK, handle, m, n, dS.data(), lds, stS, dI.data(), ldi, bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <bool PACK, typename T>
+void testing_pack_unpack_interleaved(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lds = argus.lda;
+    rocblas_int ldi = argus.ldb;
+    rocblas_stride stS = argus.bsa;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_S = size_t(lds) * n;
+    size_t size_I = size_t(ldi) * n * bc;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_SRes = (argus.unit_check || argus.norm_check) ? size_S : 0;
+    size_t size_IRes = (argus.unit_check || argus.norm_check) ? size_I : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lds < m || ldi < m || bc < 0);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK, handle, m, n, (T*)nullptr, lds, stS, (T*)nullptr, ldi, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hS(size_S,1,stS,bc);
+    host_strided_batch_vector<T> hSRes(size_SRes,1,stS,bc);
+    host_strided_batch_vector<T> hI(size_I,1,size_I,1);
+    host_strided_batch_vector<T> hIRes(size_IRes,1,size_IRes,1);
+    device_strided_batch_vector<T> dS(size_S,1,stS,bc);
+    device_strided_batch_vector<T> dI(size_I,1,size_I,1);
+    if (size_S) CHECK_HIP_ERROR(dS.memcheck());
+    if (size_I) CHECK_HIP_ERROR(dI.memcheck());
+
+    // check quick return
+    if (m == 0 || n == 0 || bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_pack_unpack_interleaved(PACK, handle, m, n, dS.data(), lds, stS, dI.data(), ldi, bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        pack_unpack_interleaved_getError<PACK,T>(handle, m, n, dS, lds, stS, dI, ldi, bc,
+                                                 hS, hSRes, hI, hIRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        pack_unpack_interleaved_getPerfData<PACK,T>(handle, m, n, dS, lds, stS, dI, ldi, bc,
+                                                    hS, hI, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // (the copies are exact)
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,0);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("m", "n", "lda", "ldb", "strideA", "batch_c");
+            rocsolver_bench_output(m, n, lds, ldi, stS, bc);
+            interleaved_bench_results(argus, cpu_time_used, gpu_time_used, max_error);
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** GETRF_INTERLEAVED ********************/
+
+template <typename T, typename U>
+void getrf_interleaved_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         U dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(nullptr,m,n,dA,lda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,n,dA,lda,dIpiv,dInfo,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,n,(T)nullptr,lda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,n,dA,lda,(U)nullptr,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,n,dA,lda,dIpiv,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,0,n,(T)nullptr,lda,(U)nullptr,dInfo,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,0,(T)nullptr,lda,(U)nullptr,dInfo,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle,m,n,dA,lda,dIpiv,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getrf_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    getrf_interleaved_checkBadArgs(handle,m,n,dA.data(),lda,dIpiv.data(),dInfo.data(),bc);
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_interleaved_getError(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Th &hARes,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        Uh &hInfo,
+                        Uh &hInfoRes,
+                        double *max_err)
+{
+    // input data initialization
+    interleaved_init_matrix(m, n, bc, hA, lda);
+    interleaved_pack_host(m, n, bc, hA, lda, hAI[0], lda);
+    CHECK_HIP_ERROR(dA.transfer_from(hAI));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_interleaved(handle, m, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc));
+    CHECK_HIP_ERROR(hAI.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivI.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    interleaved_unpack_host(m, n, bc, hAI[0], lda, hARes, lda);
+
+    // CPU lapack
+    for (rocblas_int b = 0; b < bc; ++b)
+        cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[0] + b);
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        err = norm_error('F',m,n,lda,hA[b],hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting and info (count the number of incorrect values)
+        err = 0;
+        for (rocblas_int k = 0; k < min(m,n); ++k)
+            if (hIpiv[b][k] != hIpivI[0][b + k*bc]) err++;
+        if (hInfo[0][b] != hInfoRes[0][b]) err++;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_interleaved_getPerfData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hInfo,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    interleaved_init_matrix(m, n, bc, hA, lda);
+    interleaved_pack_host(m, n, bc, hA, lda, hAI[0], lda);
+
+    if (!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b)
+            cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[0] + b);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hAI));
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_interleaved(handle, m, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hAI));
+
+        start = get_time_us();
+        rocsolver_getrf_interleaved(handle, m, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrf_interleaved(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m,n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle, m, n, (T*)nullptr, lda, (rocblas_int*)nullptr, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,bc);
+    host_strided_batch_vector<T> hARes(size_ARes,1,size_ARes,bc);
+    host_strided_batch_vector<T> hAI(size_A*bc,1,size_A*bc,1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,bc);
+    host_strided_batch_vector<rocblas_int> hIpivI(size_P*bc,1,size_P*bc,1);
+    host_strided_batch_vector<rocblas_int> hInfo(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(bc,1,bc,1);
+    device_strided_batch_vector<T> dA(size_A*bc,1,size_A*bc,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P*bc,1,size_P*bc,1);
+    device_strided_batch_vector<rocblas_int> dInfo(bc,1,bc,1);
+    if (size_A*bc) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_P*bc) CHECK_HIP_ERROR(dIpiv.memcheck());
+    if (bc) CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if (m == 0 || n == 0 || bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_interleaved(handle, m, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrf_interleaved_getError<T>(handle, m, n, dA, lda, dIpiv, dInfo, bc,
+                                      hA, hAI, hARes, hIpiv, hIpivI, hInfo, hInfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrf_interleaved_getPerfData<T>(handle, m, n, dA, lda, dIpiv, dInfo, bc,
+                                         hA, hAI, hIpiv, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,min(m,n));
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("m", "n", "lda", "batch_c");
+            rocsolver_bench_output(m, n, lda, bc);
+            interleaved_bench_results(argus, cpu_time_used, gpu_time_used, max_error);
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** GETRS_INTERLEAVED ********************/
+
+template <typename T, typename U>
+void getrs_interleaved_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_operation trans,
+                         const rocblas_int n,
+                         const rocblas_int nrhs,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         T dB,
+                         const rocblas_int ldb,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(nullptr,trans,n,nrhs,dA,lda,dIpiv,dB,ldb,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,rocblas_operation(-1),n,nrhs,dA,lda,dIpiv,dB,ldb,bc),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,nrhs,dA,lda,dIpiv,dB,ldb,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,nrhs,(T)nullptr,lda,dIpiv,dB,ldb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,nrhs,dA,lda,(U)nullptr,dB,ldb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,nrhs,dA,lda,dIpiv,(T)nullptr,ldb,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,0,nrhs,(T)nullptr,lda,(U)nullptr,(T)nullptr,ldb,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,0,dA,lda,dIpiv,(T)nullptr,ldb,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle,trans,n,nrhs,(T)nullptr,lda,(U)nullptr,(T)nullptr,ldb,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getrs_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<T> dB(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_interleaved_checkBadArgs(handle,trans,n,nrhs,dA.data(),lda,dIpiv.data(),dB.data(),ldb,bc);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        Th &hB,
+                        Th &hBI)
+{
+    if (CPU)
+    {
+        interleaved_init_matrix(n, n, bc, hA, lda);
+        rocblas_init<T>(hB, true);
+
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        for (rocblas_int b = 0; b < bc; ++b) {
+            int info;
+            cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], &info);
+            for (rocblas_int k = 0; k < n; ++k)
+                hIpivI[0][b + k*bc] = hIpiv[b][k];
+        }
+        interleaved_pack_host(n, n, bc, hA, lda, hAI[0], lda);
+        interleaved_pack_host(n, nrhs, bc, hB, ldb, hBI[0], ldb);
+    }
+
+    if (GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hAI));
+        CHECK_HIP_ERROR(dB.transfer_from(hBI));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpivI));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_getError(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        Th &hB,
+                        Th &hBI,
+                        Th &hBRes,
+                        double *max_err)
+{
+    // input data initialization
+    getrs_interleaved_initData<true,true,T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                            hA, hAI, hIpiv, hIpivI, hB, hBI);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, bc));
+    CHECK_HIP_ERROR(hBI.transfer_from(dB));
+    interleaved_unpack_host(n, nrhs, bc, hBI[0], ldb, hBRes, ldb);
+
+    // CPU lapack
+    for (rocblas_int b = 0; b < bc; ++b)
+        cblas_getrs<T>(trans, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        err = norm_error('I',n,nrhs,ldb,hB[b],hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_interleaved_getPerfData(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        const rocblas_int ldb,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        Th &hB,
+                        Th &hBI,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    getrs_interleaved_initData<true,false,T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                             hA, hAI, hIpiv, hIpivI, hB, hBI);
+
+    if (!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b)
+            cblas_getrs<T>(trans, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_interleaved_initData<false,true,T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                                 hA, hAI, hIpiv, hIpivI, hB, hBI);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrs_interleaved_initData<false,true,T>(handle, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                                 hA, hAI, hIpiv, hIpivI, hB, hBI);
+
+        start = get_time_us();
+        rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrs_interleaved(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int bc = argus.batch_count;
+    char transC = argus.transA_option;
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, (T*)nullptr, lda, (rocblas_int*)nullptr, (T*)nullptr, ldb, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,bc);
+    host_strided_batch_vector<T> hAI(size_A*bc,1,size_A*bc,1);
+    host_strided_batch_vector<T> hB(size_B,1,size_B,bc);
+    host_strided_batch_vector<T> hBI(size_B*bc,1,size_B*bc,1);
+    host_strided_batch_vector<T> hBRes(size_BRes,1,size_BRes,bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,bc);
+    host_strided_batch_vector<rocblas_int> hIpivI(size_P*bc,1,size_P*bc,1);
+    device_strided_batch_vector<T> dA(size_A*bc,1,size_A*bc,1);
+    device_strided_batch_vector<T> dB(size_B*bc,1,size_B*bc,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P*bc,1,size_P*bc,1);
+    if (size_A*bc) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_B*bc) CHECK_HIP_ERROR(dB.memcheck());
+    if (size_P*bc) CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if (n == 0 || nrhs == 0 || bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_interleaved(handle, trans, n, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrs_interleaved_getError<T>(handle, trans, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                      hA, hAI, hIpiv, hIpivI, hB, hBI, hBRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrs_interleaved_getPerfData<T>(handle, trans, n, nrhs, dA, lda, dIpiv, dB, ldb, bc,
+                                         hA, hAI, hIpiv, hIpivI, hB, hBI, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb", "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb, bc);
+            interleaved_bench_results(argus, cpu_time_used, gpu_time_used, max_error);
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** GETRI_INTERLEAVED ********************/
+
+template <typename T, typename U>
+void getri_interleaved_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         U dIpiv,
+                         U dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(nullptr,n,dA,lda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,n,dA,lda,dIpiv,dInfo,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,n,(T)nullptr,lda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,n,dA,lda,(U)nullptr,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,n,dA,lda,dIpiv,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,0,(T)nullptr,lda,(U)nullptr,dInfo,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle,n,dA,lda,dIpiv,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getri_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    getri_interleaved_checkBadArgs(handle,n,dA.data(),lda,dIpiv.data(),dInfo.data(),bc);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getri_interleaved_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hIpivI)
+{
+    if (CPU)
+    {
+        interleaved_init_matrix(n, n, bc, hA, lda);
+
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        for (rocblas_int b = 0; b < bc; ++b) {
+            int info;
+            cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], &info);
+            for (rocblas_int k = 0; k < n; ++k)
+                hIpivI[0][b + k*bc] = hIpiv[b][k];
+        }
+        interleaved_pack_host(n, n, bc, hA, lda, hAI[0], lda);
+    }
+
+    if (GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hAI));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpivI));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getri_interleaved_getError(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Th &hARes,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        Uh &hInfoRes,
+                        double *max_err)
+{
+    rocblas_int sizeW = n;
+    std::vector<T> hW(sizeW);
+
+    // input data initialization
+    getri_interleaved_initData<true,true,T>(handle, n, dA, lda, dIpiv, bc, hA, hAI, hIpiv, hIpivI);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getri_interleaved(handle, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc));
+    CHECK_HIP_ERROR(hAI.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    interleaved_unpack_host(n, n, bc, hAI[0], lda, hARes, lda);
+
+    // CPU lapack
+    for (rocblas_int b = 0; b < bc; ++b)
+        cblas_getri<T>(n, hA[b], lda, hIpiv[b], hW.data(), &sizeW);
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        err = norm_error('F',n,n,lda,hA[b],hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info (count the number of incorrect values)
+        err = (hInfoRes[0][b] != 0) ? 1 : 0;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getri_interleaved_getPerfData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dIpiv,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Uh &hIpiv,
+                        Uh &hIpivI,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    rocblas_int sizeW = n;
+    std::vector<T> hW(sizeW);
+
+    getri_interleaved_initData<true,false,T>(handle, n, dA, lda, dIpiv, bc, hA, hAI, hIpiv, hIpivI);
+
+    if (!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b)
+            cblas_getri<T>(n, hA[b], lda, hIpiv[b], hW.data(), &sizeW);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getri_interleaved_initData<false,true,T>(handle, n, dA, lda, dIpiv, bc, hA, hAI, hIpiv, hIpivI);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getri_interleaved(handle, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getri_interleaved_initData<false,true,T>(handle, n, dA, lda, dIpiv, bc, hA, hAI, hIpiv, hIpivI);
+
+        start = get_time_us();
+        rocsolver_getri_interleaved(handle, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getri_interleaved(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle, n, (T*)nullptr, lda, (rocblas_int*)nullptr, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,bc);
+    host_strided_batch_vector<T> hAI(size_A*bc,1,size_A*bc,1);
+    host_strided_batch_vector<T> hARes(size_ARes,1,size_ARes,bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P,1,size_P,bc);
+    host_strided_batch_vector<rocblas_int> hIpivI(size_P*bc,1,size_P*bc,1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(bc,1,bc,1);
+    device_strided_batch_vector<T> dA(size_A*bc,1,size_A*bc,1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P*bc,1,size_P*bc,1);
+    device_strided_batch_vector<rocblas_int> dInfo(bc,1,bc,1);
+    if (size_A*bc) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_P*bc) CHECK_HIP_ERROR(dIpiv.memcheck());
+    if (bc) CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if (n == 0 || bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getri_interleaved(handle, n, dA.data(), lda, dIpiv.data(), dInfo.data(), bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getri_interleaved_getError<T>(handle, n, dA, lda, dIpiv, dInfo, bc,
+                                      hA, hAI, hARes, hIpiv, hIpivI, hInfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getri_interleaved_getPerfData<T>(handle, n, dA, lda, dIpiv, dInfo, bc,
+                                         hA, hAI, hIpiv, hIpivI, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("n", "lda", "batch_c");
+            rocsolver_bench_output(n, lda, bc);
+            interleaved_bench_results(argus, cpu_time_used, gpu_time_used, max_error);
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** POTRF_INTERLEAVED ********************/
+
+template <typename T, typename U>
+void potrf_interleaved_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_fill uplo,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         U dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(nullptr,uplo,n,dA,lda,dInfo,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,rocblas_fill_full,n,dA,lda,dInfo,bc),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,uplo,n,dA,lda,dInfo,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,uplo,n,(T)nullptr,lda,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,uplo,n,dA,lda,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,uplo,0,(T)nullptr,lda,dInfo,bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle,uplo,n,dA,lda,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_potrf_interleaved_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    potrf_interleaved_checkBadArgs(handle,uplo,n,dA.data(),lda,dInfo.data(),bc);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potrf_interleaved_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Th &hATmp)
+{
+    if (CPU)
+    {
+        rocblas_init<T>(hATmp, true);
+
+        // make A hermitian and scale to ensure positive definiteness
+        for (rocblas_int b = 0; b < bc; ++b) {
+            cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                    (T)1.0, hATmp[b], lda, hATmp[b], lda, (T)0.0, hA[b], lda);
+
+            for (rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] += 400;
+        }
+        interleaved_pack_host(n, n, bc, hA, lda, hAI[0], lda);
+    }
+
+    if (GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hAI));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_interleaved_getError(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Th &hARes,
+                        Uh &hInfo,
+                        Uh &hInfoRes,
+                        double *max_err)
+{
+    // input data initialization
+    // (hARes is used as temporary storage)
+    potrf_interleaved_initData<true,true,T>(handle, n, dA, lda, bc, hA, hAI, hARes);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), lda, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hAI.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    interleaved_unpack_host(n, n, bc, hAI[0], lda, hARes, lda);
+
+    // CPU lapack
+    for (rocblas_int b = 0; b < bc; ++b)
+        cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[0] + b);
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        err = norm_error('F',n,n,lda,hA[b],hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check info (count the number of incorrect values)
+        err = (hInfo[0][b] != hInfoRes[0][b]) ? 1 : 0;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_interleaved_getPerfData(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        Td &dA,
+                        const rocblas_int lda,
+                        Ud &dInfo,
+                        const rocblas_int bc,
+                        Th &hA,
+                        Th &hAI,
+                        Th &hATmp,
+                        Uh &hInfo,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    potrf_interleaved_initData<true,false,T>(handle, n, dA, lda, bc, hA, hAI, hATmp);
+
+    if (!perf)
+    {
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b)
+            cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[0] + b);
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_interleaved_initData<false,true,T>(handle, n, dA, lda, bc, hA, hAI, hATmp);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), lda, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_interleaved_initData<false,true,T>(handle, n, dA, lda, bc, hA, hAI, hATmp);
+
+        start = get_time_us();
+        rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), lda, dInfo.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_potrf_interleaved(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int bc = argus.batch_count;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, (T*)nullptr, lda, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_value);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, (T*)nullptr, lda, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A,1,size_A,bc);
+    host_strided_batch_vector<T> hAI(size_A*bc,1,size_A*bc,1);
+    host_strided_batch_vector<T> hARes(size_A,1,size_A,bc);
+    host_strided_batch_vector<rocblas_int> hInfo(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(bc,1,bc,1);
+    device_strided_batch_vector<T> dA(size_A*bc,1,size_A*bc,1);
+    device_strided_batch_vector<rocblas_int> dInfo(bc,1,bc,1);
+    if (size_A*bc) CHECK_HIP_ERROR(dA.memcheck());
+    if (bc) CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if (n == 0 || bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_interleaved(handle, uplo, n, dA.data(), lda, dInfo.data(), bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        potrf_interleaved_getError<T>(handle, uplo, n, dA, lda, dInfo, bc,
+                                      hA, hAI, hARes, hInfo, hInfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        potrf_interleaved_getPerfData<T>(handle, uplo, n, dA, lda, dInfo, bc,
+                                         hA, hAI, hARes, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "lda", "batch_c");
+            rocsolver_bench_output(uploC, n, lda, bc);
+            interleaved_bench_results(argus, cpu_time_used, gpu_time_used, max_error);
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
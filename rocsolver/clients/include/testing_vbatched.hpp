@@ -0,0 +1,783 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "norm.hpp"
+#include "rocsolver_test.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver.hpp"
+#include "cblas_interface.h"
+#include "clientcommon.hpp"
+
+
+// the sizes of the instances are fractions of the sizes given in the arguments:
+// the size of instance b is s*(b%k + 1)/k, so that the batch has groups of
+// instances of the same size, of different sizes and, for small s, empty ones.
+// All the instances are stored in arrays of the size given in the arguments.
+inline rocblas_int vbatched_size(const rocblas_int s, const rocblas_int b, const rocblas_int k)
+{
+    return s * (b % k + 1) / k;
+}
+
+
+/******************** GETRF_VBATCHED ********************/
+
+template <typename T, typename U, typename V>
+void getrf_vbatched_checkBadArgs(const rocblas_handle handle,
+                         U dM,
+                         U dN,
+                         T dA,
+                         U dLda,
+                         V dIpiv,
+                         U dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(nullptr,dM,dN,dA,dLda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,dN,dA,dLda,dIpiv,dInfo,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,(U)nullptr,dN,dA,dLda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,(U)nullptr,dA,dLda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,dN,(T)nullptr,dLda,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,dN,dA,(U)nullptr,dIpiv,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,dN,dA,dLda,(V)nullptr,dInfo,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,dM,dN,dA,dLda,dIpiv,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle,(U)nullptr,(U)nullptr,(T)nullptr,(U)nullptr,(V)nullptr,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getrf_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dM(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dN(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dLda(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dInfo(1,1,1,1);
+    device_batch_vector<T> dA(1,1,1);
+    device_batch_vector<rocblas_int> dIpiv(1,1,1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrf_vbatched_checkBadArgs(handle,dM.data(),dN.data(),dA.data(),dLda.data(),dIpiv.data(),dInfo.data(),bc);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrf_vbatched_initData(const rocblas_handle handle,
+                        const rocblas_int bc,
+                        Td &dA,
+                        Ud &dIpiv,
+                        Th &hA,
+                        Uh &hIpiv,
+                        const rocblas_int *hM,
+                        const rocblas_int *hN,
+                        const rocblas_int lda)
+{
+    if (CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for (rocblas_int b = 0; b < bc; ++b) {
+            rocblas_int m = hM[b], n = hN[b];
+
+            // scale A to avoid singularities
+            for (rocblas_int i = 0; i < m; i++) {
+                for (rocblas_int j = 0; j < n; j++) {
+                    if (i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // shuffle rows to test pivoting
+            // always the same permuation for debugging purposes
+            for (rocblas_int i = 0; i < m/2; i++) {
+                for (rocblas_int j = 0; j < n; j++) {
+                    tmp = hA[b][i+j*lda];
+                    hA[b][i+j*lda] = hA[b][m-1-i+j*lda];
+                    hA[b][m-1-i+j*lda] = tmp;
+                }
+            }
+        }
+    }
+
+    if (GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh, typename Vh>
+void getrf_vbatched_getError(const rocblas_handle handle,
+                        const rocblas_int bc,
+                        Vd &dM,
+                        Vd &dN,
+                        Td &dA,
+                        Vd &dLda,
+                        Ud &dIpiv,
+                        Vd &dInfo,
+                        Th &hA,
+                        Th &hARes,
+                        Uh &hIpiv,
+                        Uh &hIpivRes,
+                        Vh &hM,
+                        Vh &hN,
+                        const rocblas_int lda,
+                        Vh &hInfo,
+                        Vh &hInfoRes,
+                        double *max_err)
+{
+    // input data initialization
+    getrf_vbatched_initData<true,true,T>(handle, bc, dA, dIpiv, hA, hIpiv, hM[0], hN[0], lda);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(), dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (one instance at a time)
+    for (rocblas_int b = 0; b < bc; ++b) {
+        hInfo[0][b] = 0;
+        if (hM[0][b] > 0 && hN[0][b] > 0)
+            cblas_getrf<T>(hM[0][b], hN[0][b], hA[b], lda, hIpiv[b], hInfo[0] + b);
+    }
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        rocblas_int m = hM[0][b], n = hN[0][b];
+        if (m == 0 || n == 0)
+            continue;
+
+        err = norm_error('F',m,n,lda,hA[b],hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting and info (count the number of incorrect values)
+        err = 0;
+        for (rocblas_int i = 0; i < min(m,n); ++i)
+            if (hIpiv[b][i] != hIpivRes[b][i]) err++;
+        if (hInfo[0][b] != hInfoRes[0][b]) err++;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh, typename Vh>
+void getrf_vbatched_getPerfData(const rocblas_handle handle,
+                        const rocblas_int bc,
+                        Vd &dM,
+                        Vd &dN,
+                        Td &dA,
+                        Vd &dLda,
+                        Ud &dIpiv,
+                        Vd &dInfo,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Vh &hM,
+                        Vh &hN,
+                        const rocblas_int lda,
+                        Vh &hInfo,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    if (!perf)
+    {
+        getrf_vbatched_initData<true,false,T>(handle, bc, dA, dIpiv, hA, hIpiv, hM[0], hN[0], lda);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b) {
+            if (hM[0][b] > 0 && hN[0][b] > 0)
+                cblas_getrf<T>(hM[0][b], hN[0][b], hA[b], lda, hIpiv[b], hInfo[0] + b);
+        }
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    getrf_vbatched_initData<true,false,T>(handle, bc, dA, dIpiv, hA, hIpiv, hM[0], hN[0], lda);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_vbatched_initData<false,true,T>(handle, bc, dA, dIpiv, hA, hIpiv, hM[0], hN[0], lda);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_vbatched_initData<false,true,T>(handle, bc, dA, dIpiv, hA, hIpiv, hM[0], hN[0], lda);
+
+        start = get_time_us();
+        rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrf_vbatched(Arguments argus)
+{
+    // get arguments
+    // (m, n and lda are the maximum sizes of the instances)
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // check invalid batch_count
+    if (bc < 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T *const *)nullptr, (rocblas_int*)nullptr,
+                                                       (rocblas_int *const *)nullptr, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // sizes of the instances
+    host_strided_batch_vector<rocblas_int> hM(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hN(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hLda(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dM(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dN(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dLda(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dInfo(bc,1,bc,1);
+    for (rocblas_int b = 0; b < bc; ++b) {
+        hM[0][b] = vbatched_size(m, b, 4);
+        hN[0][b] = vbatched_size(n, b, 3);
+        hLda[0][b] = lda;
+    }
+    if (bc) {
+        CHECK_HIP_ERROR(dM.memcheck());
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        CHECK_HIP_ERROR(dM.transfer_from(hM));
+        CHECK_HIP_ERROR(dN.transfer_from(hN));
+        CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    }
+
+    // determine sizes
+    // (the sizes of the instances are checked by the library after they are copied to the host)
+    bool invalid_size = (m < 0 || n < 0 || lda < m);
+    size_t size_A = invalid_size ? 1 : size_t(lda) * n;
+    size_t size_P = invalid_size ? 1 : size_t(min(m,n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A,1,bc);
+    host_batch_vector<T> hARes(size_ARes,1,bc);
+    host_batch_vector<rocblas_int> hIpiv(size_P,1,bc);
+    host_batch_vector<rocblas_int> hIpivRes(size_PRes,1,bc);
+    host_strided_batch_vector<rocblas_int> hInfo(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(bc,1,bc,1);
+    device_batch_vector<T> dA(size_A,1,bc);
+    device_batch_vector<rocblas_int> dIpiv(size_P,1,bc);
+    if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check invalid sizes
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(), dInfo.data(), bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // check quick return
+    if (bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(), dInfo.data(), bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrf_vbatched_getError<T>(handle, bc, dM, dN, dA, dLda, dIpiv, dInfo,
+                                   hA, hARes, hIpiv, hIpivRes, hM, hN, lda, hInfo, hInfoRes, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrf_vbatched_getPerfData<T>(handle, bc, dM, dN, dA, dLda, dIpiv, dInfo,
+                                      hA, hIpiv, hM, hN, lda, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,min(m,n));
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("max_m", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(m, n, lda, bc);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
+
+
+/******************** GETRS_VBATCHED ********************/
+
+template <typename T, typename U, typename V>
+void getrs_vbatched_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_operation trans,
+                         U dN,
+                         U dNrhs,
+                         T dA,
+                         U dLda,
+                         V dIpiv,
+                         T dB,
+                         U dLdb,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(nullptr,trans,dN,dNrhs,dA,dLda,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,rocblas_operation(-1),dN,dNrhs,dA,dLda,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,dA,dLda,dIpiv,dB,dLdb,-1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,(U)nullptr,dNrhs,dA,dLda,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,(U)nullptr,dA,dLda,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,(T)nullptr,dLda,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,dA,(U)nullptr,dIpiv,dB,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,dA,dLda,(V)nullptr,dB,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,dA,dLda,dIpiv,(T)nullptr,dLdb,bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,dN,dNrhs,dA,dLda,dIpiv,dB,(U)nullptr,bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle,trans,(U)nullptr,(U)nullptr,(T)nullptr,(U)nullptr,(V)nullptr,(T)nullptr,(U)nullptr,0),
+                          rocblas_status_success);
+}
+
+
+template <typename T>
+void testing_getrs_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dN(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dNrhs(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dLda(1,1,1,1);
+    device_strided_batch_vector<rocblas_int> dLdb(1,1,1,1);
+    device_batch_vector<T> dA(1,1,1);
+    device_batch_vector<T> dB(1,1,1);
+    device_batch_vector<rocblas_int> dIpiv(1,1,1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_vbatched_checkBadArgs(handle,trans,dN.data(),dNrhs.data(),dA.data(),dLda.data(),
+                                (const rocblas_int *const *)dIpiv.data(),dB.data(),dLdb.data(),bc);
+}
+
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_vbatched_initData(const rocblas_handle handle,
+                        const rocblas_int bc,
+                        Td &dA,
+                        Ud &dIpiv,
+                        Td &dB,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        const rocblas_int *hN,
+                        const rocblas_int lda)
+{
+    if (CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for (rocblas_int b = 0; b < bc; ++b) {
+            rocblas_int n = hN[b];
+
+            // scale A to avoid singularities
+            for (rocblas_int i = 0; i < n; i++) {
+                for (rocblas_int j = 0; j < n; j++) {
+                    if (i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            if (n > 0) {
+                int info;
+                cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], &info);
+            }
+        }
+    }
+
+    if (GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh, typename Vh>
+void getrs_vbatched_getError(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int bc,
+                        Vd &dN,
+                        Vd &dNrhs,
+                        Td &dA,
+                        Vd &dLda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        Vd &dLdb,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        Th &hBRes,
+                        Vh &hN,
+                        Vh &hNrhs,
+                        const rocblas_int lda,
+                        const rocblas_int ldb,
+                        double *max_err)
+{
+    // input data initialization
+    getrs_vbatched_initData<true,true,T>(handle, bc, dA, dIpiv, dB, hA, hIpiv, hB, hN[0], lda);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                                 (const rocblas_int *const *)dIpiv.data(), dB.data(), dLdb.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    // (one instance at a time)
+    for (rocblas_int b = 0; b < bc; ++b) {
+        if (hN[0][b] > 0 && hNrhs[0][b] > 0)
+            cblas_getrs<T>(trans, hN[0][b], hNrhs[0][b], hA[b], lda, hIpiv[b], hB[b], ldb);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for (rocblas_int b = 0; b < bc; ++b) {
+        if (hN[0][b] == 0 || hNrhs[0][b] == 0)
+            continue;
+
+        err = norm_error('I',hN[0][b],hNrhs[0][b],ldb,hB[b],hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+
+template <typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh, typename Vh>
+void getrs_vbatched_getPerfData(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int bc,
+                        Vd &dN,
+                        Vd &dNrhs,
+                        Td &dA,
+                        Vd &dLda,
+                        Ud &dIpiv,
+                        Td &dB,
+                        Vd &dLdb,
+                        Th &hA,
+                        Uh &hIpiv,
+                        Th &hB,
+                        Vh &hN,
+                        Vh &hNrhs,
+                        const rocblas_int lda,
+                        const rocblas_int ldb,
+                        double *gpu_time_used,
+                        double *cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const bool perf)
+{
+    if (!perf)
+    {
+        getrs_vbatched_initData<true,false,T>(handle, bc, dA, dIpiv, dB, hA, hIpiv, hB, hN[0], lda);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us();
+        for (rocblas_int b = 0; b < bc; ++b) {
+            if (hN[0][b] > 0 && hNrhs[0][b] > 0)
+                cblas_getrs<T>(trans, hN[0][b], hNrhs[0][b], hA[b], lda, hIpiv[b], hB[b], ldb);
+        }
+        *cpu_time_used = get_time_us() - *cpu_time_used;
+    }
+
+    getrs_vbatched_initData<true,false,T>(handle, bc, dA, dIpiv, dB, hA, hIpiv, hB, hN[0], lda);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_vbatched_initData<false,true,T>(handle, bc, dA, dIpiv, dB, hA, hIpiv, hB, hN[0], lda);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                                     (const rocblas_int *const *)dIpiv.data(), dB.data(), dLdb.data(), bc));
+    }
+
+    // gpu-lapack performance
+    double start;
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrs_vbatched_initData<false,true,T>(handle, bc, dA, dIpiv, dB, hA, hIpiv, hB, hN[0], lda);
+
+        start = get_time_us();
+        rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                 (const rocblas_int *const *)dIpiv.data(), dB.data(), dLdb.data(), bc);
+        *gpu_time_used += get_time_us() - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+
+template <typename T>
+void testing_getrs_vbatched(Arguments argus)
+{
+    // get arguments
+    // (n, nrhs, lda and ldb are the maximum sizes of the instances)
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int bc = argus.batch_count;
+    char transC = argus.transA_option;
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // check invalid batch_count
+    if (bc < 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T *const *)nullptr, (rocblas_int*)nullptr,
+                                                       (const rocblas_int *const *)nullptr, (T *const *)nullptr, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // sizes of the instances
+    host_strided_batch_vector<rocblas_int> hN(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hNrhs(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hLda(bc,1,bc,1);
+    host_strided_batch_vector<rocblas_int> hLdb(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dN(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dNrhs(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dLda(bc,1,bc,1);
+    device_strided_batch_vector<rocblas_int> dLdb(bc,1,bc,1);
+    for (rocblas_int b = 0; b < bc; ++b) {
+        hN[0][b] = vbatched_size(n, b, 4);
+        hNrhs[0][b] = vbatched_size(nrhs, b, 3);
+        hLda[0][b] = lda;
+        hLdb[0][b] = ldb;
+    }
+    if (bc) {
+        CHECK_HIP_ERROR(dN.memcheck());
+        CHECK_HIP_ERROR(dNrhs.memcheck());
+        CHECK_HIP_ERROR(dLda.memcheck());
+        CHECK_HIP_ERROR(dLdb.memcheck());
+        CHECK_HIP_ERROR(dN.transfer_from(hN));
+        CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+        CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+        CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+    }
+
+    // determine sizes
+    // (the sizes of the instances are checked by the library after they are copied to the host)
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    size_t size_A = invalid_size ? 1 : size_t(lda) * n;
+    size_t size_B = invalid_size ? 1 : size_t(ldb) * nrhs;
+    size_t size_P = invalid_size ? 1 : size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A,1,bc);
+    host_batch_vector<T> hB(size_B,1,bc);
+    host_batch_vector<T> hBRes(size_BRes,1,bc);
+    host_batch_vector<rocblas_int> hIpiv(size_P,1,bc);
+    device_batch_vector<T> dA(size_A,1,bc);
+    device_batch_vector<T> dB(size_B,1,bc);
+    device_batch_vector<rocblas_int> dIpiv(size_P,1,bc);
+    if (size_A) CHECK_HIP_ERROR(dA.memcheck());
+    if (size_B) CHECK_HIP_ERROR(dB.memcheck());
+    if (size_P) CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check invalid sizes
+    if (invalid_size) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                                       (const rocblas_int *const *)dIpiv.data(), dB.data(), dLdb.data(), bc),
+                              rocblas_status_invalid_size);
+
+        if (argus.timing)
+             ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // check quick return
+    if (bc == 0) {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                                       (const rocblas_int *const *)dIpiv.data(), dB.data(), dLdb.data(), bc),
+                              rocblas_status_success);
+        if (argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if (argus.unit_check || argus.norm_check)
+        getrs_vbatched_getError<T>(handle, trans, bc, dN, dNrhs, dA, dLda, dIpiv, dB, dLdb,
+                                   hA, hIpiv, hB, hBRes, hN, hNrhs, lda, ldb, &max_error);
+
+    // collect performance data
+    if (argus.timing)
+        getrs_vbatched_getPerfData<T>(handle, trans, bc, dN, dNrhs, dA, dLda, dIpiv, dB, dLdb,
+                                      hA, hIpiv, hB, hN, hNrhs, lda, ldb, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if (argus.unit_check)
+        rocsolver_test_check<T>(max_error,n);
+
+    // output results for rocsolver-bench
+    if (argus.timing) {
+        if (!argus.perf) {
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Arguments:\n";
+            rocblas_cout << "============================================\n";
+            rocsolver_bench_output("trans", "max_n", "max_nrhs", "lda", "ldb", "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb, bc);
+            rocblas_cout << "\n============================================\n";
+            rocblas_cout << "Results:\n";
+            rocblas_cout << "============================================\n";
+            if (argus.norm_check) {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocblas_cout << std::endl;
+        }
+        else {
+            if (argus.norm_check) rocsolver_bench_output(gpu_time_used,max_error);
+            else rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
+/********************************************************/
@@ -5,6 +5,8 @@
 #ifndef ROCSOLVER_EXTRAS_H_
 #define ROCSOLVER_EXTRAS_H_
 
+#include <stddef.h>
+
 /*! \brief Used to specify the order in which multiple elementary matrices are applied together 
  ********************************************************************************/ 
 typedef enum rocblas_direct_
@@ -21,4 +23,61 @@ typedef enum rocblas_storev_
     rocblas_row_wise = 182, /**< Householder vectors are stored in the rows of a matrix. */
 } rocblas_storev;
 
+/*! \brief Used to report the statistics of the device memory managed by rocSOLVER for a handle 
+ ********************************************************************************/ 
+typedef struct rocsolver_memory_stats_
+{
+    size_t bytes_in_use; /**< Bytes of workspace currently in use. */
+    size_t peak_bytes_in_use; /**< Maximum number of bytes in use at the same time. */
+    size_t bytes_reserved; /**< Bytes of device memory held (in use plus cached). */
+    size_t allocations; /**< Number of workspace requests served. */
+    size_t allocations_avoided; /**< Number of requests served with cached memory (no device allocation). */
+} rocsolver_memory_stats;
+
+/*! \brief Used to specify whether the rocSOLVER functions called with a handle may be captured in a graph 
+ ********************************************************************************/ 
+typedef enum rocsolver_capture_mode_
+{
+    rocsolver_capture_disabled = 0, /**< Workspace and constants are allocated when needed (default). */
+    rocsolver_capture_enabled = 1, /**< Functions only enqueue work on the handle's stream. */
+} rocsolver_capture_mode;
+
+/*! \brief Used to specify whether the blocked LU factorization (getrf) uses look-ahead
+ ********************************************************************************/ 
+typedef enum rocsolver_lookahead_mode_
+{
+    rocsolver_lookahead_disabled = 0, /**< The panels are factorized on the handle's stream (default). */
+    rocsolver_lookahead_enabled = 1, /**< The next panel is factorized on a second stream. */
+} rocsolver_lookahead_mode;
+
+/*! \brief Used to specify how the pivots are chosen by the LU factorization (getrf)
+ ********************************************************************************/ 
+typedef enum rocsolver_pivot_strategy_
+{
+    rocsolver_pivot_partial = 0, /**< Partial pivoting, as in LAPACK (default). */
+    rocsolver_pivot_tournament = 1, /**< Tournament pivoting on tall-skinny panels (the pivots differ from partial pivoting). */
+} rocsolver_pivot_strategy;
+
+/*! \brief Opaque structure holding a solver plan (see rocsolver_plan_create) 
+ ********************************************************************************/ 
+typedef struct rocsolver_plan_ *rocsolver_plan;
+
+/*! \brief Used to specify the function executed by a solver plan 
+ ********************************************************************************/ 
+typedef enum rocsolver_plan_routine_
+{
+    rocsolver_plan_getrf = 0, /**< LU factorization (GETRF). */
+    rocsolver_plan_getrf_batched = 1, /**< GETRF_BATCHED. */
+    rocsolver_plan_getrf_strided_batched = 2, /**< GETRF_STRIDED_BATCHED. */
+    rocsolver_plan_getrf_npvt = 3, /**< LU factorization without pivoting (GETRF_NPVT). */
+    rocsolver_plan_getrf_npvt_batched = 4, /**< GETRF_NPVT_BATCHED. */
+    rocsolver_plan_getrf_npvt_strided_batched = 5, /**< GETRF_NPVT_STRIDED_BATCHED. */
+    rocsolver_plan_getri = 6, /**< Inverse from the LU factorization (GETRI). */
+    rocsolver_plan_getri_batched = 7, /**< GETRI_BATCHED. */
+    rocsolver_plan_getri_strided_batched = 8, /**< GETRI_STRIDED_BATCHED. */
+    rocsolver_plan_geqrf = 9, /**< QR factorization (GEQRF). */
+    rocsolver_plan_geqrf_batched = 10, /**< GEQRF_BATCHED. */
+    rocsolver_plan_geqrf_strided_batched = 11, /**< GEQRF_STRIDED_BATCHED. */
+} rocsolver_plan_routine;
+
 #endif
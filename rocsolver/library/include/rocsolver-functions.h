@@ -31,6 +31,490 @@ extern "C" {
 ROCSOLVER_EXPORT rocblas_status rocsolver_get_version_string(char* buf, size_t len);
 
 
+/*
+ * ===========================================================================
+ *      Workspace management
+ * ===========================================================================
+ */
+
+/*! \brief START_WORKSPACE_SIZE_QUERY puts the handle in workspace size query mode.
+
+    \details
+    While the handle is in query mode, any rocSOLVER function called with it will
+    validate its arguments and record the size of the device workspace it needs, 
+    but will not perform any computation (no kernel is launched and 
+    the given arrays are not accessed). 
+    The required size for any function (or group of functions) can then be obtained with
+    rocsolver_stop_workspace_size_query. 
+
+    @param[in]
+    handle          rocblas_handle
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_workspace_size_query(rocblas_handle handle);
+
+/*! \brief STOP_WORKSPACE_SIZE_QUERY ends the workspace size query mode and returns 
+    the required size. 
+
+    \details
+    The returned size is the maximum of the workspace sizes needed by the functions
+    called since rocsolver_start_workspace_size_query. A buffer of at least this size 
+    can be passed to rocsolver_set_workspace, so that the same calls do not
+    allocate device memory.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    size            pointer to size_t.\n
+                    The workspace size in bytes.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_workspace_size_query(rocblas_handle handle,
+                                                                     size_t *size);
+
+/*! \brief SET_WORKSPACE provides a device buffer to be used as workspace by the 
+    rocSOLVER functions called with the handle.
+
+    \details
+    If the buffer is large enough for a given function, no device memory is allocated 
+    or freed during the call. Otherwise the function falls back to allocate its own workspace
+    (unless the capture mode is enabled, see rocsolver_set_capture_mode).
+
+    The buffer is reused by all the calls with the same handle, which are ordered 
+    by the handle's stream. It must not be freed while any of these calls 
+    could still be executing. Use a null buffer and a zero size to detach it.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    workspace       pointer to void. Array on the GPU of size at least size bytes.
+    @param[in]
+    size            size_t.\n
+                    The size of the buffer in bytes.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_workspace(rocblas_handle handle,
+                                                        void *workspace,
+                                                        size_t size);
+
+/*! \brief RELEASE_HANDLE_RESOURCES releases any state and resources rocSOLVER 
+    associated with the handle.
+
+    \details
+    rocSOLVER keeps state for a handle only after one of the functions that change 
+    its settings has been called with it (rocsolver_set_workspace, 
+    rocsolver_start_workspace_size_query, rocsolver_set_capture_mode, rocsolver_set_memory_budget, 
+    rocsolver_set_lookahead, rocsolver_set_pivot_strategy, rocsolver_set_hybrid_getrf or 
+    rocsolver_set_refinement_iterations). From then on, the handle owns the device memory cached 
+    for the workspace, the table of constants and, if they were used, the second stream of 
+    the look-ahead and the pinned buffers of the hybrid factorization.
+
+    All of them are released by this function, which must be called before the handle 
+    is destroyed with rocblas_destroy_handle; otherwise they are leaked, and a handle later 
+    created at the same address with rocblas_create_handle would inherit the settings 
+    (including a user workspace that may have been freed). 
+    rocsolver_destroy_handle calls it automatically, and rocsolver_create_handle discards 
+    any state left at the address of the new handle. It can also be called at any time to 
+    return a handle to the default settings, and does nothing for a handle without state.
+
+    The functions called with a handle without state take their workspace from a memory cache 
+    shared by all the handles without state of the same device. A block of the cache is only 
+    reused by calls on the same stream; the cache lives as long as the process, and does not 
+    hold more memory than the peak used at the same time.
+
+    @param[in]
+    handle          rocblas_handle
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_release_handle_resources(rocblas_handle handle);
+
+/*! \brief GET_MEMORY_STATS returns the statistics of the device memory managed by
+    rocSOLVER for the handle.
+
+    \details
+    When a handle has rocSOLVER state (see rocsolver_release_handle_resources) and no workspace 
+    (or a too small one) has been set with rocsolver_set_workspace, rocSOLVER takes the 
+    workspace of every call from a memory cache associated with the handle. Blocks are cached 
+    by size class, so that repeated calls with the same sizes do not allocate device memory. 
+    The cache does not hold more memory than the peak used at the same time (high-water mark); 
+    it is released by rocsolver_release_handle_resources. All the statistics are zero for 
+    a handle without state (the cache shared by those handles is not reported).
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    stats           pointer to rocsolver_memory_stats.\n
+                    The current statistics of the memory cache.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_memory_stats(rocblas_handle handle,
+                                                           rocsolver_memory_stats *stats);
+
+/*! \brief SET_CAPTURE_MODE makes the rocSOLVER functions called with the handle 
+    safe for stream capture (hipStreamBeginCapture/hipStreamEndCapture).
+
+    \details
+    When the capture mode is enabled, rocSOLVER functions only enqueue kernels and 
+    rocBLAS calls on the handle's stream: they do not allocate or free device memory
+    and do not perform synchronous copies. This is achieved as follows:
+
+    - The table of scalar constants used by the library is created when the mode is enabled
+      (so it must be enabled before the capture begins).
+    - The device workspace is taken exclusively from the buffer set with rocsolver_set_workspace 
+      (which can be sized with a workspace size query done before the capture). 
+      A function that needs more workspace than provided returns rocblas_status_memory_error
+      without enqueuing any work.
+
+    The workspace buffer is referenced by the captured graph, so it must remain valid 
+    (and must not be used by other work running concurrently) for as long as the graph 
+    can be launched. The rocBLAS functions called internally take their memory from the rocBLAS handle;
+    see the rocBLAS documentation on how to reserve it before capturing.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    mode            rocsolver_capture_mode.\n
+                    Enables or disables the capture mode.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_capture_mode(rocblas_handle handle,
+                                                           rocsolver_capture_mode mode);
+
+/*! \brief GET_CAPTURE_MODE returns the current capture mode of the handle.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    mode            pointer to rocsolver_capture_mode.\n
+                    The current capture mode.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_capture_mode(rocblas_handle handle,
+                                                           rocsolver_capture_mode *mode);
+
+/*! \brief SET_MEMORY_BUDGET limits the workspace used by the batched functions 
+    called with the handle.
+
+    \details
+    The workspace of most batched and strided_batched functions grows linearly with batch_count.
+    When the workspace required for the whole batch exceeds the budget, the batch is 
+    split in chunks that fit in it and the chunks are processed one after the other 
+    on the handle's stream. The results are the same as with a single call.
+
+    The budget is honored by the batched and strided_batched versions of POTF2, POTRF, 
+    GETF2, GETRF, GETRI, GESV, GEQR2, GEQRF, GELQ2, GELQF, GEBD2 and GEBRD. 
+    The other batched functions (GETRS, the interleaved and vbatched functions, 
+    GEQRF_PTR_BATCHED and GETRI_OUTOFPLACE_BATCHED) always process the whole batch at once.
+
+    Chunks are never smaller than min_chunk instances (even if they do not fit in the budget),
+    to avoid launching too little work at a time. The workspace size queries report 
+    the size needed for a chunk. 
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    budget          size_t.\n
+                    The maximum workspace size in bytes. Zero means no budget (the default).
+    @param[in]
+    min_chunk       rocblas_int. min_chunk >= 1.\n
+                    The minimum number of instances processed at once.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_memory_budget(rocblas_handle handle,
+                                                            size_t budget,
+                                                            rocblas_int min_chunk);
+
+/*! \brief GET_MEMORY_BUDGET returns the memory budget of the handle, and the chunk 
+    size used by the last batched function called with it.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    budget          pointer to size_t.\n
+                    The maximum workspace size in bytes (zero if there is no budget).
+    @param[out]
+    min_chunk       pointer to rocblas_int.\n
+                    The minimum number of instances processed at once.
+    @param[out]
+    last_chunk      pointer to rocblas_int.\n
+                    The number of instances processed at once by the last batched 
+                    function that supports chunking (zero if none has been called).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_memory_budget(rocblas_handle handle,
+                                                            size_t *budget,
+                                                            rocblas_int *min_chunk,
+                                                            rocblas_int *last_chunk);
+
+/*! \brief SET_LOOKAHEAD enables or disables the look-ahead of the blocked LU factorization 
+    (getrf and its batched versions) called with the handle.
+
+    \details
+    With look-ahead, the trailing matrix update of a step first updates the columns of 
+    the next panel; the next panel is then factorized on a second stream while 
+    the rest of the trailing matrix is updated on the handle's stream. This hides the 
+    latency of the panel factorizations. The results are the same as without look-ahead.
+
+    The second stream is created (once per handle) the first time it is needed.
+    In capture mode, look-ahead is only used if the stream already exists.
+    While the next panel is enqueued, the stream of the rocBLAS handle is temporarily 
+    set to the second stream (and restored before the function returns), so the handle 
+    must not be used concurrently from other host threads.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    mode            rocsolver_lookahead_mode.\n
+                    Enables or disables look-ahead. The default is rocsolver_lookahead_disabled.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_lookahead(rocblas_handle handle,
+                                                        rocsolver_lookahead_mode mode);
+
+/*! \brief GET_LOOKAHEAD returns whether the blocked LU factorization uses look-ahead.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    mode            pointer to rocsolver_lookahead_mode.\n
+                    The current look-ahead mode.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_lookahead(rocblas_handle handle,
+                                                        rocsolver_lookahead_mode *mode);
+
+/*! \brief SET_PIVOT_STRATEGY selects how the LU factorization (getrf and its batched 
+    versions) called with the handle chooses the pivots.
+
+    \details
+    With rocsolver_pivot_tournament, the panels with many more rows than columns 
+    (beyond the sizes handled by the optimized single-kernel factorizations) use 
+    tournament pivoting: the rows of the panel are split in groups that are factorized 
+    independently, and the pivot rows are selected among the candidates of the groups 
+    with a reduction tree. This avoids a search over all the rows for every column.
+
+    The pivots (and thus the factors) are in general NOT the same as with partial pivoting, 
+    although ipiv keeps the same meaning and the factorization still has the form A = P * L * U.
+    Tournament pivoting is stable in practice, but the growth factor bound is larger than with 
+    partial pivoting. The functions without pivoting (getrf_npvt) and getf2 are not affected.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    strategy        rocsolver_pivot_strategy.\n
+                    The pivoting strategy. The default is rocsolver_pivot_partial.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_pivot_strategy(rocblas_handle handle,
+                                                             rocsolver_pivot_strategy strategy);
+
+/*! \brief GET_PIVOT_STRATEGY returns the pivoting strategy of the LU factorization.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    strategy        pointer to rocsolver_pivot_strategy.\n
+                    The current pivoting strategy.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_pivot_strategy(rocblas_handle handle,
+                                                             rocsolver_pivot_strategy *strategy);
+
+/*! \brief SET_HYBRID_GETRF enables the hybrid (host and device) LU factorization 
+    of rocsolver_<type>getrf called with the handle.
+
+    \details
+    In hybrid mode, the panels of matrices with many rows are copied to pinned host memory
+    and factorized on the host with host_threads threads, while the device updates 
+    the trailing matrix with the previous panel. The copies and the host factorization of 
+    a panel are overlapped with the work of the device by double buffering.
+
+    The function returns when the factorization has finished (the host waits for the device).
+    The pivots are chosen with partial pivoting (the pivot strategy of the handle is ignored). 
+    The hybrid mode is not used by the batched versions, nor in capture mode.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    host_threads    rocblas_int. host_threads >= 0.\n
+                    The number of host threads that factorize the panels. 
+                    Zero disables the hybrid mode (the default).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_hybrid_getrf(rocblas_handle handle,
+                                                           rocblas_int host_threads);
+
+/*! \brief GET_HYBRID_GETRF returns the number of host threads of the hybrid LU factorization.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    host_threads    pointer to rocblas_int.\n
+                    The number of host threads (zero if the hybrid mode is disabled).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_hybrid_getrf(rocblas_handle handle,
+                                                           rocblas_int *host_threads);
+
+/*! \brief SET_REFINEMENT_ITERATIONS sets the maximum number of iterations of the 
+    iterative refinement of the mixed precision solvers (rocsolver_<type>gesv_ir) called 
+    with the handle.
+
+    \details
+    When the refinement has not converged after max_iter iterations, the system is solved
+    with the factorization in the precision of the matrix.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    max_iter        rocblas_int. max_iter >= 0.\n
+                    The maximum number of iterations (30 by default, as in LAPACK).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_refinement_iterations(rocblas_handle handle,
+                                                                    rocblas_int max_iter);
+
+/*! \brief GET_REFINEMENT_ITERATIONS returns the maximum number of iterations of the 
+    iterative refinement of the mixed precision solvers.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    max_iter        pointer to rocblas_int.\n
+                    The maximum number of iterations.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_refinement_iterations(rocblas_handle handle,
+                                                                    rocblas_int *max_iter);
+
+/*! \brief GET_FACTOR_CACHE_SIZE returns the number of elements of the factor cache 
+    used by rocsolver_<type>getrf_cache and rocsolver_<type>getrs_cache.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The order of the factorized matrix.
+    @param[out]
+    size            pointer to size_t.\n
+                    The number of elements (of the type of the matrix) of the cache.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_factor_cache_size(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                size_t *size);
+
+
+/*
+ * ===========================================================================
+ *      Solver plans
+ * ===========================================================================
+ */
+
+/*! \brief PLAN_CREATE prepares the repeated execution of a function with fixed sizes.
+
+    \details
+    For workloads that call the same function with the same sizes many times, 
+    a plan does once all the host work that does not depend on the data: 
+    the size arguments are validated, the options of the handle are read (tournament pivoting,
+    look-ahead and hybrid mode of GETRF, with their side stream or host buffers), and the device 
+    workspace is allocated and kept by the plan. Changing the options of the handle afterwards 
+    does not affect the plan. rocsolver_plan_execute then only checks the given pointers and 
+    enqueues the computation; it does not look up the rocSOLVER data of the handle.
+
+    The remaining choices of algorithm (e.g. the optimized small-size kernels) are
+    simple comparisons of the sizes done at every execution. The blocked GETRF still 
+    requests its trsm memory from the rocblas handle at every execution, as rocBLAS 
+    can move it between calls.
+
+    The plan keeps using the handle (and its stream) given at creation. It must be destroyed
+    with rocsolver_plan_destroy before the handle is destroyed or its rocSOLVER resources released.
+    Plan creation allocates device memory, so it must not happen during stream capture; 
+    plan execution does not allocate memory. A plan of GETRF created in hybrid mode 
+    (see rocsolver_set_hybrid_getrf) factorizes the panels on the device when it is executed 
+    while the handle's stream is being captured.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    routine         rocsolver_plan_routine.\n
+                    The function executed by the plan.
+    @param[in]
+    type            rocblas_datatype.\n
+                    The precision: rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                    rocblas_datatype_f32_c or rocblas_datatype_f64_c.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices (it must be equal to n for GETRI).
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix to the next one (ignored if not strided_batched).
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector ipiv (or tau for GEQRF) to the next one
+                    (ignored for the non-batched and the npvt functions).
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch (ignored for the non-batched functions).
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The created plan.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_create(rocblas_handle handle,
+                                                      const rocsolver_plan_routine routine,
+                                                      const rocblas_datatype type,
+                                                      const rocblas_int m,
+                                                      const rocblas_int n,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      const rocblas_stride strideP,
+                                                      const rocblas_int batch_count,
+                                                      rocsolver_plan *plan);
+
+/*! \brief PLAN_EXECUTE executes a plan on the given data.
+
+    \details
+    The arguments have the same meaning as in the corresponding function:
+
+    - GETRF: A, P = ipiv, info. 
+    - GETRF_NPVT: A, info (P is ignored).
+    - GETRI: A, P = ipiv, info.
+    - GEQRF: A, P = tau (info is ignored).
+
+    For the batched functions A is an array of pointers to the matrices; P and info
+    are always contiguous arrays on the GPU.
+
+    @param[in]
+    plan            rocsolver_plan.
+    @param[inout]
+    A               pointer to type (or array of pointers to type for batched functions).
+    @param[inout]
+    P               pointer to rocblas_int (ipiv) or pointer to type (tau).
+    @param[out]
+    info            pointer to rocblas_int.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_execute(rocsolver_plan plan,
+                                                       void *A,
+                                                       void *P,
+                                                       rocblas_int *info);
+
+/*! \brief PLAN_DESTROY releases a plan and its workspace.
+
+    @param[in]
+    plan            rocsolver_plan.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_destroy(rocsolver_plan plan);
+
+
 /*
  * ===========================================================================
  *      Auxiliary functions
@@ -141,6 +625,158 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zlaswp(rocblas_handle handle,
                                                    const rocblas_int *ipiv, 
                                                    const rocblas_int incx);
 
+/*! \brief PACK_INTERLEAVED_BATCHED copies a batch of matrices from the strided
+    layout to the interleaved layout.
+
+    \details
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    This is the layout used by the interleaved batched functions (e.g. GETRF_INTERLEAVED_BATCHED).
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of all matrices in the batch.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of all matrices in the batch.
+    @param[in]
+    A               pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                    The matrices A_b in the strided layout.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of matrices A_b.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix A_b and the next one A_(b+1).
+    @param[out]
+    B               pointer to type. Array on the GPU of dimension ldb*n*batch_count.\n
+                    The matrices A_b in the interleaved layout.
+    @param[in]
+    ldb             rocblas_int. ldb >= m.\n
+                    Specifies the leading dimension of the interleaved matrices.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spack_interleaved_batched(rocblas_handle handle,
+                                                                    const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    float *A,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    float *B,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpack_interleaved_batched(rocblas_handle handle,
+                                                                    const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    double *A,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    double *B,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpack_interleaved_batched(rocblas_handle handle,
+                                                                    const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    rocblas_float_complex *A,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    rocblas_float_complex *B,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpack_interleaved_batched(rocblas_handle handle,
+                                                                    const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    rocblas_double_complex *A,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    rocblas_double_complex *B,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_int batch_count);
+
+/*! \brief UNPACK_INTERLEAVED_BATCHED copies a batch of matrices from the interleaved
+    layout to the strided layout.
+
+    \details
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    This is the inverse of PACK_INTERLEAVED_BATCHED.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of all matrices in the batch.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of all matrices in the batch.
+    @param[in]
+    A               pointer to type. Array on the GPU of dimension lda*n*batch_count.\n
+                    The matrices in the interleaved layout.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the interleaved matrices.
+    @param[out]
+    B               pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                    The matrices B_b in the strided layout.
+    @param[in]
+    ldb             rocblas_int. ldb >= m.\n
+                    Specifies the leading dimension of matrices B_b.
+    @param[in]
+    strideB         rocblas_stride.\n
+                    Stride from the start of one matrix B_b and the next one B_(b+1).
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sunpack_interleaved_batched(rocblas_handle handle,
+                                                                      const rocblas_int m,
+                                                                      const rocblas_int n,
+                                                                      float *A,
+                                                                      const rocblas_int lda,
+                                                                      float *B,
+                                                                      const rocblas_int ldb,
+                                                                      const rocblas_stride strideB,
+                                                                      const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dunpack_interleaved_batched(rocblas_handle handle,
+                                                                      const rocblas_int m,
+                                                                      const rocblas_int n,
+                                                                      double *A,
+                                                                      const rocblas_int lda,
+                                                                      double *B,
+                                                                      const rocblas_int ldb,
+                                                                      const rocblas_stride strideB,
+                                                                      const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cunpack_interleaved_batched(rocblas_handle handle,
+                                                                      const rocblas_int m,
+                                                                      const rocblas_int n,
+                                                                      rocblas_float_complex *A,
+                                                                      const rocblas_int lda,
+                                                                      rocblas_float_complex *B,
+                                                                      const rocblas_int ldb,
+                                                                      const rocblas_stride strideB,
+                                                                      const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zunpack_interleaved_batched(rocblas_handle handle,
+                                                                      const rocblas_int m,
+                                                                      const rocblas_int n,
+                                                                      rocblas_double_complex *A,
+                                                                      const rocblas_int lda,
+                                                                      rocblas_double_complex *B,
+                                                                      const rocblas_int ldb,
+                                                                      const rocblas_stride strideB,
+                                                                      const rocblas_int batch_count);
+
 /*! \brief LARFG generates an orthogonal Householder reflector H of order n. 
 
     \details
@@ -2999,6 +3635,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetf2_strided_batched(rocblas_handle
     could be executed with mid-size matrices if optimizations are enabled (default option). For more details see the
     section "tuning rocSOLVER performance" on the User's guide).
 
+    The pivots of tall-skinny panels are chosen with tournament pivoting instead of partial pivoting
+    if the pivot strategy of the handle is rocsolver_pivot_tournament (see rocsolver_set_pivot_strategy).
+
     The factorization has the form
 
         A = P * L * U
@@ -3076,6 +3715,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf(rocblas_handle handle,
     could be executed with mid-size matrices if optimizations are enabled (default option). For more details see the
     section "tuning rocSOLVER performance" on the User's guide).
 
+    The pivots of tall-skinny panels are chosen with tournament pivoting instead of partial pivoting
+    if the pivot strategy of the handle is rocsolver_pivot_tournament (see rocsolver_set_pivot_strategy).
+
     The factorization of matrix A_i in the batch has the form
 
         A_i = P_i * L_i * U_i
@@ -3170,6 +3812,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched(rocblas_handle handle,
     could be executed with mid-size matrices if optimizations are enabled (default option). For more details see the
     section "tuning rocSOLVER performance" on the User's guide).
     
+    The pivots of tall-skinny panels are chosen with tournament pivoting instead of partial pivoting
+    if the pivot strategy of the handle is rocsolver_pivot_tournament (see rocsolver_set_pivot_strategy).
+
     The factorization of matrix A_i in the batch has the form
 
         A_i = P_i * L_i * U_i
@@ -3264,15 +3909,255 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched(rocblas_handle
                                                    rocblas_int *info,
                                                    const rocblas_int batch_count);
 
-/*! \brief GEQR2 computes a QR factorization of a general m-by-n matrix A.
+/*! \brief GETRF_VBATCHED computes the LU factorization of a batch of general matrices 
+    of different sizes, using partial pivoting with row interchanges.
 
     \details
-    (This is the unblocked version of the algorithm).
+    The factorization of the m_i-by-n_i matrix A_i in the batch has the form
 
-    The factorization has the form
+        A_i = P_i * L_i * U_i
 
-        A =  Q * [ R ]
-                 [ 0 ]
+    where P_i is a permutation matrix, L_i is lower triangular with unit
+    diagonal elements (lower trapezoidal if m_i > n_i), and U_i is upper
+    triangular (upper trapezoidal if m_i < n_i).
+
+    Small matrices (m_i <= 256 and n_i <= 64) are bucketed by size class and every class
+    is factorized by a single kernel that reads the sizes of each instance; the larger
+    instances with the same sizes are factorized together with the blocked algorithm.
+    The sizes are copied to the host to group the instances, so the host waits for 
+    the work previously enqueued in the handle's stream; this function is not 
+    supported in capture mode (rocblas_status_not_implemented is returned).
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              The number of rows m_i >= 0 of every matrix A_i.
+    @param[in]
+    n         pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              The number of columns n_i >= 0 of every matrix A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda_i*n_i.\n
+              On entry, the m_i-by-n_i matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorizations.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              The leading dimension lda_i >= m_i of every matrix A_i.
+    @param[out]
+    ipiv      array of pointers to rocblas_int. Each pointer points to an array on the GPU of dimension min(m_i,n_i).\n
+              The vectors of pivot indices ipiv_i (corresponding to A_i). 
+              Row j of A_i was interchanged with row ipiv_i(j).
+    @param[out]
+    info      pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              If info_i = 0, successful exit for factorization of A_i.
+              If info_i = j > 0, U_i is singular. U_i(j,j) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+              Number of matrices in the batch. 
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_vbatched(rocblas_handle handle,
+                                                          const rocblas_int *m,
+                                                          const rocblas_int *n,
+                                                          float *const A[],
+                                                          const rocblas_int *lda,
+                                                          rocblas_int *const ipiv[],
+                                                          rocblas_int *info,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_vbatched(rocblas_handle handle,
+                                                          const rocblas_int *m,
+                                                          const rocblas_int *n,
+                                                          double *const A[],
+                                                          const rocblas_int *lda,
+                                                          rocblas_int *const ipiv[],
+                                                          rocblas_int *info,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_vbatched(rocblas_handle handle,
+                                                          const rocblas_int *m,
+                                                          const rocblas_int *n,
+                                                          rocblas_float_complex *const A[],
+                                                          const rocblas_int *lda,
+                                                          rocblas_int *const ipiv[],
+                                                          rocblas_int *info,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_vbatched(rocblas_handle handle,
+                                                          const rocblas_int *m,
+                                                          const rocblas_int *n,
+                                                          rocblas_double_complex *const A[],
+                                                          const rocblas_int *lda,
+                                                          rocblas_int *const ipiv[],
+                                                          rocblas_int *info,
+                                                          const rocblas_int batch_count);
+
+/*! \brief GETRF_INTERLEAVED_BATCHED computes the LU factorization of a batch of 
+    general m-by-n matrices stored in the interleaved layout, using partial pivoting 
+    with row interchanges.
+
+    \details
+    (See GETRF_STRIDED_BATCHED for the description of the factorization).
+
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    Every instance is processed by a single thread, so that the accesses to memory 
+    are coalesced. This is intended for large batches of very small matrices 
+    (up to 16x16 or so); PACK_INTERLEAVED_BATCHED and UNPACK_INTERLEAVED_BATCHED 
+    convert from and to the strided layout.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all matrices A_b in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all matrices A_b in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n*batch_count.\n
+              On entry, the interleaved m-by-n matrices A_b to be factored.
+              On exit, the factors L_b and U_b from the factorizations.
+              The unit diagonal elements of L_b are not stored.
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_b.
+    @param[out]
+    ipiv      pointer to rocblas_int. Array on the GPU of dimension min(m,n)*batch_count.\n
+              The interleaved vectors of pivot indices: the index k of instance b is 
+              in ipiv[b + k*batch_count]. Row k of A_b was interchanged with that row.
+    @param[out]
+    info      pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              If info_b = 0, successful exit for factorization of A_b.
+              If info_b = i > 0, U_b is singular. U_b(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+              Number of matrices in the batch. 
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     float *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     double *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     rocblas_float_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     rocblas_double_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+/*! \brief GETRF_OOC computes the LU factorization of a general m-by-n matrix A
+    stored in host memory (out-of-core), using partial pivoting with row interchanges.
+
+    \details
+    (See GETRF for the description of the factorization).
+
+    The matrix does not need to fit in device memory: it is streamed through the device 
+    by slabs of columns. For every slab, the slabs already factored to its left are applied
+    to it (interchanges, trsm and gemm), then the slab is factorized and written back.
+    The transfers of the factored slabs overlap the updates with double buffering.
+    The slabs are as wide as the memory budget of the handle allows (see 
+    rocsolver_set_memory_budget), or as the free device memory if there is no budget. 
+    A should be in pinned host memory so that the transfers can overlap the computations.
+
+    The function returns when the factorization has finished. It is not supported in 
+    capture mode (rocblas_status_not_implemented is returned).
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of the matrix A. 
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of the matrix A. 
+    @param[inout]
+    A         pointer to type. Array on the host of dimension lda*n.\n
+              On entry, the m-by-n matrix A to be factored.
+              On exit, the factors L and U from the factorization.
+              The unit diagonal elements of L are not stored.
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    ipiv      pointer to rocblas_int. Array on the host of dimension min(m,n).\n
+              The vector of pivot indices. Elements of ipiv are 1-based indices.
+              For 1 <= i <= min(m,n), the row i of the
+              matrix was interchanged with row ipiv[i].
+              Matrix P of the factorization can be derived from ipiv.
+    @param[out]
+    info      pointer to a rocblas_int on the host.\n
+              If info = 0, successful exit. 
+              If info = i > 0, U is singular. U(i,i) is the first zero pivot.
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_ooc(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     float *A,
+                                                     const rocblas_int lda,
+                                                     rocblas_int *ipiv,
+                                                     rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_ooc(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     double *A,
+                                                     const rocblas_int lda,
+                                                     rocblas_int *ipiv,
+                                                     rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_ooc(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_float_complex *A,
+                                                     const rocblas_int lda,
+                                                     rocblas_int *ipiv,
+                                                     rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_ooc(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_double_complex *A,
+                                                     const rocblas_int lda,
+                                                     rocblas_int *ipiv,
+                                                     rocblas_int *info);
+
+/*! \brief GEQR2 computes a QR factorization of a general m-by-n matrix A.
+
+    \details
+    (This is the unblocked version of the algorithm).
+
+    The factorization has the form
+
+        A =  Q * [ R ]
+                 [ 0 ]
 
     where R is upper triangular (upper trapezoidal if m < n), and Q is 
     a m-by-m orthogonal matrix represented as the product of Householder matrices
@@ -5173,6 +6058,497 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs(rocblas_handle handle,
                                                  rocblas_double_complex *B,
                                                  const rocblas_int ldb);
 
+/*! \brief GESV_BATCHED solves a batch of systems of n linear equations on n variables
+    using the LU factorization with partial pivoting.
+
+    \details
+    For each instance j in the batch, it computes the LU factorization
+
+        A_j = P_j * L_j * U_j
+
+    with partial pivoting (as GETRF_BATCHED) and solves the system
+
+        A_j * X_j = B_j
+
+    with that factorization (as GETRS_BATCHED).
+
+    Small systems (n <= 64) are factorized and solved by a single kernel, with the
+    factors in registers. As in LAPACK, B_j is not modified if U_j is singular (info_j > 0).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the n-by-n matrices A_j.
+                On exit, the factors L_j and U_j of the factorizations.
+                The unit diagonal elements of L_j are not stored.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors of pivot indices ipiv_j (corresponding to A_j).
+                Dimension of ipiv_j is n.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch
+                (B_j is not modified if info_j > 0).
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for the system j.
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        float *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *ipiv,
+                                                        const rocblas_stride strideP,
+                                                        float *const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        double *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *ipiv,
+                                                        const rocblas_stride strideP,
+                                                        double *const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_float_complex *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *ipiv,
+                                                        const rocblas_stride strideP,
+                                                        rocblas_float_complex *const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_double_complex *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *ipiv,
+                                                        const rocblas_stride strideP,
+                                                        rocblas_double_complex *const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+/*! \brief GESV_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables
+    using the LU factorization with partial pivoting.
+
+    \details
+    For each instance j in the batch, it computes the LU factorization
+
+        A_j = P_j * L_j * U_j
+
+    with partial pivoting (as GETRF_STRIDED_BATCHED) and solves the system
+
+        A_j * X_j = B_j
+
+    with that factorization (as GETRS_STRIDED_BATCHED).
+
+    Small systems (n <= 64) are factorized and solved by a single kernel, with the
+    factors in registers. As in LAPACK, B_j is not modified if U_j is singular (info_j > 0).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the n-by-n matrices A_j.
+                On exit, the factors L_j and U_j of the factorizations.
+                The unit diagonal elements of L_j are not stored.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors of pivot indices ipiv_j (corresponding to A_j).
+                Dimension of ipiv_j is n.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch
+                (B_j is not modified if info_j > 0).
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for the system j.
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                float *A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int *ipiv,
+                                                                const rocblas_stride strideP,
+                                                                float *B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int *info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                double *A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int *ipiv,
+                                                                const rocblas_stride strideP,
+                                                                double *B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int *info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                rocblas_float_complex *A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int *ipiv,
+                                                                const rocblas_stride strideP,
+                                                                rocblas_float_complex *B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int *info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                rocblas_double_complex *A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int *ipiv,
+                                                                const rocblas_stride strideP,
+                                                                rocblas_double_complex *B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int *info,
+                                                                const rocblas_int batch_count);
+
+/*! \brief GESV_IR solves a system of n linear equations on n variables with
+    a mixed precision LU factorization and iterative refinement.
+
+    \details
+    The solution of 
+
+        A * X = B 
+
+    is computed with the LU factorization of A in single precision (complex single 
+    for zgesv_ir), followed by iterative refinement of the solution with residuals in 
+    the precision of A, as in LAPACK DSGESV/ZCGESV. The solution has the accuracy of the 
+    precision of A; for well conditioned systems, most of the work is done in single precision.
+
+    If the refinement does not converge within the maximum number of iterations 
+    (see rocsolver_set_refinement_iterations), or if A or B cannot be represented 
+    in single precision, or if the single precision factor U is singular, A is factorized
+    in its own precision (as GETRF) and the system is solved with that factorization (as GETRS).
+
+    The host waits for the device at every iteration, to check the convergence.
+    This function is not supported in capture mode (rocblas_status_not_implemented is returned).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrices B and X.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the n-by-n matrix A.
+                On exit, A is unchanged if the refinement converged (iter >= 0); 
+                otherwise the factors L and U of the factorization A = P*L*U 
+                (in the precision of A).
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices of the factorization that was used 
+                (in single precision if iter >= 0).
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                The solution matrix X (if info = 0).
+    @param[in]
+    ldx         rocblas_int. ldx >= n.\n
+                The leading dimension of X.
+    @param[out]
+    iter        pointer to a rocblas_int on the GPU.\n
+                If iter >= 0, the refinement converged after iter iterations.
+                If iter < 0, A was factorized in its own precision because: 
+                iter = -2, an entry of A or B (or of a residual) is too large for single precision;
+                iter = -3, the single precision factor U is singular;
+                iter = -max_iter-1, the refinement did not converge in max_iter iterations.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit. 
+                If info = i > 0, U is singular. U(i,i) is the first zero pivot
+                (of the factorization in the precision of A), and X has not been computed.
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_ir(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int *ipiv,
+                                                   double *B,
+                                                   const rocblas_int ldb,
+                                                   double *X,
+                                                   const rocblas_int ldx,
+                                                   rocblas_int *iter,
+                                                   rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_ir(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int *ipiv,
+                                                   rocblas_double_complex *B,
+                                                   const rocblas_int ldb,
+                                                   rocblas_double_complex *X,
+                                                   const rocblas_int ldx,
+                                                   rocblas_int *iter,
+                                                   rocblas_int *info);
+
+/*! \brief GETRF_CACHE computes the LU factorization of a square matrix A
+    as GETRF, and keeps the inverses of the diagonal blocks of the factors in a cache.
+
+    \details
+    The factorization is 
+
+        A = P * L * U 
+
+    as computed by GETRF. The inverses of the diagonal blocks of L and U, that the triangular
+    solves of GETRS would compute every time they are called, are stored in the cache, 
+    to be used by GETRS_CACHE. Repeated solves with the same factors are then mostly 
+    matrix-matrix products. The cache is owned by the user and must be kept with the factors.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of rows and columns of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the n-by-n matrix A to be factored.
+              On exit, the factors L and U from the factorization.
+              The unit diagonal elements of L are not stored.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    ipiv      pointer to rocblas_int. Array on the GPU of dimension n.\n
+              The vector of pivot indices. Elements of ipiv are 1-based indices.
+              For 1 <= i <= n, the row i of the
+              matrix was interchanged with row ipiv[i].
+    @param[out]
+    cache     pointer to type. Array on the GPU of dimension size
+              (see rocsolver_get_factor_cache_size).\n
+              The inverses of the diagonal blocks of L and U (if info = 0).
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, successful exit.
+              If info = i > 0, U is singular. U(i,i) is the first zero pivot, and
+              the content of the cache is not defined.
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_cache(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       float *A,
+                                                       const rocblas_int lda,
+                                                       rocblas_int *ipiv,
+                                                       float *cache,
+                                                       rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_cache(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       double *A,
+                                                       const rocblas_int lda,
+                                                       rocblas_int *ipiv,
+                                                       double *cache,
+                                                       rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_cache(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       rocblas_float_complex *A,
+                                                       const rocblas_int lda,
+                                                       rocblas_int *ipiv,
+                                                       rocblas_float_complex *cache,
+                                                       rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_cache(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       rocblas_double_complex *A,
+                                                       const rocblas_int lda,
+                                                       rocblas_int *ipiv,
+                                                       rocblas_double_complex *cache,
+                                                       rocblas_int *info);
+
+/*! \brief GETRS_CACHE solves a system of n linear equations on n variables 
+    using the LU factorization and the factor cache computed by GETRF_CACHE.
+
+    \details
+    It solves one of the following systems: 
+
+        A  * X = B (no transpose),  
+        A' * X = B (transpose),  or  
+        A* * X = B (conjugate transpose)
+
+    as GETRS, but the inverses of the diagonal blocks of the factors are read from the cache 
+    instead of being computed.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factors L and U of the factorization A = P*L*U returned by GETRF_CACHE.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices returned by GETRF_CACHE.
+    @param[in]
+    cache       pointer to type. Array on the GPU.\n
+                The factor cache returned by GETRF_CACHE.
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_cache(rocblas_handle handle,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int n,
+                                                       const rocblas_int nrhs,
+                                                       float *A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_int *ipiv,
+                                                       float *cache,
+                                                       float *B,
+                                                       const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_cache(rocblas_handle handle,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int n,
+                                                       const rocblas_int nrhs,
+                                                       double *A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_int *ipiv,
+                                                       double *cache,
+                                                       double *B,
+                                                       const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_cache(rocblas_handle handle,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int n,
+                                                       const rocblas_int nrhs,
+                                                       rocblas_float_complex *A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_int *ipiv,
+                                                       rocblas_float_complex *cache,
+                                                       rocblas_float_complex *B,
+                                                       const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_cache(rocblas_handle handle,
+                                                       const rocblas_operation trans,
+                                                       const rocblas_int n,
+                                                       const rocblas_int nrhs,
+                                                       rocblas_double_complex *A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_int *ipiv,
+                                                       rocblas_double_complex *cache,
+                                                       rocblas_double_complex *B,
+                                                       const rocblas_int ldb);
+
 /*! \brief GETRS_BATCHED solves a batch of systems of n linear equations on n variables 
      using the LU factorization computed by GETRF_BATCHED.
 
@@ -5312,6 +6688,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched(rocblas_handle handle,
     strideP     rocblas_stride.\n
                 Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
                 There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+                If strideA = 0 and strideP = 0, all the systems share the same factors; 
+                if in addition strideB = ldb*nrhs, the batch is solved as a single system 
+                with nrhs*batch_count right hand sides.
     @param[in,out]
     B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
                 On entry, the right hand side matrices B_j.
@@ -5385,6 +6764,189 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched(rocblas_handle
                                                                  const rocblas_stride strideB,
                                                                  const rocblas_int batch_count);
 
+/*! \brief GETRS_VBATCHED solves a batch of systems of linear equations of different sizes
+    using the LU factorizations computed by GETRF_VBATCHED.
+
+    \details
+    For each instance j in the batch, it solves one of the following systems: 
+
+        A_j  * X_j = B_j (no transpose),  
+        A_j' * X_j = B_j (transpose),  or  
+        A_j* * X_j = B_j (conjugate transpose)
+
+    depending on the value of trans. 
+
+    The instances with the same sizes are solved together, as with GETRS_BATCHED.
+    The sizes are copied to the host to group the instances, so the host waits for 
+    the work previously enqueued in the handle's stream; this function is not 
+    supported in capture mode (rocblas_status_not_implemented is returned).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations of each instance in the batch. 
+    @param[in]
+    n           pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+                The order n_j >= 0 of every system.
+    @param[in]
+    nrhs        pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+                The number of right hand sides nrhs_j >= 0 of every system.
+    @param[in]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda_j*n_j.\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_VBATCHED.
+    @param[in]
+    lda         pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+                The leading dimension lda_j >= n_j of every matrix A_j.
+    @param[in]
+    ipiv        array of pointers to rocblas_int. Each pointer points to an array on the GPU of dimension n_j.\n
+                The vectors ipiv_j of pivot indices returned by GETRF_VBATCHED.
+    @param[in,out]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension ldb_j*nrhs_j.\n 
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+                The leading dimension ldb_j >= n_j of every matrix B_j.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_vbatched(rocblas_handle handle,
+                                                          const rocblas_operation trans,
+                                                          const rocblas_int *n,
+                                                          const rocblas_int *nrhs,
+                                                          float *const A[],
+                                                          const rocblas_int *lda,
+                                                          const rocblas_int *const ipiv[],
+                                                          float *const B[],
+                                                          const rocblas_int *ldb,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_vbatched(rocblas_handle handle,
+                                                          const rocblas_operation trans,
+                                                          const rocblas_int *n,
+                                                          const rocblas_int *nrhs,
+                                                          double *const A[],
+                                                          const rocblas_int *lda,
+                                                          const rocblas_int *const ipiv[],
+                                                          double *const B[],
+                                                          const rocblas_int *ldb,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_vbatched(rocblas_handle handle,
+                                                          const rocblas_operation trans,
+                                                          const rocblas_int *n,
+                                                          const rocblas_int *nrhs,
+                                                          rocblas_float_complex *const A[],
+                                                          const rocblas_int *lda,
+                                                          const rocblas_int *const ipiv[],
+                                                          rocblas_float_complex *const B[],
+                                                          const rocblas_int *ldb,
+                                                          const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_vbatched(rocblas_handle handle,
+                                                          const rocblas_operation trans,
+                                                          const rocblas_int *n,
+                                                          const rocblas_int *nrhs,
+                                                          rocblas_double_complex *const A[],
+                                                          const rocblas_int *lda,
+                                                          const rocblas_int *const ipiv[],
+                                                          rocblas_double_complex *const B[],
+                                                          const rocblas_int *ldb,
+                                                          const rocblas_int batch_count);
+
+/*! \brief GETRS_INTERLEAVED_BATCHED solves a batch of systems of n linear equations 
+    on n variables using the LU factorizations computed by GETRF_INTERLEAVED_BATCHED.
+
+    \details
+    (See GETRS_STRIDED_BATCHED for the description of the systems).
+
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    Every instance is processed by a single thread, so that the accesses to memory 
+    are coalesced. This is intended for large batches of very small matrices 
+    (up to 16x16 or so); PACK_INTERLEAVED_BATCHED and UNPACK_INTERLEAVED_BATCHED 
+    convert from and to the strided layout.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_b matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_b.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n*batch_count.\n
+                The interleaved factors L_b and U_b returned by GETRF_INTERLEAVED_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_b.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n*batch_count.\n
+                The interleaved pivot indices returned by GETRF_INTERLEAVED_BATCHED.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs*batch_count.\n 
+                On entry, the interleaved right hand side matrices B_b.
+                On exit, the solution matrix X_b of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_b.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     float *A,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int *ipiv,
+                                                                     float *B,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     double *A,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int *ipiv,
+                                                                     double *B,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     rocblas_float_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int *ipiv,
+                                                                     rocblas_float_complex *B,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     rocblas_double_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int *ipiv,
+                                                                     rocblas_double_complex *B,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count);
+
 /*! \brief GETRI inverts a general n-by-n matrix A using the LU factorization
     computed by GETRF.
 
@@ -5558,6 +7120,8 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_batched(rocblas_handle handle,
     strideP   rocblas_stride.\n
               Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
               There is no restriction for the value of strideP. Normal use case is strideP >= n.
+              If strideA = 0 and strideP = 0, all the instances share the same matrix: 
+              it is inverted only once and its info is returned for every instance.
     @param[out]
     info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
               If info_j = 0, successful exit for inversion of A_j. 
@@ -5608,6 +7172,75 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_strided_batched(rocblas_handle
                                                                  rocblas_int *info,
                                                                  const rocblas_int batch_count);
 
+/*! \brief GETRI_INTERLEAVED_BATCHED inverts a batch of general n-by-n matrices 
+    using the LU factorizations computed by GETRF_INTERLEAVED_BATCHED.
+
+    \details
+    (See GETRI_STRIDED_BATCHED for the description of the inversion).
+
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    Every instance is processed by a single thread, so that the accesses to memory 
+    are coalesced. This is intended for large batches of very small matrices 
+    (up to 16x16 or so); PACK_INTERLEAVED_BATCHED and UNPACK_INTERLEAVED_BATCHED 
+    convert from and to the strided layout.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of rows and columns of all matrices A_b in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n*batch_count.\n
+              On entry, the interleaved factors L_b and U_b returned by GETRF_INTERLEAVED_BATCHED.
+              On exit, the inverses of A_b if info_b = 0.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              Specifies the leading dimension of matrices A_b.
+    @param[in]
+    ipiv      pointer to rocblas_int. Array on the GPU of dimension n*batch_count.\n
+              The interleaved pivot indices returned by GETRF_INTERLEAVED_BATCHED.
+    @param[out]
+    info      pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              If info_b = 0, successful exit for inversion of A_b.
+              If info_b = i > 0, U_b is singular. U_b(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+              Number of matrices in the batch. 
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int n,
+                                                                     float *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int n,
+                                                                     double *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int n,
+                                                                     rocblas_float_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_int n,
+                                                                     rocblas_double_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *ipiv,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
 /*! \brief POTF2 computes the Cholesky factorization of a real symmetric/complex
     Hermitian positive definite matrix A.
 
@@ -6038,6 +7671,77 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched(rocblas_handle
                                                                    rocblas_int* info,
                                                                    const rocblas_int batch_count);
 
+/*! \brief POTRF_INTERLEAVED_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric (complex hermitian) positive definite matrices 
+    stored in the interleaved layout.
+
+    \details
+    (See POTRF_STRIDED_BATCHED for the description of the factorization).
+
+    In the interleaved layout, the entry (i,j) of the matrix of instance b 
+    is stored in A[b + (i + j*lda)*batch_count].
+    Every instance is processed by a single thread, so that the accesses to memory 
+    are coalesced. This is intended for large batches of very small matrices 
+    (up to 16x16 or so); PACK_INTERLEAVED_BATCHED and UNPACK_INTERLEAVED_BATCHED 
+    convert from and to the strided layout.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n*batch_count.\n
+              On entry, the interleaved matrices A_b to be factored. On exit, the lower or upper triangular factors.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_b.
+    @param[out]
+    info      pointer to rocblas_int. Array on the GPU of dimension batch_count.\n
+              If info_b = 0, successful factorization of matrix A_b. 
+              If info_b = j > 0, the leading minor of order j of A_b is not positive definite. 
+              The b-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+              Number of matrices in the batch. 
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     float *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     double *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     rocblas_float_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_interleaved_batched(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     rocblas_double_complex *A,
+                                                                     const rocblas_int lda,
+                                                                     rocblas_int *info,
+                                                                     const rocblas_int batch_count);
+
 
 #ifdef __cplusplus
 }
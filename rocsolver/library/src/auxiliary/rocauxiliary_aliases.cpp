@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocsolver-aliases.h"
+#include "handle.hpp"
 
 // We need to include extern definitions for these inline functions to ensure
 // that librocsolver.so will contain these symbols for FFI or when inlining
@@ -20,11 +21,15 @@ rocsolver_create_handle(rocsolver_handle *handle) {
   if (stat != rocblas_status_success) {
     return stat;
   }
+  // a handle destroyed without releasing its resources may have left data
+  // at the same address: the new handle starts with the default settings
+  rocsolver_release_handle_data(*handle);
   return rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
 }
 
 rocsolver_status
 rocsolver_destroy_handle(rocsolver_handle handle) {
+  rocsolver_release_handle_data(handle);
   return rocblas_destroy_handle(handle);
 }
 
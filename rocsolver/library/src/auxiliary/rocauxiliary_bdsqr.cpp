@@ -42,11 +42,14 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     size_t size;  //size of workspace
     rocsolver_bdsqr_getMemorySize<S>(n,nv,nu,nc,batch_count,&size);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size);
+
     void *work;
-    hipMalloc(&work,size);
-    if (size && !work)
+    rocsolver_device_malloc mem(handle,size);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
 
     // execution
     rocblas_status status =
@@ -62,7 +65,6 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
                                          info,
                                          batch_count,
                                          (S*)work);
-    hipFree(work);
     
     return status;
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_interleave.hpp"
+
+template <typename T>
+rocblas_status rocsolver_pack_interleaved_batched_impl(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                                       T *A, const rocblas_int lda, const rocblas_stride strideA,
+                                                       T *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_interleave_argCheck(m,n,lda,ldb,A,B,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // execution
+    return rocsolver_interleave_template<true,T>(handle,m,n,A,lda,strideA,B,ldb,batch_count);
+}
+
+template <typename T>
+rocblas_status rocsolver_unpack_interleaved_batched_impl(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                                         T *A, const rocblas_int lda,
+                                                         T *B, const rocblas_int ldb, const rocblas_stride strideB,
+                                                         const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_interleave_argCheck(m,n,lda,ldb,A,B,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // execution
+    return rocsolver_interleave_template<false,T>(handle,m,n,B,ldb,strideB,A,lda,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 float *A, const rocblas_int lda, const rocblas_stride strideA, float *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pack_interleaved_batched_impl<float>(handle, m, n, A, lda, strideA, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 double *A, const rocblas_int lda, const rocblas_stride strideA, double *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pack_interleaved_batched_impl<double>(handle, m, n, A, lda, strideA, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_float_complex *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pack_interleaved_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, strideA, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_double_complex *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pack_interleaved_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, strideA, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sunpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 float *A, const rocblas_int lda, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count)
+{
+    return rocsolver_unpack_interleaved_batched_impl<float>(handle, m, n, A, lda, B, ldb, strideB, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dunpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 double *A, const rocblas_int lda, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count)
+{
+    return rocsolver_unpack_interleaved_batched_impl<double>(handle, m, n, A, lda, B, ldb, strideB, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cunpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, rocblas_float_complex *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count)
+{
+    return rocsolver_unpack_interleaved_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, B, ldb, strideB, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zunpack_interleaved_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count)
+{
+    return rocsolver_unpack_interleaved_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, B, ldb, strideB, batch_count);
+}
+
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_INTERLEAVE_HPP
+#define ROCLAPACK_INTERLEAVE_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** INTERLEAVE_KERNEL copies the m-by-n matrices of a batch between the strided layout 
+    (entry (i,j) of instance b in S[i + j*lds + b*strideS]) and the interleaved layout
+    (entry (i,j) of instance b in I[b + (i + j*ldi)*batch_count]). The threads of a block 
+    take consecutive instances, so the accesses to the interleaved matrix are coalesced. **/
+template <bool PACK, typename T>
+__global__ void interleave_kernel(const rocblas_int m, const rocblas_int n,
+                                  T* S, const rocblas_int lds, const rocblas_stride strideS,
+                                  T* I, const rocblas_int ldi, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int i = hipBlockIdx_y;
+    int j = hipBlockIdx_z;
+
+    if (b < batch_count) {
+        T* s = S + b*strideS + i + size_t(j)*lds;
+        T* v = I + b + (i + size_t(j)*ldi) * batch_count;
+        if (PACK)
+            *v = *s;
+        else
+            *s = *v;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_interleave_argCheck(const rocblas_int m, const rocblas_int n, const rocblas_int lda,
+                                             const rocblas_int ldb, T A, T B, const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if (m < 0 || n < 0 || lda < m || ldb < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if ((m*n*batch_count && !A) || (m*n*batch_count && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool PACK, typename T>
+rocblas_status rocsolver_interleave_template(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                             T* S, const rocblas_int lds, const rocblas_stride strideS,
+                                             T* I, const rocblas_int ldi, const rocblas_int batch_count)
+{
+    // quick return
+    if (m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(interleave_kernel<PACK,T>,dim3(blocks,m,n),dim3(BLOCKSIZE),0,stream,
+                       m,n,S,lds,strideS,I,ldi,batch_count);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_INTERLEAVE_HPP */
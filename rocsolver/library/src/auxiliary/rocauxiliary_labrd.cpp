@@ -29,25 +29,28 @@ rocblas_status rocsolver_labrd_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     size_t size_4;  //size of cache for norms
     rocsolver_labrd_getMemorySize<T,false>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4);
+
     void *scalars, *work, *workArr, *norms;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&norms,size_4);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !norms))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
+    norms = mem[2];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -68,10 +71,6 @@ rocblas_status rocsolver_labrd_impl(rocblas_handle handle, const rocblas_int m,
                                          (T**)workArr,
                                          (T*)norms);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(norms);
     return status;
 }
 
@@ -22,7 +22,8 @@ rocblas_status rocsolver_lacgv_impl(rocblas_handle handle, const rocblas_int n,
 
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
 
     // execution
     return rocsolver_lacgv_template<T>(handle,
@@ -25,23 +25,26 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
     rocblas_int batch_count=1;
     
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     rocsolver_larf_getMemorySize<T,false>(side,m,n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE    
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3);
+
     void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    rocsolver_device_malloc mem(handle,size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -60,9 +63,6 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
                                       (T*)work,
                                       (T**)workArr);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
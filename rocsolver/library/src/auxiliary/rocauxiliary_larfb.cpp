@@ -32,12 +32,15 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side si
     size_t size_2;  //size of array of pointers to workspace
     rocsolver_larfb_getMemorySize<T,false>(side,m,n,k,batch_count,&size_1,&size_2);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_1,size_2);
+
     void *work, *workArr;
-    hipMalloc(&work,size_1);
-    hipMalloc(&workArr,size_2);
-    if ((size_1 && !work) || (size_2 && !workArr))
+    rocsolver_device_malloc mem(handle,size_1,size_2);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
 
     //  execution
     rocblas_status status = 
@@ -56,8 +59,6 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side si
                                                   (T*)work,
                                                   (T**)workArr);
 
-    hipFree(work);
-    hipFree(workArr);
     return status;
 
 }
@@ -51,6 +51,55 @@ __global__ void addmatA1(const rocblas_int ldw, const rocblas_int order, U A, co
     }
 }
 
+/** LARFB_TRMM computes in place W = op(M) * W (left side) or W = W * op(M) (right side)
+    where M is the k-by-k triangular matrix in the first rows and columns of the matrix
+    described by M, shiftM, ldm and strideM, and W is the ldw-by-order matrix in work.
+    Each thread takes care of one column (left side) or one row (right side) of W. **/
+template <typename T, typename U>
+__global__ void larfb_trmm(const rocblas_side side, const rocblas_fill uplo, const rocblas_operation trans, 
+                           const rocblas_diagonal diag, const rocblas_int ldw, const rocblas_int order, 
+                           U M, const rocblas_int shiftM, const rocblas_int ldm, const rocblas_stride strideM, T* work) 
+{
+    const auto b = hipBlockIdx_y;
+    const auto t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const bool left = (side == rocblas_side_left);
+    const rocblas_int k = left ? ldw : order;
+    const rocblas_int nv = left ? order : ldw;
+
+    if (t < nv) {
+        T *Mp, *x;
+        Mp = load_ptr_batch<T>(M,b,shiftM,strideM);
+        x = work + b*rocblas_stride(ldw)*order + (left ? t*ldw : t);
+        const rocblas_int incx = left ? 1 : ldw;
+
+        // the vector x is multiplied by E = op(M) (left side) or E = op(M)**T (right side).
+        // Element (i,l) of E is element (i,l) of M, or element (l,i) if tr is true
+        const bool tr = (trans != rocblas_operation_none) == left;
+        const bool cj = (trans == rocblas_operation_conjugate_transpose);
+        const bool upper = (uplo == rocblas_fill_upper) != tr;
+        const bool unit = (diag == rocblas_diagonal_unit);
+
+        // if E is upper triangular, the new x[i] only depends on x[l] with l >= i 
+        // (lower triangular: l <= i), so the entries can be overwritten in that order
+        for (rocblas_int ii = 0; ii < k; ++ii) {
+            rocblas_int i = upper ? ii : k - 1 - ii;
+            rocblas_int l0 = upper ? i : 0;
+            rocblas_int l1 = upper ? k : i + 1;
+            T e, sum = 0;
+            for (rocblas_int l = l0; l < l1; ++l) {
+                if (l == i && unit) 
+                    e = 1;
+                else {
+                    e = tr ? Mp[l + i*ldm] : Mp[i + l*ldm];
+                    if (cj) e = conj(e);
+                }
+                sum += e * x[l*incx];
+            }
+            x[i*incx] = sum;
+        }
+    }
+}
+
 template <typename T, bool BATCHED>
 void rocsolver_larfb_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
                                    size_t *size_1, size_t *size_2)
@@ -133,7 +182,6 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
-    T *Vp, *Fp;
 
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
@@ -144,15 +192,6 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     T minone = -1;               
     T one = 1;               
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRMM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* VV[batch_count];
-        hipMemcpy(VV, V, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* VV = V;
-    #endif
-
     //determine the side, size of workspace
     //and whether V is trapezoidal
     bool trap;
@@ -191,13 +230,13 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     }
     rocblas_stride strideW = rocblas_stride(ldw)*order;
 
-    // **** TRMM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED ****
-
     //copy A1 to work
     rocblas_int blocksx = (order - 1)/32 + 1;
     rocblas_int blocksy = (ldw - 1)/32 + 1;
     hipLaunchKernelGGL(copymatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
+
+    // the triangular products are computed in place with one thread per column/row of work
+    rocblas_int blockst = ((leftside ? order : ldw) - 1)/BLOCKSIZE + 1;
     
     // BACKWARD DIRECTION TO BE IMPLEMENTED...
     rocblas_fill uploT = rocblas_fill_upper;
@@ -208,10 +247,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1' * A1, or
     //   or 
     // A1 * V1
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,&one,Vp,ldv,(work + b*strideW),ldw);
-    }
+    hipLaunchKernelGGL(larfb_trmm<T>,dim3(blockst,batch_count),dim3(BLOCKSIZE),0,stream,
+                       side,uploV,transp,rocblas_diagonal_unit,ldw,order,V,shiftV,ldv,strideV,work);
 
     // compute:
     // V1' * A1 + V2' * A2 
@@ -237,10 +274,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T)    
-    for (int b=0;b<batch_count;++b) {
-        Fp = load_ptr_batch<T>(F,b,shiftF,strideF);
-        rocblas_trmm(handle,side,uploT,transt,rocblas_diagonal_non_unit,ldw,order,&one,Fp,ldf,(work + b*strideW),ldw);
-    }
+    hipLaunchKernelGGL(larfb_trmm<T>,dim3(blockst,batch_count),dim3(BLOCKSIZE),0,stream,
+                       side,uploT,transt,rocblas_diagonal_non_unit,ldw,order,F,shiftF,ldf,strideF,work);
 
     // compute:
     // A2 - V2 * trans(T) * (V1' * A1 + V2' * A2)
@@ -271,10 +306,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1 * trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T) * V1'    
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,&one,Vp,ldv,(work + b*strideW),ldw);
-    }
+    hipLaunchKernelGGL(larfb_trmm<T>,dim3(blockst,batch_count),dim3(BLOCKSIZE),0,stream,
+                       side,uploV,transp,rocblas_diagonal_unit,ldw,order,V,shiftV,ldv,strideV,work);
     
     // compute:
     // A1 - V1 * trans(T) * (V1' * A1 + V2' * A2)
@@ -26,12 +26,15 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
     size_t size_2;  //size of workspace
     rocsolver_larfg_getMemorySize<T>(n,batch_count,&size_1,&size_2);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_1,size_2);
+
     void *norms, *work;
-    hipMalloc(&norms,size_1);
-    hipMalloc(&work, size_2);
-    if (!norms || (size_2 && !work)) 
+    rocsolver_device_malloc mem(handle,size_1,size_2);
+    if (!mem)
         return rocblas_status_memory_error;
+    norms = mem[0];
+    work = mem[1];
 
     // execution
     rocblas_status status =
@@ -46,8 +49,6 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
                                       (T*)norms,
                                       (T*)work);
 
-    hipFree(norms);
-    hipFree(work);
     return status;
 }
 
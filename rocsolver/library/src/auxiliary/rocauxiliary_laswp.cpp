@@ -24,7 +24,8 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle, const rocblas_int n,
     
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
 
     // execution 
     return rocsolver_laswp_template<T>(handle,n,
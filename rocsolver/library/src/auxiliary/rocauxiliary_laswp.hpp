@@ -13,21 +13,54 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+/** LASWP_KERNEL applies all the interchanges k1 to k2 (in the order given by incx) with a
+    single launch. Every thread owns a column of the matrix and applies the whole sequence of 
+    interchanges to it; the pivot indices are staged in shared memory (by chunks of 
+    LASWP_BLOCKSIZE) so that they are read only once per block. **/
 template <typename T, typename U>
-__global__ void laswp_kernel(const rocblas_int n, U AA, const rocblas_int shiftA,
-                            const rocblas_int lda, const rocblas_stride stride, const rocblas_int i, const rocblas_int k1,
-                            const rocblas_int *ipivA, const rocblas_int shiftP, const rocblas_stride strideP, const rocblas_int incx) {
+__global__ void __launch_bounds__(LASWP_BLOCKSIZE)
+laswp_kernel(const rocblas_int n, U AA, const rocblas_int shiftA,
+             const rocblas_int lda, const rocblas_stride stride, const rocblas_int k1, const rocblas_int k2,
+             const rocblas_int *ipivA, const rocblas_int shiftP, const rocblas_stride strideP, const rocblas_int incx) {
 
     int id = hipBlockIdx_y;
+    int tid = hipThreadIdx_x;
+    int j = hipBlockIdx_x * hipBlockDim_x + tid;
 
     //shiftP must be used so that ipiv[k1] is the desired first index of ipiv
     const rocblas_int *ipiv = ipivA + id*strideP + shiftP;
-    rocblas_int exch = ipiv[k1 + (i - k1) * incx - 1];
-
-    //will exchange rows i and exch if they are not the same
-    if (exch != i) {
-        T* A = load_ptr_batch(AA,id,shiftA,stride);
-        swap(n, A+i-1, lda, A+exch-1, lda);  //row indices are base-1 from the API
+    T* A = load_ptr_batch(AA,id,shiftA,stride);
+    if (j < n)
+        A += j * rocblas_stride(lda);
+
+    __shared__ rocblas_int sipiv[LASWP_BLOCKSIZE];
+    rocblas_int npiv = k2 - k1 + 1;
+    rocblas_int inc = incx < 0 ? -incx : incx;
+
+    for (rocblas_int p0 = 0; p0 < npiv; p0 += LASWP_BLOCKSIZE) {
+        rocblas_int np = min(LASWP_BLOCKSIZE, npiv - p0);
+        
+        // read the next chunk of pivots (in the order they are applied)
+        if (tid < np) {
+            rocblas_int i = incx < 0 ? k2 - p0 - tid : k1 + p0 + tid;
+            sipiv[tid] = ipiv[k1 + (i - k1) * inc - 1];
+        }
+        __syncthreads();
+
+        //will exchange rows i and exch if they are not the same
+        //(row indices are base-1 from the API)
+        if (j < n) {
+            for (rocblas_int p = 0; p < np; ++p) {
+                rocblas_int i = incx < 0 ? k2 - p0 - p : k1 + p0 + p;
+                rocblas_int exch = sipiv[p];
+                if (exch != i) {
+                    T orig = A[i - 1];
+                    A[i - 1] = A[exch - 1];
+                    A[exch - 1] = orig;
+                }
+            }
+        }
+        __syncthreads();
     }
 }
 
@@ -61,19 +94,6 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int
     if (n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
-    rocblas_int start, end, inc;
-    if (incx < 0) {
-        start = k2;
-        end = k1 - 1;
-        inc = -1;
-        incx = -incx;
-    } 
-    else {
-        start = k1;
-        end = k2 + 1;
-        inc = 1;
-    }
-
     rocblas_int blocksPivot = (n - 1) / LASWP_BLOCKSIZE + 1;
     dim3 gridPivot(blocksPivot, batch_count, 1);
     dim3 threads(LASWP_BLOCKSIZE, 1, 1);
@@ -81,10 +101,9 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    for (rocblas_int i = start; i != end; i += inc) {
-        hipLaunchKernelGGL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA,
-                           lda, strideA, i, k1, ipiv, shiftP, strideP, incx);
-    }
+    // all the interchanges are applied by a single kernel
+    hipLaunchKernelGGL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA,
+                       lda, strideA, k1, k2, ipiv, shiftP, strideP, incx);
 
     return rocblas_status_success;
 
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct rocsolver_device_memory_backend : public rocsolver_memory_backend
+    {
+        void* allocate(size_t size) override
+        {
+            void* ptr;
+            return hipMalloc(&ptr, size) == hipSuccess ? ptr : nullptr;
+        }
+
+        void deallocate(void* ptr) override
+        {
+            hipFree(ptr);
+        }
+
+        bool upload(void* dst, const void* src, size_t size) override
+        {
+            return hipMemcpy(dst, src, size, hipMemcpyHostToDevice) == hipSuccess;
+        }
+    };
+
+    using handle_map = std::unordered_map<rocblas_handle, std::unique_ptr<rocsolver_handle_data>>;
+
+    // the map and its mutex are never destroyed so that handles released
+    // during static destruction are still safe
+    handle_map& get_map()
+    {
+        static handle_map* map = new handle_map;
+        return *map;
+    }
+
+    // shared default data of each device (they live as long as the process)
+    std::unordered_map<int, std::unique_ptr<rocsolver_handle_data>>& get_defaults()
+    {
+        static auto* defaults = new std::unordered_map<int, std::unique_ptr<rocsolver_handle_data>>;
+        return *defaults;
+    }
+
+    std::mutex& get_mutex()
+    {
+        static std::mutex* mutex = new std::mutex;
+        return *mutex;
+    }
+
+    // incremented (under the mutex) every time the data of a handle is created or released,
+    // so that the threads know when their last lookup is no longer valid
+    std::atomic<unsigned long long>& get_generation()
+    {
+        static auto* generation = new std::atomic<unsigned long long>(0);
+        return *generation;
+    }
+
+    // last lookup of a thread
+    struct handle_lookup
+    {
+        rocblas_handle handle = nullptr;
+        unsigned long long generation = 0;
+        rocsolver_handle_data* data = nullptr;
+    };
+
+    // returns the shared default data of the current device, created the first time
+    // (with its memory cache). The table of constants is created here, under the mutex, 
+    // as the shared data is not modified elsewhere.
+    rocsolver_handle_data* get_default_data()
+    {
+        int device = 0;
+        if (hipGetDevice(&device) != hipSuccess)
+            device = 0;
+        std::unique_ptr<rocsolver_handle_data>& data = get_defaults()[device];
+        if (!data)
+        {
+            data.reset(new rocsolver_handle_data);
+            data->backend.reset(new rocsolver_device_memory_backend);
+            data->arena.reset(new rocsolver_memory_arena(data->backend.get()));
+            data->shared = true;
+        }
+        if (!data->constants)
+            rocsolver_upload_constants(data.get());
+        return data.get();
+    }
+}
+
+rocsolver_handle_data* rocsolver_get_handle_data(rocblas_handle handle)
+{
+    // every function looks up its handle, usually the same one as in the previous call
+    // of the thread: the last lookup is reused (without the mutex) while no data has been 
+    // created or released since. (The default data is the one of the device that was
+    // current in the lookup: a handle is used on the device where it was created)
+    static thread_local handle_lookup last;
+    unsigned long long generation = get_generation().load(std::memory_order_acquire);
+    if (last.data && last.handle == handle && last.generation == generation)
+        return last.data;
+
+    rocsolver_handle_data* data;
+    {
+        std::lock_guard<std::mutex> lock(get_mutex());
+        handle_map& map = get_map();
+        auto it = map.find(handle);
+        data = it != map.end() ? it->second.get() : get_default_data();
+    }
+
+    // (if the data changed after the generation was read, the next call looks it up again;
+    // the default data is not remembered until its table of constants has been created)
+    if (!data->shared || data->constants)
+    {
+        last.handle = handle;
+        last.generation = generation;
+        last.data = data;
+    }
+    return data;
+}
+
+rocsolver_handle_data* rocsolver_create_handle_data(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(get_mutex());
+    std::unique_ptr<rocsolver_handle_data>& data = get_map()[handle];
+    if (!data)
+    {
+        data.reset(new rocsolver_handle_data);
+        data->backend.reset(new rocsolver_device_memory_backend);
+        data->arena.reset(new rocsolver_memory_arena(data->backend.get()));
+        get_generation().fetch_add(1, std::memory_order_release);
+    }
+    return data.get();
+}
+
+rocsolver_handle_data* rocsolver_find_handle_data(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(get_mutex());
+    handle_map& map = get_map();
+    auto it = map.find(handle);
+    return it == map.end() ? nullptr : it->second.get();
+}
+
+rocsolver_side_stream* rocsolver_get_side_stream(rocsolver_handle_data* data)
+{
+    if (data->side)
+        return data->side.get();
+    if (data->capture_mode || data->shared)
+        return nullptr;
+
+    std::shared_ptr<rocsolver_side_stream> side(new rocsolver_side_stream, [](rocsolver_side_stream* s) {
+        if (s->stream)
+            hipStreamDestroy(s->stream);
+        if (s->fork)
+            hipEventDestroy(s->fork);
+        if (s->join)
+            hipEventDestroy(s->join);
+        delete s;
+    });
+    if (hipStreamCreateWithFlags(&side->stream, hipStreamNonBlocking) != hipSuccess
+       || hipEventCreateWithFlags(&side->fork, hipEventDisableTiming) != hipSuccess
+       || hipEventCreateWithFlags(&side->join, hipEventDisableTiming) != hipSuccess)
+        return nullptr;
+
+    data->side = side;
+    return side.get();
+}
+
+rocsolver_host_panel* rocsolver_get_host_panel(rocsolver_handle_data* data, size_t size)
+{
+    // (the worker threads are kept alive between calls)
+    int nworkers = std::max(data->hybrid_threads - 1, 0);
+    if (data->host_panel && data->host_panel->size >= size) {
+        rocsolver_host_panel* panel = data->host_panel.get();
+        if (!panel->pool || panel->pool->size() != nworkers)
+            panel->pool.reset(new host_lu_thread_pool(nworkers));
+        return panel;
+    }
+    if (data->capture_mode || data->shared)
+        return nullptr;
+
+    // (the previous buffers, if any, are released first)
+    data->host_panel.reset();
+    std::shared_ptr<rocsolver_host_panel> panel(new rocsolver_host_panel, [](rocsolver_host_panel* p) {
+        for (int i = 0; i < 2; ++i)
+        {
+            if (p->buffer[i])
+                hipHostFree(p->buffer[i]);
+            if (p->ready[i])
+                hipEventDestroy(p->ready[i]);
+        }
+        delete p;
+    });
+    for (int i = 0; i < 2; ++i)
+    {
+        if (hipHostMalloc(&panel->buffer[i], size) != hipSuccess
+           || hipEventCreateWithFlags(&panel->ready[i], hipEventDisableTiming) != hipSuccess)
+            return nullptr;
+    }
+    panel->size = size;
+    panel->pool.reset(new host_lu_thread_pool(nworkers));
+
+    data->host_panel = panel;
+    return panel.get();
+}
+
+void rocsolver_release_handle_data(rocblas_handle handle)
+{
+    std::unique_ptr<rocsolver_handle_data> data;
+    {
+        std::lock_guard<std::mutex> lock(get_mutex());
+        handle_map& map = get_map();
+        auto it = map.find(handle);
+        if (it == map.end())
+            return;
+        data = std::move(it->second);
+        map.erase(it);
+        get_generation().fetch_add(1, std::memory_order_release);
+    }
+}
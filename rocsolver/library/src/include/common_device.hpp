@@ -42,6 +42,62 @@ __device__ void swapvect(const rocblas_int n, T *a, const rocblas_int inca,
     }
 }
 
+/** AABS returns the magnitude used to compare entries when searching for pivots
+    (as in i?amax: |x| for real types and |re(x)| + |im(x)| for complex types) **/
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ __host__ inline T aabs(const T x)
+{
+    return x < 0 ? -x : x;
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ __host__ inline auto aabs(const T x)
+{
+    return aabs(x.real()) + aabs(x.imag());
+}
+
+/** IAMAX_GROUP_LMEM returns the shared memory (in bytes) needed by iamax_group for a
+    block of nthreads threads (it is kept 16-byte aligned so that other arrays can follow) **/
+template <typename S>
+__device__ __host__ inline size_t iamax_group_lmem(const rocblas_int nthreads)
+{
+    return ((nthreads * (sizeof(S) + sizeof(rocblas_int)) - 1) / 16 + 1) * 16;
+}
+
+/** IAMAX_GROUP device function returns the index of the largest value among the candidates
+    (val, idx) of the nthreads threads of a group, using a log-depth tree reduction.
+    Ties are resolved in favour of the smallest index (as in i?amax); a thread without
+    candidate must use a negative val. sval and sidx are shared arrays of size nthreads.
+    All the threads of the block must call it. **/
+template <typename S>
+__device__ rocblas_int iamax_group(const rocblas_int tid, const rocblas_int nthreads, const S val,
+                                   const rocblas_int idx, S *sval, rocblas_int *sidx)
+{
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    rocblas_int half = 1;
+    while (half < nthreads)
+        half <<= 1;
+    for (half >>= 1; half > 0; half >>= 1)
+    {
+        if (tid < half && tid + half < nthreads)
+        {
+            S v = sval[tid + half];
+            rocblas_int i = sidx[tid + half];
+            if (v > sval[tid] || (v == sval[tid] && i < sidx[tid]))
+            {
+                sval[tid] = v;
+                sidx[tid] = i;
+            }
+        }
+        __syncthreads();
+    }
+
+    return sidx[0];
+}
+
 
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
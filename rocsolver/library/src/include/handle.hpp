@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef HANDLE_HPP
+#define HANDLE_HPP
+
+#include <rocblas.h>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include "host_lu.hpp"
+#include "ideal_sizes.hpp"
+#include "memory_arena.hpp"
+
+/*! \brief rocsolver_side_stream is a second stream (and the events to synchronize it with 
+    the handle's stream) used to overlap independent work, e.g. in the look-ahead of getrf.
+******************************************************************************/
+struct rocsolver_side_stream
+{
+    hipStream_t stream = nullptr;
+    hipEvent_t fork = nullptr;  // recorded on the handle's stream, waited by the side stream
+    hipEvent_t join = nullptr;  // recorded on the side stream, waited by the handle's stream
+};
+
+/*! \brief rocsolver_host_panel holds the pinned host buffers (two, to overlap the copies of 
+    a panel with the factorization of the other) used by the hybrid getrf, the events 
+    recorded when the copy of a panel to each buffer has been enqueued, and the worker 
+    threads that factorize the panels with the calling thread.
+******************************************************************************/
+struct rocsolver_host_panel
+{
+    void* buffer[2] = {nullptr, nullptr};
+    size_t size = 0;    // size in bytes of each buffer
+    hipEvent_t ready[2] = {nullptr, nullptr};
+    std::unique_ptr<host_lu_thread_pool> pool;
+};
+
+/*! \brief rocsolver_handle_data holds the state rocSOLVER keeps between calls.
+
+    \details
+    rocblas_handle is opaque to rocSOLVER, so everything the library needs to
+    remember for a given handle (workspace size queries, user provided workspace, ...)
+    is stored here and looked up with the handle as key.
+
+    The data of a handle is only created by the functions that change a setting
+    (rocsolver_set_*, rocsolver_start_workspace_size_query); it is destroyed by 
+    rocsolver_release_handle_resources. The handles without data use the shared default
+    data of the device, that holds the default settings, the table of constants and
+    a memory cache shared by all of them.
+******************************************************************************/
+struct rocsolver_handle_data
+{
+    // true for the shared default data: its settings are never modified by the functions
+    // (no side stream, no host buffers, ...) and its arena is only used under arena_mutex
+    bool shared = false;
+
+    // workspace size query mode
+    bool size_query = false;
+    size_t query_size = 0;
+
+    // device workspace provided by the user
+    void* workspace = nullptr;
+    size_t workspace_size = 0;
+
+    // cache of device memory used for the workspace when the user does not provide it
+    // (the backend must outlive the arena; without arena, the workspace of every call
+    //  is obtained from and returned to the backend)
+    std::unique_ptr<rocsolver_memory_backend> backend;
+    std::unique_ptr<rocsolver_memory_arena> arena;
+    std::mutex arena_mutex;
+
+    // device table with the constants {-1, 0, 1} for every precision
+    void* constants = nullptr;
+
+    // stream capture mode: functions must only enqueue work on the stream
+    // (no allocations, no synchronous copies)
+    bool capture_mode = false;
+
+    // memory budget for the workspace of batched functions (0 means no budget);
+    // larger batches are processed in chunks of at least min_chunk instances
+    size_t memory_budget = 0;
+    rocblas_int min_chunk = 1;
+    rocblas_int last_chunk = 0;
+
+    // look-ahead of blocked getrf (one panel ahead), and the side stream 
+    // where the next panel is factorized (created on first use)
+    bool lookahead = false;
+    std::shared_ptr<rocsolver_side_stream> side;
+
+    // tournament pivoting (instead of partial pivoting) for the tall-skinny panels of getrf
+    bool tournament_pivoting = false;
+
+    // number of host threads of the hybrid getrf (0 disables it), and the pinned 
+    // buffers where the panels are factorized (allocated on first use)
+    rocblas_int hybrid_threads = 0;
+    std::shared_ptr<rocsolver_host_panel> host_panel;
+
+    // maximum number of refinement iterations of the mixed precision solvers
+    rocblas_int refinement_iterations = GESV_IR_MAX_ITER;
+
+    ~rocsolver_handle_data()
+    {
+        if (constants)
+            backend->deallocate(constants);
+    }
+};
+
+// returns the data associated with the handle, or the shared default data of the
+// current device if there is none (the default data must not be modified)
+rocsolver_handle_data* rocsolver_get_handle_data(rocblas_handle handle);
+
+// returns the data associated with the handle, created the first time
+// (only for the functions that change a setting of the handle)
+rocsolver_handle_data* rocsolver_create_handle_data(rocblas_handle handle);
+
+// returns the data associated with the handle, or nullptr if there is none
+rocsolver_handle_data* rocsolver_find_handle_data(rocblas_handle handle);
+
+// releases the data associated with the handle (if any)
+void rocsolver_release_handle_data(rocblas_handle handle);
+
+// returns the side stream of the handle, created the first time. Returns nullptr
+// if it could not be created (or if it does not exist yet and the handle is in capture mode,
+// or if the data is the shared default)
+rocsolver_side_stream* rocsolver_get_side_stream(rocsolver_handle_data* data);
+
+// returns the pinned host buffers of the handle, with at least size bytes each (they are 
+// reallocated if they are smaller), and the pool with hybrid_threads - 1 workers (recreated if 
+// the number of threads changed). Returns nullptr if they could not be allocated
+// (or if they must be allocated and the handle is in capture mode, or if the data is the shared default)
+rocsolver_host_panel* rocsolver_get_host_panel(rocsolver_handle_data* data, size_t size);
+
+// offsets (in bytes) of the constants of each precision in the table
+template <typename T>
+struct rocsolver_constants_offset;
+template <>
+struct rocsolver_constants_offset<float>
+{
+    static constexpr size_t value = 0;
+};
+template <>
+struct rocsolver_constants_offset<double>
+{
+    static constexpr size_t value = 64;
+};
+template <>
+struct rocsolver_constants_offset<rocblas_float_complex>
+{
+    static constexpr size_t value = 128;
+};
+template <>
+struct rocsolver_constants_offset<rocblas_double_complex>
+{
+    static constexpr size_t value = 192;
+};
+#define ROCSOLVER_CONSTANTS_SIZE 256
+
+template <typename T>
+void rocsolver_fill_constants(char* table)
+{
+    T* sca = (T*)(table + rocsolver_constants_offset<T>::value);
+    sca[0] = -1;
+    sca[1] = 0;
+    sca[2] = 1;
+}
+
+// uploads the table of constants of the data; returns false if it could not be created
+inline bool rocsolver_upload_constants(rocsolver_handle_data* data)
+{
+    char table[ROCSOLVER_CONSTANTS_SIZE] = {};
+    rocsolver_fill_constants<float>(table);
+    rocsolver_fill_constants<double>(table);
+    rocsolver_fill_constants<rocblas_float_complex>(table);
+    rocsolver_fill_constants<rocblas_double_complex>(table);
+
+    void* constants = data->backend->allocate(ROCSOLVER_CONSTANTS_SIZE);
+    if (!constants)
+        return false;
+    if (!data->backend->upload(constants, table, ROCSOLVER_CONSTANTS_SIZE))
+    {
+        data->backend->deallocate(constants);
+        return false;
+    }
+    data->constants = constants;
+    return true;
+}
+
+/*! \brief creates the table of constants of the handle (if it does not exist yet).
+
+    \details
+    All the precisions are uploaded at once; this is the only synchronous copy
+    done by the library and it happens once per handle (or once per device for the
+    handles without data). It is not allowed in capture mode (the table must be 
+    created before the mode is turned on). The table of the shared default data is 
+    created with the data.
+    Returns false if the table could not be created.
+******************************************************************************/
+inline bool rocsolver_init_constants(rocsolver_handle_data* data)
+{
+    if (data->constants)
+        return true;
+    if (data->capture_mode || data->shared)
+        return false;
+    return rocsolver_upload_constants(data);
+}
+
+// turns the capture mode on or off. The table of constants is created when the mode
+// is turned on; returns false (and leaves the mode unchanged) if it could not be created.
+inline bool rocsolver_set_capture(rocsolver_handle_data* data, bool enable)
+{
+    if (enable && !data->capture_mode && !rocsolver_init_constants(data))
+        return false;
+    data->capture_mode = enable;
+    return true;
+}
+
+// returns a device array with the constants {-1, 0, 1} of type T.
+// The table is uploaded the first time it is requested for the handle;
+// returns nullptr if it could not be created.
+template <typename T>
+T* rocsolver_get_constants(rocsolver_handle_data* data)
+{
+    if (!rocsolver_init_constants(data))
+        return nullptr;
+    return (T*)((char*)data->constants + rocsolver_constants_offset<T>::value);
+}
+
+template <typename T>
+T* rocsolver_get_constants(rocblas_handle handle)
+{
+    return rocsolver_get_constants<T>(rocsolver_get_handle_data(handle));
+}
+
+#endif
@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef HOST_LU_HPP
+#define HOST_LU_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// panels with at most this many columns are factorized column by column
+#define HOST_LU_SWITCHSIZE 8
+// minimum number of rows given to every thread (smaller updates are not split)
+#define HOST_LU_MIN_ROWS 512
+
+/*******************************************************************************
+ *! \brief   host panel engine of the hybrid getrf: LU factorization with partial
+ *           pivoting of tall-skinny panels on the host, with several threads.
+ *           It does not depend on the device and can be tested on its own.
+ ******************************************************************************/
+
+/** host_lu_abs1 returns |re(x)| + |im(x)| (as i?amax) **/
+inline float host_lu_abs1(const float x)
+{
+    return std::abs(x);
+}
+
+inline double host_lu_abs1(const double x)
+{
+    return std::abs(x);
+}
+
+template <typename T>
+inline auto host_lu_abs1(const T& x) -> decltype(std::abs(x.real()) + std::abs(x.imag()))
+{
+    return std::abs(x.real()) + std::abs(x.imag());
+}
+
+/*! \brief host_lu_thread_pool keeps the worker threads of the panel engine alive between 
+    calls, so that the parallel updates do not create and join threads for every column.
+
+    \details
+    run(nparts, task) calls task(p) for p = 0 : nparts-1 (nparts <= size() + 1): the calling 
+    thread runs part 0 and the workers the others, and it returns when all of them are done.
+    Only one thread at a time may call run.
+******************************************************************************/
+class host_lu_thread_pool
+{
+public:
+    explicit host_lu_thread_pool(const int nworkers)
+    {
+        for (int i = 0; i < nworkers; ++i)
+            workers.emplace_back([this] { work(); });
+    }
+
+    ~host_lu_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv_work.notify_all();
+        for (std::thread& w : workers)
+            w.join();
+    }
+
+    host_lu_thread_pool(const host_lu_thread_pool&) = delete;
+    host_lu_thread_pool& operator=(const host_lu_thread_pool&) = delete;
+
+    int size() const
+    {
+        return int(workers.size());
+    }
+
+    void run(const int nparts, const std::function<void(int)>& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = &task;
+            next = 1;
+            total = nparts;
+            pending = nparts - 1;
+        }
+        cv_work.notify_all();
+
+        task(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cv_done.wait(lock, [this] { return pending == 0; });
+        current = nullptr;
+    }
+
+private:
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv_work.wait(lock, [this] { return stop || next < total; });
+            if (stop)
+                return;
+
+            int p = next++;
+            const std::function<void(int)>& task = *current;
+            lock.unlock();
+            task(p);
+            lock.lock();
+
+            if (--pending == 0)
+                cv_done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable cv_work;    // new parts to run (or stop)
+    std::condition_variable cv_done;    // all the parts of the workers are done
+    const std::function<void(int)>* current = nullptr;
+    int next = 0;       // next part to run
+    int total = 0;      // number of parts of the current run
+    int pending = 0;    // parts of the workers not finished yet
+    bool stop = false;
+};
+
+/** host_lu_parallel_for calls f(begin, end) on contiguous ranges of [i0, i1) (with at least
+    HOST_LU_MIN_ROWS rows each), using the calling thread and the workers of pool (if any) **/
+template <typename F>
+void host_lu_parallel_for(host_lu_thread_pool* pool, const ptrdiff_t i0, const ptrdiff_t i1, F f)
+{
+    ptrdiff_t n = i1 - i0;
+    ptrdiff_t nt = std::min<ptrdiff_t>(pool ? pool->size() + 1 : 1, n / HOST_LU_MIN_ROWS);
+    if (nt <= 1) {
+        if (n > 0)
+            f(i0, i1);
+        return;
+    }
+
+    ptrdiff_t chunk = (n - 1) / nt + 1;
+    pool->run(int(nt), [&](int p) {
+        ptrdiff_t b = i0 + p * chunk;
+        if (b < i1)
+            f(b, std::min(b + chunk, i1));
+    });
+}
+
+/** host_lu_laswp interchanges rows k and ipiv[k]-1 of the n columns of A, for k = k1 : k2-1 **/
+template <typename T>
+void host_lu_laswp(const ptrdiff_t n, T* A, const ptrdiff_t lda, const ptrdiff_t k1, const ptrdiff_t k2,
+                   const int* ipiv)
+{
+    for (ptrdiff_t k = k1; k < k2; ++k) {
+        ptrdiff_t p = ipiv[k] - 1;
+        if (p != k) {
+            for (ptrdiff_t j = 0; j < n; ++j)
+                std::swap(A[k + j*lda], A[p + j*lda]);
+        }
+    }
+}
+
+/** host_lu_unblocked factorizes the m-by-n panel A column by column (right-looking).
+    Returns the info of the panel **/
+template <typename T>
+int host_lu_unblocked(const ptrdiff_t m, const ptrdiff_t n, T* A, const ptrdiff_t lda, int* ipiv,
+                      const bool pivot, host_lu_thread_pool* pool)
+{
+    int info = 0;
+    ptrdiff_t dim = std::min(m, n);
+
+    for (ptrdiff_t j = 0; j < dim; ++j) {
+        // find pivot (the first of the largest entries, as i?amax)
+        ptrdiff_t p = j;
+        if (pivot) {
+            auto best = host_lu_abs1(A[j + j*lda]);
+            for (ptrdiff_t i = j + 1; i < m; ++i) {
+                auto v = host_lu_abs1(A[i + j*lda]);
+                if (v > best) {
+                    best = v;
+                    p = i;
+                }
+            }
+            ipiv[j] = int(p + 1);   //use Fortran 1-based indexing
+
+            // swap rows
+            if (p != j) {
+                for (ptrdiff_t c = 0; c < n; ++c)
+                    std::swap(A[j + c*lda], A[p + c*lda]);
+            }
+        }
+
+        // check singularity
+        T pivot_value = A[j + j*lda];
+        if (pivot_value == T(0)) {
+            if (info == 0)
+                info = int(j + 1);
+            pivot_value = T(1);
+        } else {
+            pivot_value = T(1) / pivot_value;
+        }
+
+        // scale current column and update trailing columns
+        host_lu_parallel_for(pool, j + 1, m, [=](ptrdiff_t i0, ptrdiff_t i1) {
+            for (ptrdiff_t i = i0; i < i1; ++i) {
+                T l = A[i + j*lda] * pivot_value;
+                A[i + j*lda] = l;
+                for (ptrdiff_t c = j + 1; c < n; ++c)
+                    A[i + c*lda] -= l * A[j + c*lda];
+            }
+        });
+    }
+
+    return info;
+}
+
+/** host_lu_recursive factorizes the m-by-n panel A (n <= m) splitting the columns in halves,
+    as getf2_recursive on the device. Returns the info of the panel **/
+template <typename T>
+int host_lu_recursive(const ptrdiff_t m, const ptrdiff_t n, T* A, const ptrdiff_t lda, int* ipiv,
+                      const bool pivot, host_lu_thread_pool* pool)
+{
+    if (n <= HOST_LU_SWITCHSIZE)
+        return host_lu_unblocked(m, n, A, lda, ipiv, pivot, pool);
+
+    ptrdiff_t n1 = n / 2;
+    ptrdiff_t n2 = n - n1;
+    T* A12 = A + n1*lda;
+    T* A21 = A + n1;
+    T* A22 = A12 + n1;
+
+    // factorize left half [A11; A21]
+    int info = host_lu_recursive(m, n1, A, lda, ipiv, pivot, pool);
+
+    // apply interchanges to right half
+    if (pivot)
+        host_lu_laswp(n2, A12, lda, 0, n1, ipiv);
+
+    // A12 = inv(L11) * A12
+    for (ptrdiff_t c = 0; c < n2; ++c) {
+        for (ptrdiff_t k = 0; k < n1; ++k) {
+            T t = A12[k + c*lda];
+            for (ptrdiff_t i = k + 1; i < n1; ++i)
+                A12[i + c*lda] -= A[i + k*lda] * t;
+        }
+    }
+
+    // A22 = A22 - A21 * A12 (by blocks of rows)
+    host_lu_parallel_for(pool, 0, m - n1, [=](ptrdiff_t i0, ptrdiff_t i1) {
+        for (ptrdiff_t c = 0; c < n2; ++c) {
+            for (ptrdiff_t k = 0; k < n1; ++k) {
+                T t = A12[k + c*lda];
+                for (ptrdiff_t i = i0; i < i1; ++i)
+                    A22[i + c*lda] -= A21[i + k*lda] * t;
+            }
+        }
+    });
+
+    // factorize right half [A22; A32]
+    int info2 = host_lu_recursive(m - n1, n2, A22, lda, ipiv + n1, pivot, pool);
+    if (info == 0 && info2 > 0)
+        info = int(info2 + n1);
+
+    // adjust pivot indices and apply interchanges of the right half to left half
+    if (pivot) {
+        for (ptrdiff_t k = n1; k < n; ++k)
+            ipiv[k] += int(n1);
+        host_lu_laswp(n1, A, lda, n1, n, ipiv);
+    }
+
+    return info;
+}
+
+/*! \brief rocsolver_host_getrf_panel computes the LU factorization of the m-by-n
+    panel A (column major with leading dimension lda, m >= n) on the host, with the calling
+    thread and the workers of pool (if not null).
+
+    \details
+    The pivots (1-based, relative to the panel) are returned in ipiv if pivot is true.
+    The result is the index (1-based) of the first zero pivot, or 0.
+******************************************************************************/
+template <typename T>
+int rocsolver_host_getrf_panel(const int m, const int n, T* A, const int lda, int* ipiv,
+                               const bool pivot = true, host_lu_thread_pool* pool = nullptr)
+{
+    if (m <= 0 || n <= 0)
+        return 0;
+    return host_lu_recursive<T>(m, std::min(m, n), A, lda, ipiv, pivot, pool);
+}
+
+#endif /* HOST_LU_HPP */
@@ -27,6 +27,27 @@
 #define GETF2_OPTIM_NGRP 16,15,8,8,8,8,8,8,6,6,4,4,4,4,4,4,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2
 #define GETF2_BATCH_OPTIM_MAX_SIZE 2048
 #define GETF2_OPTIM_MAX_SIZE 1024
+#define GETF2_REC_SWITCHSIZE 8
+#define GETF2_TRSM_BLOCKSIZE 32
+#define GETF2_TILED_MAX_SIZE 256
+#define GETF2_TILE_SIZE 16
+#define GETF2_TILED_CHUNK 64
+#define GETF2_FUSED_MAX_SIZE 1024
+#define GETRF_HYBRID_MIN_SIZE 2048
+#define GETRF_OOC_MEMORY_FRACTION 0.9
+
+// getrs
+#define GETRS_BATCH_TRSM_MAX_SIZE 256
+#define GETRS_TRSM_BLOCKSIZE 32
+#define GETRS_SMALL_MAX_SIZE 64
+#define GETRS_SMALL_MAX_NRHS 8
+
+// gesv
+#define GESV_SMALL_MAX_SIZE 64
+
+// gesv_ir
+#define GESV_IR_MAX_ITER 30
+#define GESV_IR_NORM_CHUNK 64 //columns summed by each thread of the row sums of the norm
 
 // getri
 #define GETRI_SWITCHSIZE_MID 64
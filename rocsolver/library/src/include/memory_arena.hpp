@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef MEMORY_ARENA_HPP
+#define MEMORY_ARENA_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// smallest block handed out by the arena (and alignment of the size classes)
+#define ARENA_MIN_BLOCK 256
+
+/*! \brief rocsolver_memory_backend is the interface used by the arena to obtain
+    and release memory.
+
+    \details
+    The device implementation (hipMalloc/hipFree) lives with the handle data;
+    rocsolver_host_memory_backend allows to exercise the arena without a device.
+******************************************************************************/
+struct rocsolver_memory_backend
+{
+    virtual ~rocsolver_memory_backend() = default;
+
+    // returns nullptr if the memory could not be obtained
+    virtual void* allocate(size_t size) = 0;
+    virtual void deallocate(void* ptr) = 0;
+
+    // synchronous copy from host memory; returns false if it failed
+    virtual bool upload(void* dst, const void* src, size_t size) = 0;
+};
+
+struct rocsolver_host_memory_backend : public rocsolver_memory_backend
+{
+    void* allocate(size_t size) override
+    {
+        return std::malloc(size);
+    }
+
+    void deallocate(void* ptr) override
+    {
+        std::free(ptr);
+    }
+
+    bool upload(void* dst, const void* src, size_t size) override
+    {
+        std::memcpy(dst, src, size);
+        return true;
+    }
+};
+
+/*! \brief rocsolver_arena_stats collects the allocation statistics of an arena.
+******************************************************************************/
+struct rocsolver_arena_stats
+{
+    size_t bytes_in_use = 0;        // bytes of the blocks currently handed out
+    size_t peak_bytes_in_use = 0;   // high-water mark of bytes_in_use
+    size_t bytes_reserved = 0;      // bytes obtained from the backend (in use + cached)
+    size_t allocations = 0;         // number of requests served
+    size_t allocations_avoided = 0; // requests served from the cache
+};
+
+/*! \brief rocsolver_memory_arena caches the blocks obtained from a backend.
+
+    \details
+    Requests are rounded up to a size class (four classes per power of two) and
+    released blocks are kept in per-class free lists, so that repeated calls with
+    the same shapes reuse the same blocks without calling the backend.
+
+    The cache follows a high-water-mark policy: when a new block must be obtained from
+    the backend and the reserved memory would exceed the peak usage seen so far, cached
+    blocks of other classes are released first. The arena therefore never holds much
+    more than what the most demanding sequence of calls needed at once.
+
+    Every block remembers the owner that requested it (the stream of the call, for the 
+    device arenas) and, once released, it is only handed out again to the same owner: 
+    the work of a stream may still be using the block, and only the later work of that 
+    stream is ordered after it. (Cached blocks of any owner can be returned to the backend:
+    hipFree waits for the device to be idle)
+******************************************************************************/
+class rocsolver_memory_arena
+{
+    rocsolver_memory_backend* backend;
+    using owned_block = std::pair<void*, const void*>;      // {block, owner}
+    using sized_owner = std::pair<size_t, const void*>;     // {class size, owner}
+    std::map<size_t, std::vector<owned_block>> free_lists;  // class size -> cached blocks
+    std::unordered_map<void*, sized_owner> used;            // block -> {class size, owner}
+    rocsolver_arena_stats stats;
+
+    // releases cached blocks (largest first) until at least 'bytes' have been freed
+    // or the cache is empty. Returns the number of bytes released.
+    size_t release_cached(size_t bytes)
+    {
+        size_t released = 0;
+        for(auto it = free_lists.rbegin(); it != free_lists.rend() && released < bytes; ++it)
+        {
+            std::vector<owned_block>& list = it->second;
+            while(!list.empty() && released < bytes)
+            {
+                backend->deallocate(list.back().first);
+                list.pop_back();
+                released += it->first;
+            }
+        }
+        stats.bytes_reserved -= released;
+        return released;
+    }
+
+public:
+    explicit rocsolver_memory_arena(rocsolver_memory_backend* backend)
+        : backend(backend)
+    {
+    }
+
+    ~rocsolver_memory_arena()
+    {
+        release_cached(stats.bytes_reserved);
+        for(auto& u : used)
+            backend->deallocate(u.first);
+    }
+
+    rocsolver_memory_arena(const rocsolver_memory_arena&) = delete;
+    rocsolver_memory_arena& operator=(const rocsolver_memory_arena&) = delete;
+
+    // size class of a request: the smallest of 2^k, 1.25*2^k, 1.5*2^k, 1.75*2^k
+    // (and multiple of ARENA_MIN_BLOCK) that fits it
+    static size_t size_class(size_t size)
+    {
+        if(size <= ARENA_MIN_BLOCK)
+            return ARENA_MIN_BLOCK;
+
+        size_t p = ARENA_MIN_BLOCK;
+        while(p * 2 < size)
+            p *= 2;
+        size_t step = p / 4 < ARENA_MIN_BLOCK ? ARENA_MIN_BLOCK : p / 4;
+        return (size + step - 1) / step * step;
+    }
+
+    // returns a block of at least size bytes for the given owner, or nullptr if it 
+    // cannot be obtained
+    void* allocate(size_t size, const void* owner = nullptr)
+    {
+        if(!size)
+            return nullptr;
+        size_t csize = size_class(size);
+
+        void* ptr = nullptr;
+        auto it = free_lists.find(csize);
+        if(it != free_lists.end())
+        {
+            // (the most recently released block of the owner)
+            std::vector<owned_block>& list = it->second;
+            for(size_t i = list.size(); i-- > 0;)
+            {
+                if(list[i].second == owner)
+                {
+                    ptr = list[i].first;
+                    list.erase(list.begin() + i);
+                    stats.allocations_avoided++;
+                    break;
+                }
+            }
+        }
+        if(!ptr)
+        {
+            // high-water-mark policy: do not grow beyond what has been needed at once
+            size_t need = stats.bytes_in_use + csize;
+            size_t limit = need > stats.peak_bytes_in_use ? need : stats.peak_bytes_in_use;
+            if(stats.bytes_reserved + csize > limit)
+                release_cached(stats.bytes_reserved + csize - limit);
+
+            ptr = backend->allocate(csize);
+            if(!ptr && stats.bytes_reserved > stats.bytes_in_use)
+            {
+                // out of memory: drop the whole cache and try again
+                release_cached(stats.bytes_reserved);
+                ptr = backend->allocate(csize);
+            }
+            if(!ptr)
+                return nullptr;
+            stats.bytes_reserved += csize;
+        }
+
+        used[ptr] = {csize, owner};
+        stats.allocations++;
+        stats.bytes_in_use += csize;
+        if(stats.bytes_in_use > stats.peak_bytes_in_use)
+            stats.peak_bytes_in_use = stats.bytes_in_use;
+        return ptr;
+    }
+
+    // returns the block to the cache (reserved to its owner)
+    void deallocate(void* ptr)
+    {
+        auto it = used.find(ptr);
+        if(it == used.end())
+            return;
+        free_lists[it->second.first].push_back({ptr, it->second.second});
+        stats.bytes_in_use -= it->second.first;
+        used.erase(it);
+    }
+
+    // releases all the cached blocks back to the backend
+    void trim()
+    {
+        release_cached(stats.bytes_reserved);
+    }
+
+    const rocsolver_arena_stats& get_stats() const
+    {
+        return stats;
+    }
+};
+
+#endif
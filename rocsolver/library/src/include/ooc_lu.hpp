@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef OOC_LU_HPP
+#define OOC_LU_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+/*******************************************************************************
+ *! \brief   slab scheduler of the out-of-core getrf: the matrix lives in host memory
+ *           and is streamed through the device by slabs of columns (left-looking LU).
+ *           The scheduler only decides the order of the transfers and of the computations;
+ *           the work itself is done by a device object, so that it can be tested on the
+ *           host with a stand-in of the device.
+ ******************************************************************************/
+
+/** The device holds three buffers (slots) of m-by-w entries: the slab being factorized,
+    and two buffers where the factored slabs are streamed in turns (double buffering).
+    The transfers are enqueued in a transfer queue and the computations in a compute queue;
+    D must provide:
+
+    load(slot, r0, c0, nc)      transfer rows r0 : m-1 of the columns c0 : c0+nc-1 of the host
+                                matrix to the slot (after the last release of the slot)
+    store(slot, r0, c0, nc)     transfer them back from the slot (after the last release of the slot)
+    acquire(slot)               the computations that follow wait for the last load to the slot
+    release(slot)               the loads and stores that follow wait for the computations
+                                issued so far with the slot
+    swap(nc, k1, k2)            apply the interchanges k1 : k2-1 to the nc columns of the slab
+    update(slot, k0, kw, nc)    update the nc columns of the slab with the factored columns
+                                k0 : k0+kw-1 held by the slot (trsm with their unit lower
+                                triangular block and gemm with the rows below)
+    factor(c0, nc)              factorize rows c0 : m-1 of the nc columns of the slab
+                                (the pivots are kept as global row indices)
+    synchronize()               wait for both queues (the pivots are then available on the host)
+    swap_left(c0, nc, k1, k2)   apply the interchanges k1 : k2-1 to the columns c0 : c0+nc-1
+                                of the host matrix **/
+#define OOC_SLAB 0
+#define OOC_FACTORS 1
+
+/*! \brief rocsolver_ooc_getrf_schedule computes the LU factorization of the m-by-n host
+    matrix of dev, by slabs of w columns.
+
+    \details
+    For every slab, the factored slabs to its left are streamed in and applied to it
+    (interchanges, trsm and gemm), then the slab is factorized and written back.
+    The load of a factored slab overlaps the update with the previous one, and the first
+    factored slab of the next slab is loaded while the current one is factorized.
+    The interchanges of the later slabs are applied to the left columns at the end, on the host.
+******************************************************************************/
+template <typename D>
+void rocsolver_ooc_getrf_schedule(D& dev, const int m, const int n, const int w, const bool pivot)
+{
+    const int dim = std::min(m, n);
+    int b = 0;      // next buffer of factored slabs
+    bool ahead = false;     // the first factored slab was loaded ahead
+
+    for (int c0 = 0; c0 < n; c0 += w) {
+        int nc = std::min(n - c0, w);
+        int kend = std::min(c0, dim);   // number of factored columns to the left
+
+        dev.load(OOC_SLAB, 0, c0, nc);
+        dev.acquire(OOC_SLAB);
+
+        // left-looking update
+        if (kend > 0 && !ahead)
+            dev.load(OOC_FACTORS + b, 0, 0, std::min(kend, w));
+        for (int k0 = 0; k0 < kend; k0 += w, b = 1 - b) {
+            int kw = std::min(kend - k0, w);
+            if (k0 + kw < kend)
+                dev.load(OOC_FACTORS + 1 - b, k0 + kw, k0 + kw, std::min(kend - k0 - kw, w));
+
+            dev.acquire(OOC_FACTORS + b);
+            if (pivot)
+                dev.swap(nc, k0, k0 + kw);
+            dev.update(OOC_FACTORS + b, k0, kw, nc);
+            dev.release(OOC_FACTORS + b);
+        }
+
+        // the next slab starts with the first factored slab
+        // (it can be loaded now unless it is the current one)
+        ahead = c0 > 0 && c0 + nc < n;
+        if (ahead)
+            dev.load(OOC_FACTORS + b, 0, 0, std::min(std::min(c0 + nc, dim), w));
+
+        // factorize and write back
+        if (c0 < dim)
+            dev.factor(c0, nc);
+        dev.release(OOC_SLAB);
+        dev.store(OOC_SLAB, 0, c0, nc);
+    }
+
+    dev.synchronize();
+
+    // interchanges of the later slabs on the columns of L
+    if (pivot) {
+        for (int c0 = 0; c0 < dim; c0 += w) {
+            int kw = std::min(dim - c0, w);
+            if (c0 + kw < dim)
+                dev.swap_left(c0, kw, c0 + kw, dim);
+        }
+    }
+}
+
+/*! \brief rocsolver_ooc_slab_width returns the number of columns of the slabs of the
+    out-of-core getrf of a matrix with n columns, within a device memory budget.
+
+    \details
+    size_of(w) is the device memory (in bytes) needed with slabs of w columns; it grows with w.
+    The result is n if the whole matrix fits, otherwise the largest multiple of step that fits
+    (or the largest width if not even step columns fit). It is 0 if a single column does not fit.
+******************************************************************************/
+template <typename F>
+int rocsolver_ooc_slab_width(const int n, const int step, const size_t budget, F size_of)
+{
+    if (n <= 0 || size_of(n) <= budget)
+        return n;
+
+    // binary search in units of u columns: size_of(lo*u) fits, size_of(hi*u) does not
+    int u = size_of(std::min(step, n)) <= budget ? step : 1;
+    int lo = 0, hi = (n - 1) / u + 1;
+    while (hi - lo > 1) {
+        int mid = lo + (hi - lo) / 2;
+        if (size_of(std::min(mid * u, n)) <= budget)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo * u;
+}
+
+#endif /* OOC_LU_HPP */
@@ -12,6 +12,7 @@ struct rocblas_index_value_t;
 #include "internal/rocblas-exported-proto.hpp"
 #include "helpers.hpp"
 #include "common_device.hpp"
+#include "workspace.hpp"
 
 // iamax
 template <bool ISBATCHED, typename T, typename S, typename U>
@@ -566,6 +567,7 @@ rocblas_status rocblasCall_herk(rocblas_handle    handle,
 
 
 // trsm memory allocator
+// (invA is not allocated if the inverses of the diagonal blocks are supplied)
 template <bool BATCHED, typename T, typename U>
 rocblas_status rocblasCall_trsm_mem(rocblas_handle handle,
                                          rocblas_side   side,
@@ -575,12 +577,13 @@ rocblas_status rocblasCall_trsm_mem(rocblas_handle handle,
                                          void*&         x_temp,
                                          void*&         x_temp_arr,
                                          void*&         invA,
-                                         void*&         invA_arr)
+                                         void*&         invA_arr,
+                                         U              supplied_invA = nullptr,
+                                         rocblas_int    supplied_invA_size = 0)
 {
-    U supplied_invA = nullptr;
     return rocblas_trsm_template_mem<ROCBLAS_TRSM_BLOCK,BATCHED,T>(handle,side,m,n,batch_count,
                                                                    x_temp,x_temp_arr,invA,invA_arr,
-                                                                   cast2constType(supplied_invA),0);
+                                                                   cast2constType(supplied_invA),supplied_invA_size);
 }
 
 // trsm
@@ -606,15 +609,16 @@ rocblas_status rocblasCall_trsm(rocblas_handle    handle,
                                      void*             x_temp,
                                      void*             x_temp_arr,
                                      void*             invA,
-                                     void*             invA_arr)
+                                     void*             invA_arr,
+                                     U                 supplied_invA = nullptr,
+                                     rocblas_int       supplied_invA_size = 0)
 {
-    U supplied_invA = nullptr;
     return rocblas_trsm_template<ROCBLAS_TRSM_BLOCK,BATCHED,T>(handle,side,uplo,transA,diag,m,n,alpha,
                                                                cast2constType(A),offset_A,lda,stride_A,
                                                                cast2nonConstPointer(B),offset_B,ldb,stride_B,
                                                                batch_count, optimal_mem,
                                                                x_temp,x_temp_arr,invA,invA_arr,
-                                                               cast2constType(supplied_invA),0);
+                                                               cast2constType(supplied_invA),supplied_invA_size);
 }
 
 
@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef WORKSPACE_HPP
+#define WORKSPACE_HPP
+
+#include <rocblas.h>
+#include <mutex>
+#include <vector>
+#include "handle.hpp"
+
+// every piece of workspace starts at a multiple of this number of bytes
+#define WORKSPACE_ALIGNMENT 256
+
+inline size_t workspace_align(size_t size)
+{
+    return (size + WORKSPACE_ALIGNMENT - 1) / WORKSPACE_ALIGNMENT * WORKSPACE_ALIGNMENT;
+}
+
+// total number of bytes needed to hold all the (aligned) pieces
+inline size_t workspace_total_size()
+{
+    return 0;
+}
+
+template <typename... Ss>
+size_t workspace_total_size(size_t size, Ss... sizes)
+{
+    return workspace_align(size) + workspace_total_size(sizes...);
+}
+
+/*! \brief returns true if the handle is in workspace size query mode.
+
+    \details
+    In query mode the *_impl functions only report the size of the workspace they
+    need (with rocsolver_set_workspace_size) and return without doing any computation.
+    The check is done right after the arguments have been validated.
+******************************************************************************/
+inline bool rocsolver_is_workspace_query(rocblas_handle handle)
+{
+    return rocsolver_get_handle_data(handle)->size_query;
+}
+
+// records the workspace needed by the current function. The reported size is the
+// maximum over all the functions called while the query mode is on.
+template <typename... Ss>
+rocblas_status rocsolver_set_workspace_size(rocblas_handle handle, Ss... sizes)
+{
+    // (the handle has data as it is in query mode)
+    rocsolver_handle_data* data = rocsolver_find_handle_data(handle);
+    size_t size = workspace_total_size(sizes...);
+    if (data && size > data->query_size)
+        data->query_size = size;
+    return rocblas_status_success;
+}
+
+/*! \brief rocsolver_compute_batch_chunk returns the number of instances of a batch
+    that can be processed at once within a memory budget.
+
+    \details
+    size_of(bc) is the workspace (in bytes) needed for a batch of size bc; it grows with bc.
+    The result is the largest chunk whose workspace fits in the budget, but never less than 
+    min_chunk (nor more than batch_count). A zero budget means no limit.
+******************************************************************************/
+template <typename F>
+rocblas_int rocsolver_compute_batch_chunk(const size_t budget, const rocblas_int min_chunk,
+                                          const rocblas_int batch_count, F size_of)
+{
+    if (!budget || batch_count <= 1 || size_of(batch_count) <= budget)
+        return batch_count;
+
+    rocblas_int floor = min_chunk < 1 ? 1 : (min_chunk > batch_count ? batch_count : min_chunk);
+    if (size_of(floor) > budget)
+        return floor;
+
+    // binary search: size_of(lo) fits, size_of(hi) does not
+    rocblas_int lo = floor, hi = batch_count;
+    while (hi - lo > 1)
+    {
+        rocblas_int mid = lo + (hi - lo) / 2;
+        if (size_of(mid) <= budget)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// returns the chunk size for the batched function being called with the handle
+// (according to its memory budget), and records it so that it can be reported
+// (the handles without data have no budget)
+template <typename F>
+rocblas_int rocsolver_batch_chunk(rocblas_handle handle, const rocblas_int batch_count, F size_of)
+{
+    rocsolver_handle_data* data = rocsolver_get_handle_data(handle);
+    rocblas_int chunk = rocsolver_compute_batch_chunk(data->memory_budget, data->min_chunk, batch_count, size_of);
+    if (!data->shared)
+        data->last_chunk = chunk;
+    return chunk;
+}
+
+/*! \brief rocsolver_device_malloc provides the device workspace of a function.
+
+    \details
+    All the pieces are carved from a single buffer. If the user has set a workspace
+    on the handle that is large enough, it is used directly; otherwise the buffer is
+    taken from the handle's memory arena and returned to it when the object goes out of scope.
+    The buffer is reserved to the handle's stream: only the later calls on the same stream,
+    which are ordered after this one, can reuse it without synchronization.
+    The handles without data use the arena of the shared default data of the device 
+    (it is shared by all the threads, so it is used under its mutex).
+    In capture mode the arena is not used: the work recorded in a graph keeps referring
+    to the buffer after the call returns, so only the user workspace is valid.
+    The pieces are accessed with operator[] in the same order as the sizes were given.
+******************************************************************************/
+class rocsolver_device_malloc
+{
+    std::vector<void*> ptrs;
+    rocsolver_memory_arena* arena = nullptr;
+    rocsolver_memory_backend* backend = nullptr;
+    std::mutex* arena_mutex = nullptr;
+    void* owned = nullptr;
+    bool success;
+
+    static hipStream_t handle_stream(rocblas_handle handle)
+    {
+        hipStream_t stream = nullptr;
+        rocblas_get_stream(handle, &stream);
+        return stream;
+    }
+
+public:
+    template <typename... Ss>
+    rocsolver_device_malloc(rocblas_handle handle, Ss... sizes)
+        : rocsolver_device_malloc(rocsolver_get_handle_data(handle), handle_stream(handle), sizes...)
+    {
+    }
+
+    template <typename... Ss>
+    rocsolver_device_malloc(rocsolver_handle_data* data, hipStream_t stream, Ss... sizes)
+    {
+        size_t total = workspace_total_size(sizes...);
+        char* base = nullptr;
+
+        if (total)
+        {
+            if (data->workspace && data->workspace_size >= total)
+                base = (char*)data->workspace;
+            else if (!data->capture_mode)
+            {
+                arena = data->arena.get();
+                backend = data->backend.get();
+                if (arena && data->shared)
+                {
+                    arena_mutex = &data->arena_mutex;
+                    std::lock_guard<std::mutex> lock(*arena_mutex);
+                    owned = arena->allocate(total, stream);
+                }
+                else
+                    owned = arena ? arena->allocate(total, stream) : backend->allocate(total);
+                base = (char*)owned;
+            }
+        }
+        success = !total || base;
+
+        size_t list[] = {size_t(sizes)...};
+        size_t offset = 0;
+        ptrs.reserve(sizeof...(sizes));
+        for (size_t s : list)
+        {
+            ptrs.push_back(success && s ? base + offset : nullptr);
+            offset += workspace_align(s);
+        }
+    }
+
+    ~rocsolver_device_malloc()
+    {
+        if (owned && arena && arena_mutex)
+        {
+            std::lock_guard<std::mutex> lock(*arena_mutex);
+            arena->deallocate(owned);
+        }
+        else if (owned && arena)
+            arena->deallocate(owned);
+        else if (owned)
+            backend->deallocate(owned);
+    }
+
+    rocsolver_device_malloc(const rocsolver_device_malloc&) = delete;
+    rocsolver_device_malloc& operator=(const rocsolver_device_malloc&) = delete;
+
+    explicit operator bool() const
+    {
+        return success;
+    }
+
+    void* operator[](size_t i) const
+    {
+        return ptrs[i];
+    }
+};
+
+#endif
@@ -28,7 +28,7 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     size_t size_4;  //size of cache for norms and diag elements
@@ -36,21 +36,24 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle, const rocblas_int m,
     size_t size_6;  //size of matrix Y
     rocsolver_gebrd_getMemorySize<T,false>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5,size_6);
+
     void *scalars, *work, *workArr, *diag, *X, *Y;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&diag,size_4);
-    hipMalloc(&X,size_5);
-    hipMalloc(&Y,size_6);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !diag) || (size_5 && !X) || (size_6 && !Y))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5,size_6);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
+    diag = mem[2];
+    X = mem[3];
+    Y = mem[4];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -71,12 +74,6 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle, const rocblas_int m,
                                                      (T**)workArr,
                                                      (T*)diag);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(diag);
-    hipFree(X);
-    hipFree(Y);
     return status;
 }
 
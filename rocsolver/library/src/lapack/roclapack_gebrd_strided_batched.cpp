@@ -25,55 +25,62 @@ rocblas_status rocsolver_gebrd_strided_batched_impl(rocblas_handle handle, const
     rocblas_stride strideY = n * GEBRD_GEBD2_SWITCHSIZE;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     size_t size_4;  //size of cache for norms and diag elements
     size_t size_5;  //size of matrix X
     size_t size_6;  //size of matrix Y
-    rocsolver_gebrd_getMemorySize<T,false>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    // the batch is processed in chunks that fit in the memory budget of the handle
+    rocblas_int chunk = rocsolver_batch_chunk(handle,batch_count,[&](rocblas_int bc){
+        rocsolver_gebrd_getMemorySize<T,false>(m,n,bc,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
+        return workspace_total_size(size_2,size_3,size_4,size_5,size_6);
+    });
+    rocsolver_gebrd_getMemorySize<T,false>(m,n,chunk,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5,size_6);
+
     void *scalars, *work, *workArr, *diag, *X, *Y;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&diag,size_4);
-    hipMalloc(&X,size_5);
-    hipMalloc(&Y,size_6);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !diag) || (size_5 && !X) || (size_6 && !Y))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5,size_6);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
+    diag = mem[2];
+    X = mem[3];
+    Y = mem[4];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
-    rocblas_status status =
+    rocblas_status status = rocblas_status_success;
+    for (rocblas_int b = 0; b < batch_count && status == rocblas_status_success; b += chunk)
+    {
+        status =
            rocsolver_gebrd_template<false,true,S,T>(handle,m,n,
-                                                    A,0,      //the matrix is shifted 0 entries (will work on the entire matrix)
+                                                    A + b*strideA,0,      //the matrix is shifted 0 entries (will work on the entire matrix)
                                                     lda,strideA,
-                                                    D,strideD,
-                                                    E,strideE,
-                                                    tauq,strideQ,
-                                                    taup,strideP,
+                                                    D + b*strideD,strideD,
+                                                    E + b*strideE,strideE,
+                                                    tauq + b*strideQ,strideQ,
+                                                    taup + b*strideP,strideP,
                                                     (U)X,0,  //the matrix is shifted 0 entries (will work on the entire matrix)
                                                     m,strideX,
                                                     (U)Y,0,  //the matrix is shifted 0 entries (will work on the entire matrix)
                                                     n,strideY,
-                                                    batch_count,
+                                                    min(chunk, batch_count - b),
                                                     (T*)scalars,
                                                     (T*)work,
                                                     (T**)workArr,
                                                     (T*)diag);
+    }
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(diag);
-    hipFree(X);
-    hipFree(Y);
     return status;
 }
 
@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_geqrf.hpp"
 
 template <typename T, typename U>
@@ -23,47 +22,55 @@ rocblas_status rocsolver_geqrf_batched_impl(rocblas_handle handle, const rocblas
     rocblas_stride strideA = 0;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;
     size_t size_4;
     size_t size_5;
-    rocsolver_geqrf_getMemorySize<T,true>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    // the batch is processed in chunks that fit in the memory budget of the handle
+    rocblas_int chunk = rocsolver_batch_chunk(handle,batch_count,[&](rocblas_int bc){
+        rocsolver_geqrf_getMemorySize<T,true>(m,n,bc,&size_1,&size_2,&size_3,&size_4,&size_5);
+        return workspace_total_size(size_2,size_3,size_4,size_5);
+    });
+    rocsolver_geqrf_getMemorySize<T,true>(m,n,chunk,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5);
+
     void *scalars, *work, *workArr, *diag, *trfact;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&diag,size_4);
-    hipMalloc(&trfact,size_5);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !diag) || (size_5 && !trfact))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
+    diag = mem[2];
+    trfact = mem[3];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
-    rocblas_status status =
+    rocblas_status status = rocblas_status_success;
+    for (rocblas_int b = 0; b < batch_count && status == rocblas_status_success; b += chunk)
+    {
+        status =
            rocsolver_geqrf_template<true,false,T>(handle,m,n,
-                                                  A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                                  A + b,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                                   lda,strideA,
-                                                  ipiv,
+                                                  ipiv + b*stridep,
                                                   stridep,
-                                                  batch_count,
+                                                  min(chunk, batch_count - b),
                                                   (T*)scalars,
                                                   (T*)work,
                                                   (T**)workArr,
                                                   (T*)diag,
                                                   (T*)trfact);
+    }
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(diag);
-    hipFree(trfact);
     return status;
 }
 
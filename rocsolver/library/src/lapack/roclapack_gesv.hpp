@@ -0,0 +1,399 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_HPP
+#define ROCLAPACK_GESV_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+#ifdef OPTIMAL
+/*************************************************************************
+    gesv_small_kernel takes care of systems with n <= GESV_SMALL_MAX_SIZE.
+    The matrix is factorized as in LUfact_small_kernel (one thread per row,
+    lazy interchanges) and the factors are applied to the right hand sides
+    while they are still in registers: the thread that owns the original row i
+    of A loads row i of B, which is the row of P*B that matches its logical row.
+    The right hand sides are solved one at a time.
+    If U is singular, B is not modified.
+*************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+gesv_small_kernel(const rocblas_int nrhs, U AA, const rocblas_int shiftA, const rocblas_int lda,
+                  const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_stride strideP,
+                  U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                  rocblas_int* infoA, const rocblas_int batch_count)
+{
+    int ty = hipThreadIdx_y;
+    int tid = hipThreadIdx_x;
+    int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if (id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* B = load_ptr_batch<T>(BB,id,shiftB,strideB);
+    rocblas_int *ipiv = ipivA + id*strideP;
+    rocblas_int *info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    // (the arrays for the pivot search come first)
+    using S = decltype(std::real(T{}));
+    int nthds = hipBlockDim_x * hipBlockDim_y;
+    extern __shared__ double lmem[];
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + nthds);
+    sval += ty * hipBlockDim_x;
+    sidx += ty * hipBlockDim_x;
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(nthds));
+    common += ty * WAVESIZE;
+
+    // local variables
+    T pivot_value;
+    int pivot_index;
+    int myrow = tid;        //logical row (after the lazy interchanges)
+    int mypiv = tid + 1;    //to build ipiv
+    int myinfo = 0;         //to build info
+    T rA[DIM];              //to store this-row values
+    T b;                    //to store this-row value of the current right hand side
+
+    // read corresponding row from global memory into local array
+    #pragma unroll DIM
+    for (int j = 0; j < DIM; ++j)
+        rA[j] = A[tid + j*lda];
+
+    //--- GETRF ---
+
+    #pragma unroll DIM
+    for (int k = 0; k < DIM; ++k) {
+
+        // share current column
+        common[myrow] = rA[k];
+        __syncthreads();
+
+        // search pivot index
+        // (no candidate if the column is all NaN: the pivot stays in place)
+        pivot_index = iamax_group<S>(tid, DIM, myrow >= k ? aabs(rA[k]) : S(-1), myrow >= k ? myrow : DIM, sval, sidx);
+        if (pivot_index == DIM)
+            pivot_index = k;
+        pivot_value = common[pivot_index];
+
+        // check singularity and scale value for current column
+        if (pivot_value != T(0.0))
+            pivot_value = 1.0 / pivot_value;
+        else if (myinfo == 0)
+            myinfo = k+1;
+
+        // swap rows (lazy swaping)
+        if (myrow == pivot_index) {
+            myrow = k;
+            //share pivot row
+            for (int j = k+1; j < DIM; ++j)
+                common[j] = rA[j];
+        }
+        else if (myrow == k) {
+            myrow = pivot_index;
+            mypiv = pivot_index + 1;
+        }
+        __syncthreads();
+
+        // scale current column and update trailing matrix
+        if (myrow > k) {
+            rA[k] *= pivot_value;
+            for (int j = k+1; j < DIM; ++j)
+                  rA[j] -= rA[k] * common[j];
+        }
+        __syncthreads();
+    }
+
+    // write factorization to global memory
+    ipiv[myrow] = mypiv;
+    if (myrow == 0)
+        *info = myinfo;
+    #pragma unroll DIM
+    for (int j = 0; j < DIM; ++j)
+        A[myrow + j*lda] = rA[j];
+
+    //--- GETRS ---
+    // (myinfo is the same in all the threads of the group, but all of them
+    // must reach the barriers)
+
+    for (rocblas_int j = 0; j < nrhs; ++j) {
+        b = B[tid + j*ldb];
+
+        // solve L*Y = P*B
+        #pragma unroll DIM
+        for (int k = 0; k < DIM-1; ++k) {
+            if (myrow == k)
+                common[k] = b;
+            __syncthreads();
+            if (myrow > k)
+                b -= rA[k] * common[k];
+        }
+
+        // solve U*X = Y
+        #pragma unroll DIM
+        for (int k = DIM-1; k >= 0; --k) {
+            if (myrow == k) {
+                b = b / rA[k];
+                common[k] = b;
+            }
+            __syncthreads();
+            if (myrow < k)
+                b -= rA[k] * common[k];
+        }
+
+        if (myinfo == 0)
+            B[myrow + j*ldb] = b;
+        __syncthreads();
+    }
+}
+
+/*************************************************************
+    Launcher of gesv_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status gesv_small(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                          U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                          rocblas_int *ipiv, const rocblas_stride strideP,
+                          U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                          rocblas_int* info, const rocblas_int batch_count)
+{
+    #define RUN_GESV_SMALL(DIM)                                                             \
+        hipLaunchKernelGGL((gesv_small_kernel<DIM,T>),grid,block,lmemsize,stream,           \
+                            nrhs,A,shiftA,lda,strideA,ipiv,strideP,B,shiftB,ldb,strideB,info,batch_count)
+
+    // determine sizes
+    // (several small systems are solved by the same work-group, as in LUfact_small)
+    static constexpr int opval[] = {GETF2_OPTIM_NGRP};
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n-1];
+    rocblas_int blocks = (batch_count - 1)/ngrp + 1;
+    rocblas_int nthds = n;
+
+    //prepare kernel launch
+    dim3 grid(blocks,1,1);
+    dim3 block(nthds,ngrp,1);
+    size_t lmemsize = iamax_group_lmem<decltype(std::real(T{}))>(nthds * ngrp) + WAVESIZE * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make size n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch (n) {
+        case  1: RUN_GESV_SMALL( 1); break;
+        case  2: RUN_GESV_SMALL( 2); break;
+        case  3: RUN_GESV_SMALL( 3); break;
+        case  4: RUN_GESV_SMALL( 4); break;
+        case  5: RUN_GESV_SMALL( 5); break;
+        case  6: RUN_GESV_SMALL( 6); break;
+        case  7: RUN_GESV_SMALL( 7); break;
+        case  8: RUN_GESV_SMALL( 8); break;
+        case  9: RUN_GESV_SMALL( 9); break;
+        case 10: RUN_GESV_SMALL(10); break;
+        case 11: RUN_GESV_SMALL(11); break;
+        case 12: RUN_GESV_SMALL(12); break;
+        case 13: RUN_GESV_SMALL(13); break;
+        case 14: RUN_GESV_SMALL(14); break;
+        case 15: RUN_GESV_SMALL(15); break;
+        case 16: RUN_GESV_SMALL(16); break;
+        case 17: RUN_GESV_SMALL(17); break;
+        case 18: RUN_GESV_SMALL(18); break;
+        case 19: RUN_GESV_SMALL(19); break;
+        case 20: RUN_GESV_SMALL(20); break;
+        case 21: RUN_GESV_SMALL(21); break;
+        case 22: RUN_GESV_SMALL(22); break;
+        case 23: RUN_GESV_SMALL(23); break;
+        case 24: RUN_GESV_SMALL(24); break;
+        case 25: RUN_GESV_SMALL(25); break;
+        case 26: RUN_GESV_SMALL(26); break;
+        case 27: RUN_GESV_SMALL(27); break;
+        case 28: RUN_GESV_SMALL(28); break;
+        case 29: RUN_GESV_SMALL(29); break;
+        case 30: RUN_GESV_SMALL(30); break;
+        case 31: RUN_GESV_SMALL(31); break;
+        case 32: RUN_GESV_SMALL(32); break;
+        case 33: RUN_GESV_SMALL(33); break;
+        case 34: RUN_GESV_SMALL(34); break;
+        case 35: RUN_GESV_SMALL(35); break;
+        case 36: RUN_GESV_SMALL(36); break;
+        case 37: RUN_GESV_SMALL(37); break;
+        case 38: RUN_GESV_SMALL(38); break;
+        case 39: RUN_GESV_SMALL(39); break;
+        case 40: RUN_GESV_SMALL(40); break;
+        case 41: RUN_GESV_SMALL(41); break;
+        case 42: RUN_GESV_SMALL(42); break;
+        case 43: RUN_GESV_SMALL(43); break;
+        case 44: RUN_GESV_SMALL(44); break;
+        case 45: RUN_GESV_SMALL(45); break;
+        case 46: RUN_GESV_SMALL(46); break;
+        case 47: RUN_GESV_SMALL(47); break;
+        case 48: RUN_GESV_SMALL(48); break;
+        case 49: RUN_GESV_SMALL(49); break;
+        case 50: RUN_GESV_SMALL(50); break;
+        case 51: RUN_GESV_SMALL(51); break;
+        case 52: RUN_GESV_SMALL(52); break;
+        case 53: RUN_GESV_SMALL(53); break;
+        case 54: RUN_GESV_SMALL(54); break;
+        case 55: RUN_GESV_SMALL(55); break;
+        case 56: RUN_GESV_SMALL(56); break;
+        case 57: RUN_GESV_SMALL(57); break;
+        case 58: RUN_GESV_SMALL(58); break;
+        case 59: RUN_GESV_SMALL(59); break;
+        case 60: RUN_GESV_SMALL(60); break;
+        case 61: RUN_GESV_SMALL(61); break;
+        case 62: RUN_GESV_SMALL(62); break;
+        case 63: RUN_GESV_SMALL(63); break;
+        case 64: RUN_GESV_SMALL(64); break;
+        default: __builtin_unreachable();
+    }
+
+    return rocblas_status_success;
+}
+#endif //OPTIMAL
+
+
+template <typename T>
+rocblas_status rocsolver_gesv_argCheck(const rocblas_int n, const rocblas_int nrhs, const rocblas_int lda,
+                                       const rocblas_int ldb, T A, T B, const rocblas_int *ipiv,
+                                       const rocblas_int *info, const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if ((n && !A) || (n && !ipiv) || (nrhs*n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** gesv_copy_B saves the right hand sides of the systems into W (with leading dimension n)
+    or, if restore is true, copies them back to the instances with a singular U,
+    so that B is not modified for them (as in gesv_small_kernel) **/
+template <typename T, typename U>
+__global__ void gesv_copy_B(const bool restore, const rocblas_int n, const rocblas_int nrhs,
+                            U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                            T* W, const rocblas_int* info)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int id = hipBlockIdx_y;
+
+    if (i < n && (!restore || info[id] > 0)) {
+        T* B = load_ptr_batch<T>(BB,id,shiftB,strideB);
+        T* w = W + size_t(id) * n * nrhs;
+        for (rocblas_int j = 0; j < nrhs; ++j) {
+            if (restore)
+                B[i + j*ldb] = w[i + j*n];
+            else
+                w[i + j*n] = B[i + j*ldb];
+        }
+    }
+}
+
+// true if gesv factorizes and solves the systems with gesv_small_kernel
+inline bool gesv_use_small(const rocblas_int n)
+{
+    #ifdef OPTIMAL
+    return n <= GESV_SMALL_MAX_SIZE;
+    #else
+    return false;
+    #endif
+}
+
+// gesv needs the workspace of getrf (getrs does not need any), and
+// a copy of the right hand sides (size_6) to restore them for the singular systems
+template <typename T, typename S>
+void rocsolver_gesv_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5,
+                                  size_t *size_6, const bool tournament = false)
+{
+    // the small systems are solved by a single kernel with no workspace
+    if (gesv_use_small(n)) {
+        *size_1 = 0;
+        *size_2 = 0;
+        *size_3 = 0;
+        *size_4 = 0;
+        *size_5 = 0;
+        *size_6 = 0;
+        return;
+    }
+    rocsolver_getrf_getMemorySize<T,S>(n,n,batch_count,size_1,size_2,size_3,size_4,size_5,tournament);
+    *size_6 = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                       U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                       rocblas_int *ipiv, const rocblas_stride strideP,
+                                       U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                                       rocblas_int *info, const rocblas_int batch_count,
+                                       T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_int* iinfo, rocblas_index_value_t<S> *work,
+                                       void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                                       T* Bcopy, const bool tournament = false)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return with info = 0 if no dimensions
+    if (n == 0) {
+        rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset,1,1),dim3(BLOCKSIZE,1,1),0,stream,info,batch_count,0);
+        return rocblas_status_success;
+    }
+
+    #ifdef OPTIMAL
+    // small systems are factorized and solved by a single kernel
+    if (gesv_use_small(n))
+        return gesv_small<T>(handle,n,nrhs,A,shiftA,lda,strideA,ipiv,strideP,B,shiftB,ldb,strideB,info,batch_count);
+    #endif
+
+    // otherwise compute the factorization...
+    rocblas_status status = rocsolver_getrf_template<BATCHED,STRIDED,T,S>(handle,n,n,A,shiftA,lda,strideA,ipiv,0,strideP,info,batch_count,1,
+                                                                          scalars,pivot_val,pivot_idx,iinfo,work,
+                                                                          x_temp,x_temp_arr,invA,invA_arr,optim_mem,tournament);
+    if (status != rocblas_status_success)
+        return status;
+
+    // ...and solve the systems
+    // (the solves are done for all the instances, and B is restored afterwards
+    //  for those with a singular U)
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    dim3 grid(blocks,batch_count,1);
+    dim3 threads(BLOCKSIZE,1,1);
+    if (nrhs > 0)
+        hipLaunchKernelGGL((gesv_copy_B<T,U>),grid,threads,0,stream,false,n,nrhs,B,shiftB,ldb,strideB,Bcopy,info);
+
+    status = rocsolver_getrs_template<BATCHED,T>(handle,rocblas_operation_none,n,nrhs,
+                                                 A,shiftA,lda,strideA,ipiv,strideP,
+                                                 B,shiftB,ldb,strideB,batch_count,
+                                                 x_temp,x_temp_arr,invA,invA_arr,optim_mem);
+    if (status != rocblas_status_success)
+        return status;
+
+    if (nrhs > 0)
+        hipLaunchKernelGGL((gesv_copy_B<T,U>),grid,threads,0,stream,true,n,nrhs,B,shiftB,ldb,strideB,Bcopy,info);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GESV_HPP */
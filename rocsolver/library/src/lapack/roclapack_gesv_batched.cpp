@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_batched_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                           U A, const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+                                           U B, const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_gesv_argCheck(n,nrhs,lda,ldb,A,B,ipiv,info,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // tournament pivoting is an option of the handle
+    const bool tournament = rocsolver_get_handle_data(handle)->tournament_pivoting;
+
+    // memory managment
+    using S = decltype(std::real(T{}));
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
+    size_t size_2;
+    size_t size_3;
+    size_t size_4;
+    size_t size_5;
+    size_t size_6;  //for the copy of the right hand sides
+
+    // the batch is processed in chunks that fit in the memory budget of the handle
+    rocblas_int chunk = rocsolver_batch_chunk(handle,batch_count,[&](rocblas_int bc){
+        rocsolver_gesv_getMemorySize<T,S>(n,nrhs,bc,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6,tournament);
+        return workspace_total_size(size_2,size_3,size_4,size_5,size_6);
+    });
+    rocsolver_gesv_getMemorySize<T,S>(n,nrhs,chunk,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6,tournament);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5,size_6);
+
+    void *scalars, *pivot_val, *pivot_idx, *iinfo, *work;
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (enough for the updates of getrf and for the triangular solves of getrs;
+    //  the small systems are solved by a single kernel that does not need it)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (!gesv_use_small(n)) {
+        rocblas_status perf_status = rocblasCall_trsm_mem<true,T,U>(handle,rocblas_side_left,max(n,GETRF_GETF2_SWITCHSIZE),max(n,nrhs),chunk,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
+
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5,size_6);
+    if (!mem)
+        return rocblas_status_memory_error;
+    pivot_val = mem[0];
+    pivot_idx = mem[1];
+    iinfo = mem[2];
+    work = mem[3];
+
+    // scalar constants for rocblas functions calls
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    // execution
+    rocblas_status status = rocblas_status_success;
+    for (rocblas_int b = 0; b < batch_count && status == rocblas_status_success; b += chunk)
+    {
+        status =
+           rocsolver_gesv_template<true,false,T,S>(handle,n,nrhs,
+                                                   A + b,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                   lda,strideA,
+                                                   ipiv + b*strideP,strideP,
+                                                   B + b,0,
+                                                   ldb,strideB,
+                                                   info + b,min(chunk, batch_count - b),
+                                                   (T*)scalars,
+                                                   (T*)pivot_val,
+                                                   (rocblas_int*)pivot_idx,
+                                                   (rocblas_int*)iinfo,
+                                                   (rocblas_index_value_t<S>*)work,
+                                                   x_temp,
+                                                   x_temp_arr,
+                                                   invA,
+                                                   invA_arr,
+                                                   optim_mem,
+                                                   (T*)mem[4],
+                                                   tournament);
+    }
+
+    return status;
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 float *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+                 float *const B[], const rocblas_int ldb, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<float>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+                 double *const B[], const rocblas_int ldb, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<double>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_float_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_float_complex *const B[], const rocblas_int ldb, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<rocblas_float_complex>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_double_complex *const B[], const rocblas_int ldb, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batch_count);
+}
+
+} //extern C
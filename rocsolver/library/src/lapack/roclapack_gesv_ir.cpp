@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv_ir.hpp"
+
+template <typename T>
+rocblas_status rocsolver_gesv_ir_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                      T *A, const rocblas_int lda, rocblas_int *ipiv, T *B, const rocblas_int ldb,
+                                      T *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info)
+{
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_argCheck(rocblas_operation_none,n,nrhs,lda,ldb,A,B,ipiv);
+    if (st != rocblas_status_continue)
+        return st;
+    if (ldx < n)
+        return rocblas_status_invalid_size;
+    if ((nrhs*n && !X) || !iter || !info)
+        return rocblas_status_invalid_pointer;
+
+    // the convergence is checked on the host
+    rocsolver_handle_data* data = rocsolver_get_handle_data(handle);
+    if (data->capture_mode)
+        return rocblas_status_not_implemented;
+
+    // tournament pivoting is an option of the handle
+    const bool tournament = data->tournament_pivoting;
+
+    // memory managment
+    size_t size_SA, size_SX, size_R, size_flags;
+    size_t size_2, size_3, size_4, size_5;
+    rocsolver_gesv_ir_getMemorySize<T,S>(n,nrhs,tournament,&size_SA,&size_SX,&size_R,&size_flags,&size_2,&size_3,&size_4,&size_5);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_SA,size_SX,size_R,size_flags,size_2,size_3,size_4,size_5);
+
+    rocsolver_device_malloc mem(handle,size_SA,size_SX,size_R,size_flags,size_2,size_3,size_4,size_5);
+    if (!mem)
+        return rocblas_status_memory_error;
+
+    // execution
+    return rocsolver_gesv_ir_template<T,S>(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info,
+                                           data->refinement_iterations,
+                                           mem[0],mem[1],(T*)mem[2],mem[3],
+                                           mem[4],mem[5],mem[6],mem[7],
+                                           tournament);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_ir(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+                 double *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info)
+{
+    return rocsolver_gesv_ir_impl<double>(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_ir(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+                 rocblas_double_complex *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info)
+{
+    return rocsolver_gesv_ir_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+} //extern C
@@ -0,0 +1,422 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routines (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_IR_HPP
+#define ROCLAPACK_GESV_IR_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "common_device.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include <limits>
+
+/** gesv_ir_lower_t is the type in which the matrix is factorized
+    (single precision for double, complex single for complex double) **/
+template <typename T>
+struct gesv_ir_lower_t;
+template <>
+struct gesv_ir_lower_t<double>
+{
+    using type = float;
+};
+template <>
+struct gesv_ir_lower_t<rocblas_double_complex>
+{
+    using type = rocblas_float_complex;
+};
+
+/** GESV_IR_CAST converts x to the type L (of the same kind, real or complex) **/
+template <typename L, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline L gesv_ir_cast(const T x)
+{
+    return L(x);
+}
+
+template <typename L, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline L gesv_ir_cast(const T x)
+{
+    using SL = decltype(std::real(L{}));
+    return L(SL(x.real()), SL(x.imag()));
+}
+
+/** GESV_IR_OVERFLOWS returns true if x is too large for the type L **/
+template <typename L, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline bool gesv_ir_overflows(const T x)
+{
+    return aabs(x) > std::numeric_limits<L>::max();
+}
+
+template <typename L, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline bool gesv_ir_overflows(const T x)
+{
+    using SL = decltype(std::real(L{}));
+    return gesv_ir_overflows<SL>(x.real()) || gesv_ir_overflows<SL>(x.imag());
+}
+
+/** GESV_IR_LOWER converts the n-by-nrhs matrix A to the lower precision L (matrix B).
+    overflow is set if an entry is too large for L **/
+template <typename T, typename L>
+__global__ void gesv_ir_lower(const rocblas_int n, const rocblas_int nrhs, const T* A, const rocblas_int lda,
+                              L* B, const rocblas_int ldb, rocblas_int* overflow)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n) {
+        T x = A[i + j*lda];
+        if (gesv_ir_overflows<L>(x))
+            *overflow = 1;
+        B[i + j*ldb] = gesv_ir_cast<L>(x);
+    }
+}
+
+/** GESV_IR_RAISE converts the n-by-nrhs matrix B in precision L back to T, and stores it in X
+    (or adds it to X if ADD is true) **/
+template <bool ADD, typename T, typename L>
+__global__ void gesv_ir_raise(const rocblas_int n, const rocblas_int nrhs, const L* B, const rocblas_int ldb,
+                              T* X, const rocblas_int ldx)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n) {
+        T x = gesv_ir_cast<T>(B[i + j*ldb]);
+        if (ADD)
+            X[i + j*ldx] += x;
+        else
+            X[i + j*ldx] = x;
+    }
+}
+
+/** The infinity norm (largest row sum) of the n-by-n matrix A is computed in three steps:
+    GESV_IR_ROWSUM sums each row over the chunks of GESV_IR_NORM_CHUNK columns (a thread per row 
+    and chunk), GESV_IR_ROWMAX adds the partial sums of each row and finds the largest row of each 
+    group of BLOCKSIZE rows, and GESV_IR_NORM finds the largest of these with one group. **/
+template <typename T, typename S>
+__global__ void gesv_ir_rowsum(const rocblas_int n, const T* A, const rocblas_int lda, S* part)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int k = hipBlockIdx_y;
+
+    if (i < n) {
+        rocblas_int jend = min(n, (k + 1) * GESV_IR_NORM_CHUNK);
+        S v = 0;
+        for (rocblas_int j = k * GESV_IR_NORM_CHUNK; j < jend; ++j)
+            v += aabs(A[i + j*lda]);
+        part[i + k*n] = v;
+    }
+}
+
+template <typename S>
+__global__ void __launch_bounds__(BLOCKSIZE) gesv_ir_rowmax(const rocblas_int n, const rocblas_int nchunks, 
+                                                            const S* part, S* bmax)
+{
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+    int tid = hipThreadIdx_x;
+    int i = hipBlockIdx_x * hipBlockDim_x + tid;
+
+    S v = 0;
+    if (i < n) {
+        for (rocblas_int k = 0; k < nchunks; ++k)
+            v += part[i + k*n];
+    }
+
+    iamax_group(tid, BLOCKSIZE, v, tid, sval, sidx);
+    if (tid == 0)
+        bmax[hipBlockIdx_x] = sval[0];
+}
+
+template <typename S>
+__global__ void __launch_bounds__(BLOCKSIZE) gesv_ir_norm(const rocblas_int nblocks, const S* bmax, S* anrm)
+{
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+    int tid = hipThreadIdx_x;
+
+    S vmax = 0;
+    for (rocblas_int b = tid; b < nblocks; b += BLOCKSIZE)
+        vmax = bmax[b] > vmax ? bmax[b] : vmax;
+
+    iamax_group(tid, BLOCKSIZE, vmax, tid, sval, sidx);
+    if (tid == 0)
+        *anrm = sval[0];
+}
+
+/** GESV_IR_CHECK sets notconv if the residual R of some column of the solution X is larger
+    than |X| * |A| * cte (as in LAPACK ?sgesv, with the largest entries of the columns).
+    There is a group of BLOCKSIZE threads per column **/
+template <typename T, typename S>
+__global__ void __launch_bounds__(BLOCKSIZE) gesv_ir_check(const rocblas_int n, const T* X, const rocblas_int ldx,
+                                                           const T* R, const rocblas_int ldr, const S* anrm,
+                                                           const S cte, rocblas_int* notconv)
+{
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+    int tid = hipThreadIdx_x;
+    int j = hipBlockIdx_x;
+
+    S xmax = 0, rmax = 0;
+    for (rocblas_int i = tid; i < n; i += BLOCKSIZE) {
+        S x = aabs(X[i + j*ldx]);
+        S r = aabs(R[i + j*ldr]);
+        xmax = x > xmax ? x : xmax;
+        rmax = r > rmax ? r : rmax;
+    }
+
+    iamax_group(tid, BLOCKSIZE, xmax, tid, sval, sidx);
+    xmax = sval[0];
+    __syncthreads();
+    iamax_group(tid, BLOCKSIZE, rmax, tid, sval, sidx);
+    rmax = sval[0];
+
+    // (a NaN residual does not converge)
+    if (tid == 0 && !(rmax <= xmax * (*anrm) * cte))
+        *notconv = 1;
+}
+
+// flags of the refinement, in the workspace
+#define GESV_IR_OVERFLOW 0
+#define GESV_IR_NOTCONV 1
+#define GESV_IR_SINFO 2
+#define GESV_IR_NFLAGS 3
+
+// number of values in the workspace of the norm of A: the norm, the largest row sum of 
+// each group of BLOCKSIZE rows and the partial row sums
+inline size_t gesv_ir_norm_size(const rocblas_int n)
+{
+    size_t nblocks = (n - 1) / BLOCKSIZE + 1;
+    size_t nchunks = (n - 1) / GESV_IR_NORM_CHUNK + 1;
+    return 1 + nblocks + nchunks * n;
+}
+
+template <typename T, typename S>
+void rocsolver_gesv_ir_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const bool tournament,
+                                     size_t *size_SA, size_t *size_SX, size_t *size_R, size_t *size_flags,
+                                     size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5)
+{
+    using L = typename gesv_ir_lower_t<T>::type;
+    using SL = decltype(std::real(L{}));
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
+    size_t s2, s3, s4, s5;
+
+    // the workspace of getrf serves the factorization in both precisions
+    rocsolver_getrf_getMemorySize<L,SL>(n,n,1,&size_1,size_2,size_3,size_4,size_5,tournament);
+    rocsolver_getrf_getMemorySize<T,S>(n,n,1,&size_1,&s2,&s3,&s4,&s5,tournament);
+    *size_2 = std::max(*size_2, s2);
+    *size_3 = std::max(*size_3, s3);
+    *size_4 = std::max(*size_4, s4);
+    *size_5 = std::max(*size_5, s5);
+
+    *size_SA = sizeof(L) * n * n;
+    *size_SX = sizeof(L) * n * nrhs;
+    *size_R = sizeof(T) * n * nrhs;
+    // (the norm of A with its workspace, and the flags)
+    *size_flags = sizeof(S) * gesv_ir_norm_size(n) + sizeof(rocblas_int) * GESV_IR_NFLAGS;
+}
+
+/** gesv_ir_fallback solves the system with the factorization in the precision of A
+    (as getrf followed by getrs). X = B on entry. **/
+template <typename T, typename S>
+rocblas_status gesv_ir_fallback(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                T* A, const rocblas_int lda, rocblas_int* ipiv, T* X, const rocblas_int ldx,
+                                rocblas_int* info, void* pivot_val, void* pivot_idx, void* iinfo, void* work,
+                                const bool tournament)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    T* scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    void *x_temp, *x_temp_arr, *invA, *invA_arr;
+    rocblas_status perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,n,1,x_temp,x_temp_arr,invA,invA_arr);
+    if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+    rocblas_status status = rocsolver_getrf_template<false,false,T,S>(handle,n,n,A,0,lda,0,ipiv,0,0,info,1,1,scalars,
+                                                                      (T*)pivot_val,(rocblas_int*)pivot_idx,(rocblas_int*)iinfo,
+                                                                      (rocblas_index_value_t<S>*)work,x_temp,x_temp_arr,invA,invA_arr,
+                                                                      perf_status == rocblas_status_success,tournament);
+    if (status != rocblas_status_success)
+        return status;
+
+    // (the solution is only computed if A is not singular)
+    rocblas_int hinfo;
+    if (hipMemcpyAsync(&hinfo, info, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream) != hipSuccess
+        || hipStreamSynchronize(stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    if (hinfo != 0)
+        return rocblas_status_success;
+
+    perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,n,nrhs,1,x_temp,x_temp_arr,invA,invA_arr);
+    if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+    return rocsolver_getrs_template<false,T>(handle,rocblas_operation_none,n,nrhs,A,0,lda,0,ipiv,0,X,0,ldx,0,1,
+                                             x_temp,x_temp_arr,invA,invA_arr,perf_status == rocblas_status_success);
+}
+
+/** rocsolver_gesv_ir_template solves A*X = B with the LU factorization of A in lower precision
+    and iterative refinement in the precision of A (as LAPACK dsgesv/zcgesv).
+    If the refinement does not converge within max_iter iterations (or the lower precision cannot
+    be used), A is factorized in its own precision. The host waits for the device at every
+    iteration, to check the convergence. **/
+template <typename T, typename S>
+rocblas_status rocsolver_gesv_ir_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                          T* A, const rocblas_int lda, rocblas_int* ipiv, T* B, const rocblas_int ldb,
+                                          T* X, const rocblas_int ldx, rocblas_int* iter, rocblas_int* info,
+                                          const rocblas_int max_iter, void* SA, void* SX, T* R, void* flags,
+                                          void* pivot_val, void* pivot_idx, void* iinfo, void* work,
+                                          const bool tournament)
+{
+    using L = typename gesv_ir_lower_t<T>::type;
+    using SL = decltype(std::real(L{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info=0 (starting with a nonsingular matrix)
+    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,info,1,0);
+
+    // quick return
+    if (n == 0 || nrhs == 0) {
+        hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,iter,1,0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle,&old_mode);
+    rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
+
+    //constants to use when calling rocablas functions
+    T one = 1;                    //constant 1 in host
+    T minone = -1;                //constant -1 in host
+
+    L* sA = (L*)SA;
+    L* sX = (L*)SX;
+    // (the values of the norm come first, so that they are aligned)
+    S* anrm = (S*)flags;
+    S* bmax = anrm + 1;
+    rocblas_int* dflags = (rocblas_int*)(anrm + gesv_ir_norm_size(n));
+    rocblas_int hflags[GESV_IR_NFLAGS];
+    S cte = std::numeric_limits<S>::epsilon() / 2 * std::sqrt(S(n));
+
+    dim3 threads(BLOCKSIZE, 1, 1);
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    rocblas_int nchunks = (n - 1) / GESV_IR_NORM_CHUNK + 1;
+    auto get_flags = [&]() {
+        return hipMemcpyAsync(hflags, dflags, sizeof(hflags), hipMemcpyDeviceToHost, stream) == hipSuccess
+               && hipStreamSynchronize(stream) == hipSuccess;
+    };
+
+    // iteration count, or the reason to use the precision of A:
+    // -2 overflow in the conversion, -3 the lower precision factor is singular,
+    // -max_iter-1 the refinement did not converge
+    rocblas_int hiter = 0;
+    rocblas_status status = rocblas_status_success;
+
+    // convert A and B, and factorize A in lower precision
+    hipLaunchKernelGGL(reset_info,dim3(1),threads,0,stream,dflags,GESV_IR_NFLAGS,0);
+    hipLaunchKernelGGL((gesv_ir_rowsum<T,S>),dim3(blocks,nchunks),threads,0,stream,n,A,lda,bmax + blocks);
+    hipLaunchKernelGGL((gesv_ir_rowmax<S>),dim3(blocks),threads,0,stream,n,nchunks,bmax + blocks,bmax);
+    hipLaunchKernelGGL((gesv_ir_norm<S>),dim3(1),threads,0,stream,blocks,bmax,anrm);
+    hipLaunchKernelGGL((gesv_ir_lower<T,L>),dim3(blocks,n),threads,0,stream,n,n,A,lda,sA,n,dflags + GESV_IR_OVERFLOW);
+    hipLaunchKernelGGL((gesv_ir_lower<T,L>),dim3(blocks,nrhs),threads,0,stream,n,nrhs,B,ldb,sX,n,dflags + GESV_IR_OVERFLOW);
+
+    L* scalars = rocsolver_get_constants<L>(handle);
+    if (!scalars)
+        status = rocblas_status_memory_error;
+    void *x_temp, *x_temp_arr, *invA, *invA_arr;
+    rocblas_status perf_status;
+    if (status == rocblas_status_success) {
+        // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+        perf_status = rocblasCall_trsm_mem<false,L,L*>(handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,n,1,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            status = perf_status;
+    }
+    if (status == rocblas_status_success)
+        status = rocsolver_getrf_template<false,false,L,SL>(handle,n,n,sA,0,n,0,ipiv,0,0,dflags + GESV_IR_SINFO,1,1,scalars,
+                                                            (L*)pivot_val,(rocblas_int*)pivot_idx,(rocblas_int*)iinfo,
+                                                            (rocblas_index_value_t<SL>*)work,x_temp,x_temp_arr,invA,invA_arr,
+                                                            perf_status == rocblas_status_success,tournament);
+    if (status == rocblas_status_success && !get_flags())
+        status = rocblas_status_internal_error;
+    if (status != rocblas_status_success) {
+        rocblas_set_pointer_mode(handle,old_mode);
+        return status;
+    }
+
+    if (hflags[GESV_IR_OVERFLOW])
+        hiter = -2;
+    else if (hflags[GESV_IR_SINFO])
+        hiter = -3;
+    else {
+        // initial solution
+        perf_status = rocblasCall_trsm_mem<false,L,L*>(handle,rocblas_side_left,n,nrhs,1,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            status = perf_status;
+        bool optim_mem = perf_status == rocblas_status_success;
+        if (status == rocblas_status_success)
+            status = rocsolver_getrs_template<false,L>(handle,rocblas_operation_none,n,nrhs,sA,0,n,0,ipiv,0,sX,0,n,0,1,
+                                                       x_temp,x_temp_arr,invA,invA_arr,optim_mem);
+        hipLaunchKernelGGL((gesv_ir_raise<false,T,L>),dim3(blocks,nrhs),threads,0,stream,n,nrhs,sX,n,X,ldx);
+
+        for (rocblas_int it = 0; status == rocblas_status_success; ++it) {
+            // residual R = B - A*X
+            hipMemcpy2DAsync(R, sizeof(T) * n, B, sizeof(T) * ldb, sizeof(T) * n, nrhs, hipMemcpyDeviceToDevice, stream);
+            rocblasCall_gemm<false,false,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                            n, nrhs, n, &minone,
+                                            A, 0, lda, 0,
+                                            X, 0, ldx, 0, &one,
+                                            R, 0, n, 0, 1, nullptr);
+            hipLaunchKernelGGL((gesv_ir_check<T,S>),dim3(nrhs),threads,0,stream,n,X,ldx,R,n,anrm,cte,dflags + GESV_IR_NOTCONV);
+            if (!get_flags()) {
+                status = rocblas_status_internal_error;
+                break;
+            }
+
+            // (an overflow in the conversion of the last correction spoils X)
+            if (hflags[GESV_IR_OVERFLOW]) {
+                hiter = -2;
+                break;
+            }
+            if (!hflags[GESV_IR_NOTCONV]) {
+                hiter = it;
+                break;
+            }
+            if (it == max_iter) {
+                hiter = -max_iter - 1;
+                break;
+            }
+
+            // correction: solve A*C = R in lower precision, X = X + C
+            // (the flags of the overflow and the convergence are reset)
+            hipLaunchKernelGGL(reset_info,dim3(1),threads,0,stream,dflags,GESV_IR_NOTCONV + 1,0);
+            hipLaunchKernelGGL((gesv_ir_lower<T,L>),dim3(blocks,nrhs),threads,0,stream,n,nrhs,R,n,sX,n,dflags + GESV_IR_OVERFLOW);
+            status = rocsolver_getrs_template<false,L>(handle,rocblas_operation_none,n,nrhs,sA,0,n,0,ipiv,0,sX,0,n,0,1,
+                                                       x_temp,x_temp_arr,invA,invA_arr,optim_mem);
+            hipLaunchKernelGGL((gesv_ir_raise<true,T,L>),dim3(blocks,nrhs),threads,0,stream,n,nrhs,sX,n,X,ldx);
+        }
+    }
+
+    // factorization in the precision of A
+    if (status == rocblas_status_success && hiter < 0) {
+        hipMemcpy2DAsync(X, sizeof(T) * ldx, B, sizeof(T) * ldb, sizeof(T) * n, nrhs, hipMemcpyDeviceToDevice, stream);
+        status = gesv_ir_fallback<T,S>(handle,n,nrhs,A,lda,ipiv,X,ldx,info,pivot_val,pivot_idx,iinfo,work,tournament);
+    }
+
+    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,iter,1,hiter);
+    rocblas_set_pointer_mode(handle,old_mode);
+    return status;
+}
+
+#endif /* ROCLAPACK_GESV_IR_HPP */
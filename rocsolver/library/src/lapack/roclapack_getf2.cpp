@@ -15,7 +15,7 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
     //logging is missing ???    
     
     // argument checking
-    rocblas_status st = rocsolver_getf2_getrf_argCheck(m,n,lda,A,ipiv,info);
+    rocblas_status st = rocsolver_getf2_getrf_argCheck(m,n,lda,A,ipiv,info,1,pivot);
     if (st != rocblas_status_continue)
         return st;
 
@@ -25,25 +25,28 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
 
     // memory managment
     using S = decltype(std::real(T{}));
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //pivot values
     size_t size_3;  //pivot indices
     size_t size_4;  //workspace
     rocsolver_getf2_getMemorySize<T,S>(m,batch_count,&size_1,&size_2,&size_3,&size_4);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4);
+
     void *scalars, *pivot_idx, *pivot_val, *work;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&pivot_val,size_2);
-    hipMalloc(&pivot_idx,size_3);
-    hipMalloc(&work,size_4);
-    if (!scalars || (size_2 && !pivot_idx) || (size_3 && !pivot_val) || (size_4 && !work))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    pivot_val = mem[0];
+    pivot_idx = mem[1];
+    work = mem[2];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -58,10 +61,6 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
                                                 (rocblas_int*)pivot_idx,
                                                 (rocblas_index_value_t<S>*)work);
 
-    hipFree(scalars);
-    hipFree(pivot_val);
-    hipFree(pivot_idx);
-    hipFree(work);
     return status;    
 }
 
@@ -101,29 +100,25 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetf2(rocblas_handle handle, const ro
 ROCSOLVER_EXPORT rocblas_status rocsolver_sgetf2_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n, float *A,
                  const rocblas_int lda, rocblas_int* info)
 {
-    rocblas_int *ipiv;
-    return rocsolver_getf2_impl<float>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getf2_impl<float>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_dgetf2_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n, double *A,
                  const rocblas_int lda, rocblas_int* info)
 {
-    rocblas_int *ipiv;
-    return rocsolver_getf2_impl<double>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getf2_impl<double>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_cgetf2_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n, rocblas_float_complex *A,
                  const rocblas_int lda, rocblas_int* info)
 {
-    rocblas_int *ipiv;
-    return rocsolver_getf2_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getf2_impl<rocblas_float_complex>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_zgetf2_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n, rocblas_double_complex *A,
                  const rocblas_int lda, rocblas_int* info)
 {
-    rocblas_int *ipiv;
-    return rocsolver_getf2_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getf2_impl<rocblas_double_complex>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 
@@ -18,6 +18,36 @@
 #include "rocsolver.h"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
+template <bool ISBATCHED, typename T, typename S, typename U>
+rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int m,
+                                        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
+                                        const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP, 
+                                        const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count, const rocblas_int pivot, 
+                                        T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work,
+                                        const bool tournament = false);
+
+/** getf2_tslu_layout computes the offsets (in bytes) of the pieces of workspace used by the 
+    tournament pivoting of an m-by-n panel (see getf2_tslu), and returns its total size **/
+template <typename T>
+size_t getf2_tslu_layout(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t* offsets)
+{
+    size_t ngroups = (size_t)((m - 1) / GETF2_MAX_THDS + 1) * batch_count;
+    size_t sizes[5] = {
+        sizeof(T) * ngroups * GETF2_MAX_THDS * n,       // rows of the groups
+        sizeof(rocblas_int) * ngroups * GETF2_MAX_THDS, // row indices of the groups
+        sizeof(rocblas_int) * ngroups * n,              // winners of the groups
+        sizeof(rocblas_int) * ngroups * n,              // pivots of the groups
+        sizeof(rocblas_int) * ngroups                   // info of the groups
+    };
+
+    size_t total = 0;
+    for (int i = 0; i < 5; ++i) {
+        offsets[i] = total;
+        total += (sizes[i] - 1) / 256 * 256 + 256;
+    }
+    return total;
+}
+
 #ifdef OPTIMAL
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //          SERIES OF OPTIMIZED KERNELS FOR LU FACTORIZATION OF SMALL/MEDIUM SIZE MATRICES                    //
@@ -27,11 +57,11 @@
     LUfact_panel_kernel takes care of of matrices with 
     GETF2_MAX_THDS <= m <= GETF2_OPTIM_MAX_SIZE and n < WAVESIZE
 *************************************************************************/
-template <rocblas_int DIM, typename T, typename U>
+template <rocblas_int DIM, bool PIVOT, typename T, typename U>
 __global__ void __launch_bounds__(GETF2_MAX_THDS) 
 LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda, 
                     const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_int shiftP,
-                    const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count, const int pivot)
+                    const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count)
 {
     int myrow = hipThreadIdx_x;
     int id = hipBlockIdx_x;
@@ -39,13 +69,17 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
     // batch instance
     T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
     rocblas_int *ipiv;
-    if (pivot) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
+    if (PIVOT) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
     rocblas_int *info = infoA + id;
 
     // shared memory (for communication between threads in group)
     // (SHUFFLES DO NOT IMPROVE PERFORMANCE IN THIS CASE)
+    // (the arrays for the pivot search come first)
+    using S = decltype(std::real(T{}));
     extern __shared__ double lmem[];
-    T *common = (T*)lmem;
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + GETF2_MAX_THDS);
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(GETF2_MAX_THDS));
     
     // number of rows that each thread is going to handle
     int nrows = m / GETF2_MAX_THDS;
@@ -54,7 +88,6 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
     
     // local variables
     T pivot_value;
-    T test_value;
     int tmp;
     int pivot_index;
     int myinfo = 0;         //to build info
@@ -65,7 +98,7 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
     // initialization
     for (int i = 0; i < nrows; ++i) {
         myrows[i] = myrow + i * GETF2_MAX_THDS;
-        mypivs[i] = myrows[i] + 1;
+        if (PIVOT) mypivs[i] = myrows[i] + 1;
     }
     
     // read corresponding rows from global memory into local array
@@ -82,18 +115,27 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
             common[myrows[i]] = rA[i][k];
         __syncthreads();
 
-        // search pivot index 
+        // search pivot index
+        // (each thread proposes the largest of its active rows, then log-depth reduction)
         pivot_index = k;
-        pivot_value = common[k];    
-        if (pivot) {
-            for (int i = k+1; i < m; ++i) {
-                test_value = common[i];
-                if (std::abs(pivot_value) < std::abs(test_value)) {
-                    pivot_value = test_value;
-                    pivot_index = i;
+        if (PIVOT) {
+            S best = -1;
+            int best_index = m;
+            for (int i = 0; i < nrows; ++i) {
+                if (myrows[i] >= k) {
+                    S v = aabs(rA[i][k]);
+                    if (v > best || (v == best && myrows[i] < best_index)) {
+                        best = v;
+                        best_index = myrows[i];
+                    }
                 }
             }
+            pivot_index = iamax_group<S>(myrow, GETF2_MAX_THDS, best, best_index, sval, sidx);
+            // (no candidate if the column is all NaN: the pivot stays in place)
+            if (pivot_index == m)
+                pivot_index = k;
         }
+        pivot_value = common[pivot_index];
         
         // check singularity and scale value for current column 
         if (pivot_value != T(0.0))
@@ -109,7 +151,7 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
                 for (int j = k+1; j < n; ++j)
                     common[j] = rA[i][j];
             }
-            else if (myrows[i] == k) { 
+            else if (PIVOT && myrows[i] == k) { 
                 myrows[i] = pivot_index;
                 mypivs[i] = pivot_index + 1;
             }
@@ -130,7 +172,7 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
     // write results to global memory 
     if (myrow == 0)
         *info = myinfo; 
-    if (pivot) {
+    if (PIVOT) {
         for (int i = 0; i < nrows; ++i) {
             if (myrows[i] < n)
                 ipiv[myrows[i]] = mypivs[i];
@@ -147,11 +189,11 @@ LUfact_panel_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocbla
     GETF2_MAX_THDS <= m <= GETF2_OPTIM_MAX_SIZE and n = WAVESIZE
     (to be used by GETRF if block size = WAVESIZE)
 *******************************************************************/
-template <rocblas_int DIM, typename T, typename U>
+template <rocblas_int DIM, bool PIVOT, typename T, typename U>
 __global__ void __launch_bounds__(GETF2_MAX_THDS) 
 LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, const rocblas_int lda, 
                         const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_int shiftP,
-                        const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count, const int pivot)
+                        const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count)
 {
     int myrow = hipThreadIdx_x;
     int id = hipBlockIdx_x;
@@ -159,13 +201,17 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
     // batch instance
     T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
     rocblas_int *ipiv;
-    if (pivot) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
+    if (PIVOT) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
     rocblas_int *info = infoA + id;
 
     // shared memory (for communication between threads in group)
     // (SHUFFLES DO NOT IMPROVE PERFORMANCE IN THIS CASE)
+    // (the arrays for the pivot search come first)
+    using S = decltype(std::real(T{}));
     extern __shared__ double lmem[];
-    T *common = (T*)lmem;
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + GETF2_MAX_THDS);
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(GETF2_MAX_THDS));
     
     // number of rows that each thread is going to handle
     int nrows = m / GETF2_MAX_THDS;
@@ -174,7 +220,6 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
     
     // local variables
     T pivot_value;
-    T test_value;
     int tmp;
     int pivot_index;
     int myinfo = 0;         //to build info
@@ -185,7 +230,7 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
     // initialization
     for (int i = 0; i < nrows; ++i) {
         myrows[i] = myrow + i * GETF2_MAX_THDS;
-        mypivs[i] = myrows[i] + 1;
+        if (PIVOT) mypivs[i] = myrows[i] + 1;
     }
     
     // read corresponding rows from global memory into local array
@@ -204,18 +249,27 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
             common[myrows[i]] = rA[i][k];
         __syncthreads();
 
-        // search pivot index 
+        // search pivot index
+        // (each thread proposes the largest of its active rows, then log-depth reduction)
         pivot_index = k;
-        pivot_value = common[k];    
-        if (pivot) {
-            for (int i = k+1; i < m; ++i) {
-                test_value = common[i];
-                if (std::abs(pivot_value) < std::abs(test_value)) {
-                    pivot_value = test_value;
-                    pivot_index = i;
+        if (PIVOT) {
+            S best = -1;
+            int best_index = m;
+            for (int i = 0; i < nrows; ++i) {
+                if (myrows[i] >= k) {
+                    S v = aabs(rA[i][k]);
+                    if (v > best || (v == best && myrows[i] < best_index)) {
+                        best = v;
+                        best_index = myrows[i];
+                    }
                 }
             }
+            pivot_index = iamax_group<S>(myrow, GETF2_MAX_THDS, best, best_index, sval, sidx);
+            // (no candidate if the column is all NaN: the pivot stays in place)
+            if (pivot_index == m)
+                pivot_index = k;
         }
+        pivot_value = common[pivot_index];
         
         // check singularity and scale value for current column 
         if (pivot_value != T(0.0))
@@ -231,7 +285,7 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
                 for (int j = k+1; j < WAVESIZE; ++j)
                     common[j] = rA[i][j];
             }
-            else if (myrows[i] == k) { 
+            else if (PIVOT && myrows[i] == k) { 
                 myrows[i] = pivot_index;
                 mypivs[i] = pivot_index + 1;
             }
@@ -252,7 +306,7 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
     // write results to global memory 
     if (myrow == 0)
         *info = myinfo; 
-    if (pivot) {
+    if (PIVOT) {
         for (int i = 0; i < nrows; ++i) {
             if (myrows[i] < WAVESIZE)
                 ipiv[myrows[i]] = mypivs[i];
@@ -268,18 +322,17 @@ LUfact_panel_kernel_blk(const rocblas_int m, U AA, const rocblas_int shiftA, con
 /**************************************************************************
     Launcher of LUfact_panel kernels
 **************************************************************************/
-template <typename T, typename U>
+template <bool PIVOT, typename T, typename U>
 rocblas_status LUfact_panel(rocblas_handle handle, const rocblas_int m,
                              const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,
                              const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
-                             const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count,
-                             const rocblas_int pivot)
+                             const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
 {
-    #define RUN_LUFACT_PANEL(DIM)                                                                                   \
-            if (n == 64) hipLaunchKernelGGL((LUfact_panel_kernel_blk<DIM,T>),grid,block,lmemsize,stream,            \
-                                             m,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,pivot);    \
-            else hipLaunchKernelGGL((LUfact_panel_kernel<DIM,T>),grid,block,lmemsize,stream,                        \
-                                     m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,pivot)   
+    #define RUN_LUFACT_PANEL(DIM)                                                                                 \
+            if (n == 64) hipLaunchKernelGGL((LUfact_panel_kernel_blk<DIM,PIVOT,T>),grid,block,lmemsize,stream,    \
+                                             m,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count);        \
+            else hipLaunchKernelGGL((LUfact_panel_kernel<DIM,PIVOT,T>),grid,block,lmemsize,stream,                \
+                                     m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count)
 
     // determine sizes
     rocblas_int blocks = batch_count;
@@ -290,7 +343,7 @@ rocblas_status LUfact_panel(rocblas_handle handle, const rocblas_int m,
     //prepare kernel launch
     dim3 grid(blocks,1,1);
     dim3 block(nthds,1,1);
-    size_t lmemsize = msize * sizeof(T);
+    size_t lmemsize = iamax_group_lmem<decltype(std::real(T{}))>(nthds) + msize * sizeof(T);
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -315,11 +368,11 @@ rocblas_status LUfact_panel(rocblas_handle handle, const rocblas_int m,
     LUfact_small_kernel takes care of of matrices with 
     m <= GETF2_MAX_THDS and n <= WAVESIZE 
 ************************************************************************/
-template <rocblas_int DIM, typename T, typename U>
+template <rocblas_int DIM, bool PIVOT, typename T, typename U>
 __global__ void __launch_bounds__(GETF2_MAX_THDS) 
 LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const rocblas_int lda, 
                     const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_int shiftP,
-                    const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count, const int pivot)
+                    const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count)
 {
     int ty = hipThreadIdx_y;
     int myrow = hipThreadIdx_x;
@@ -331,19 +384,26 @@ LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const r
     // batch instance
     T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
     rocblas_int *ipiv;
-    if (pivot) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
+    if (PIVOT) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
     rocblas_int *info = infoA + id;
 
     // shared memory (for communication between threads in group)
     // (SHUFFLES DO NOT IMPROVE PERFORMANCE IN THIS CASE)
+    // (the arrays for the pivot search come first)
+    using S = decltype(std::real(T{}));
+    int tid = hipThreadIdx_x;
+    int nthds = hipBlockDim_x * hipBlockDim_y;
     extern __shared__ double lmem[];
-    T *common = (T*)lmem;
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + nthds);
+    sval += ty * hipBlockDim_x;
+    sidx += ty * hipBlockDim_x;
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(nthds));
     common += ty * WAVESIZE;
 
     
     // local variables
     T pivot_value;
-    T test_value;
     int pivot_index;
     int mypiv = myrow + 1;  //to build ipiv
     int myinfo = 0;         //to build info
@@ -362,18 +422,15 @@ LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const r
         common[myrow] = rA[k];
         __syncthreads();
 
-        // search pivot index 
+        // search pivot index (log-depth reduction over the rows of the group)
+        // (when k >= m there are no candidates and the pivot stays in place)
         pivot_index = k;
-        pivot_value = common[k];    
-        if (pivot) {        
-            for (int i = k+1; i < m; ++i) {
-                test_value = common[i];
-                if (std::abs(pivot_value) < std::abs(test_value)) {
-                    pivot_value = test_value;
-                    pivot_index = i;
-                }
-            }
+        if (PIVOT) {
+            pivot_index = iamax_group<S>(tid, m, myrow >= k ? aabs(rA[k]) : S(-1), myrow >= k ? myrow : m, sval, sidx);
+            if (pivot_index == m)
+                pivot_index = k;
         }
+        pivot_value = common[pivot_index];
         
         // check singularity and scale value for current column 
         if (pivot_value != T(0.0))
@@ -388,7 +445,7 @@ LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const r
             for (int j = k+1; j < DIM; ++j)
                 common[j] = rA[j];
         }
-        else if (myrow == k) { 
+        else if (PIVOT && myrow == k) { 
             myrow = pivot_index;
             mypiv = pivot_index + 1;
         }
@@ -404,7 +461,7 @@ LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const r
     }
 
     // write results to global memory 
-    if (myrow < DIM && pivot)
+    if (myrow < DIM && PIVOT)
         ipiv[myrow] = mypiv;
     if (myrow == 0)
         *info = myinfo; 
@@ -416,19 +473,18 @@ LUfact_small_kernel(const rocblas_int m, U AA, const rocblas_int shiftA, const r
 /*************************************************************
     Launcher of LUfact_small kernels
 *************************************************************/
-template <typename T, typename U>
+template <bool PIVOT, typename T, typename U>
 rocblas_status LUfact_small(rocblas_handle handle, const rocblas_int m,
                              const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,
                              const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
-                             const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count,
-                             const rocblas_int pivot)
+                             const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
 {
     #define RUN_LUFACT_SMALL(DIM)                                                               \
-        hipLaunchKernelGGL((LUfact_small_kernel<DIM,T>),grid,block,lmemsize,stream,             \
-                            m,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,pivot)
+        hipLaunchKernelGGL((LUfact_small_kernel<DIM,PIVOT,T>),grid,block,lmemsize,stream,       \
+                            m,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count)
     
     // determine sizes
-    std::vector<int> opval{GETF2_OPTIM_NGRP};
+    static constexpr int opval[] = {GETF2_OPTIM_NGRP};
     rocblas_int ngrp = (batch_count < 2 || m > 32) ? 1 : opval[m-1];
     rocblas_int blocks = (batch_count - 1)/ngrp + 1;
     rocblas_int nthds = m;
@@ -437,7 +493,7 @@ rocblas_status LUfact_small(rocblas_handle handle, const rocblas_int m,
     //prepare kernel launch
     dim3 grid(blocks,1,1);
     dim3 block(nthds,ngrp,1);
-    size_t lmemsize = msize * ngrp * sizeof(T);
+    size_t lmemsize = iamax_group_lmem<decltype(std::real(T{}))>(nthds * ngrp) + msize * ngrp * sizeof(T);
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -515,18 +571,386 @@ rocblas_status LUfact_small(rocblas_handle handle, const rocblas_int m,
     return rocblas_status_success;
 }
 
+/*************************************************************************
+    LUfact_tiled_kernel takes care of matrices with m <= GETF2_MAX_THDS 
+    and WAVESIZE < n <= GETF2_TILED_MAX_SIZE, with one work-group per instance
+    and one thread per row. The columns are factorized by tiles of GETF2_TILE_SIZE: 
+    every thread keeps its row of the current tile in registers, and the block row 
+    of U is staged in LDS (by chunks of GETF2_TILED_CHUNK columns) to update 
+    the trailing matrix, which stays in global memory.
+    Rows are swapped lazily and moved to their final position at the end.
+*************************************************************************/
+template <bool PIVOT, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS) 
+LUfact_tiled_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda, 
+                    const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_int shiftP,
+                    const rocblas_stride strideP, rocblas_int* infoA, const rocblas_int batch_count)
+{
+    constexpr int TB = GETF2_TILE_SIZE;
+    constexpr int CW = GETF2_TILED_CHUNK;
+    int tid = hipThreadIdx_x;   //the row of the matrix owned by this thread
+    int id = hipBlockIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    rocblas_int *ipiv;
+    if (PIVOT) ipiv = load_ptr_batch<rocblas_int>(ipivA,id,shiftP,strideP);
+    rocblas_int *info = infoA + id;
+
+    // shared memory 
+    // (the arrays for the pivot search come first, then the current column/pivot row, 
+    // the diagonal block L11 of the tile and the chunk of the block row of U)
+    using S = decltype(std::real(T{}));
+    extern __shared__ double lmem[];
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + m);
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(m));
+    T *sL = common + max(m, TB);
+    T *sU = sL + TB * TB;
+
+    // local variables
+    T pivot_value;
+    int pivot_index;
+    int myrow = tid;        //logical row (after the lazy interchanges)
+    int mypiv = tid + 1;    //to build ipiv
+    int myinfo = 0;         //to build info
+    T rA[TB];               //to store this-row values of the current tile
+    rocblas_int dim = min(m, n);
+
+    for (rocblas_int k0 = 0; k0 < dim; k0 += TB) {
+        rocblas_int nb = min(TB, dim - k0);
+
+        // read this-row values of the tile
+        #pragma unroll
+        for (int j = 0; j < TB; ++j) 
+            if (j < nb) rA[j] = A[tid + (k0 + j)*lda];
+
+        // factorize the tile
+        #pragma unroll
+        for (int kk = 0; kk < TB; ++kk) {
+            if (kk < nb) {
+                rocblas_int k = k0 + kk;
+
+                // share current column
+                common[myrow] = rA[kk];
+                __syncthreads();
+
+                // search pivot index
+                pivot_index = k;
+                if (PIVOT) {
+                    pivot_index = iamax_group<S>(tid, m, myrow >= k ? aabs(rA[kk]) : S(-1), myrow >= k ? myrow : m, sval, sidx);
+                    if (pivot_index == m)
+                        pivot_index = k;
+                }
+                pivot_value = common[pivot_index];
+                __syncthreads();
+
+                // check singularity and scale value for current column 
+                if (pivot_value != T(0.0))
+                    pivot_value = 1.0 / pivot_value;
+                else if (myinfo == 0)
+                    myinfo = k+1;
+
+                // swap rows (lazy swaping)
+                if (myrow == pivot_index) {
+                    myrow = k;
+                    //share pivot row
+                    #pragma unroll
+                    for (int j = kk+1; j < TB; ++j)
+                        common[j] = rA[j];
+                }
+                else if (PIVOT && myrow == k) { 
+                    myrow = pivot_index;
+                    mypiv = pivot_index + 1;
+                }
+                __syncthreads();
+
+                // scale current column and update the rest of the tile
+                if (myrow > k) {
+                    rA[kk] *= pivot_value;
+                    #pragma unroll
+                    for (int j = kk+1; j < TB; ++j) 
+                        if (j < nb) rA[j] -= rA[kk] * common[j];   
+                }
+                __syncthreads();
+            }
+        }
+
+        // write the tile back 
+        #pragma unroll
+        for (int j = 0; j < TB; ++j) 
+            if (j < nb) A[tid + (k0 + j)*lda] = rA[j];
+
+        // share L11 (held by the pivot rows of the tile)
+        bool inTile = (myrow >= k0 && myrow < k0 + nb);
+        if (inTile) {
+            #pragma unroll
+            for (int j = 0; j < TB; ++j)
+                if (j < nb) sL[(myrow - k0) + j*TB] = rA[j];
+        }
+        __syncthreads();
+
+        // trailing matrix, by chunks of columns
+        for (rocblas_int c0 = k0 + nb; c0 < n; c0 += CW) {
+            rocblas_int cw = min(CW, n - c0);
+
+            // read the pivot rows of the chunk
+            if (inTile) {
+                for (int j = 0; j < cw; ++j)
+                    sU[(myrow - k0) + j*TB] = A[tid + (c0 + j)*lda];
+            }
+            __syncthreads();
+
+            // block row of U: solve L11 * U12 = A12 (one column per thread)
+            for (int j = tid; j < cw; j += m) {
+                T* u = sU + j*TB;
+                for (int i = 0; i < nb; ++i) {
+                    for (int r = i+1; r < nb; ++r)
+                        u[r] -= sL[r + i*TB] * u[i];
+                }
+            }
+            __syncthreads();
+
+            // write U12 and update the rows below the tile
+            if (inTile) {
+                for (int j = 0; j < cw; ++j)
+                    A[tid + (c0 + j)*lda] = sU[(myrow - k0) + j*TB];
+            }
+            else if (myrow >= k0 + nb) {
+                for (int j = 0; j < cw; ++j) {
+                    T t = A[tid + (c0 + j)*lda];
+                    #pragma unroll
+                    for (int i = 0; i < TB; ++i)
+                        if (i < nb) t -= rA[i] * sU[i + j*TB];
+                    A[tid + (c0 + j)*lda] = t;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // write results to global memory
+    // (the rows are moved to their final positions by chunks of TB columns)
+    if (myrow < dim && PIVOT)
+        ipiv[myrow] = mypiv;
+    if (tid == 0)
+        *info = myinfo; 
+    for (rocblas_int c0 = 0; c0 < n; c0 += TB) {
+        rocblas_int cw = min(TB, n - c0);
+        #pragma unroll
+        for (int j = 0; j < TB; ++j) 
+            if (j < cw) rA[j] = A[tid + (c0 + j)*lda];
+        __syncthreads();
+        #pragma unroll
+        for (int j = 0; j < TB; ++j) 
+            if (j < cw) A[myrow + (c0 + j)*lda] = rA[j];
+        __syncthreads();
+    }
+}
+
+/*************************************************************
+    Launcher of LUfact_tiled kernel
+*************************************************************/
+template <bool PIVOT, typename T, typename U>
+rocblas_status LUfact_tiled(rocblas_handle handle, const rocblas_int m,
+                             const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,
+                             const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
+                             const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    // determine sizes
+    rocblas_int blocks = batch_count;
+    rocblas_int nthds = m;
+
+    //prepare kernel launch
+    dim3 grid(blocks,1,1);
+    dim3 block(nthds,1,1);
+    size_t lmemsize = iamax_group_lmem<decltype(std::real(T{}))>(nthds) 
+                      + (max(m,GETF2_TILE_SIZE) + GETF2_TILE_SIZE * (GETF2_TILE_SIZE + GETF2_TILED_CHUNK)) * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // kernel launch
+    hipLaunchKernelGGL((LUfact_tiled_kernel<PIVOT,T>),grid,block,lmemsize,stream,
+                       m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count);
+    
+    return rocblas_status_success;
+}
+
+/*************************************************************************
+    Tournament pivoting (TSLU) for tall-skinny panels:
+    the rows of the panel are split in groups of (at most) GETF2_MAX_THDS rows
+    that are factorized independently with LUfact_small. The n pivot rows of 
+    every group are then paired and factorized again (in groups of 2n rows), 
+    until only n rows remain: these are the pivots of the panel. 
+    The groups always hold the original values of the rows; the row indices 
+    of the groups are kept in idx, and the winners of every group in win.
+*************************************************************************/
+
+/** tslu_gather_leaf copies the rows of group p (a contiguous range of rows) into W 
+    (groups of r rows are padded with zero rows of index -1) **/
+template <typename T, typename U>
+__global__ void tslu_gather_leaf(const rocblas_int m, const rocblas_int n, const rocblas_int ngroups, 
+                                 U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                 T* W, rocblas_int* idx)
+{
+    int r = hipBlockDim_x;
+    int t = hipThreadIdx_x;
+    int p = hipBlockIdx_x;
+    int id = hipBlockIdx_y;
+    int g = id * ngroups + p;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* Wg = W + (size_t)g * r * n;
+    rocblas_int first = (rocblas_int)((int64_t)p * m / ngroups);
+    rocblas_int last = (rocblas_int)((int64_t)(p + 1) * m / ngroups);
+    rocblas_int row = first + t;
+
+    if (row < last) {
+        idx[g * r + t] = row;
+        for (int j = 0; j < n; ++j)
+            Wg[t + j*r] = A[row + j*lda];
+    } else {
+        idx[g * r + t] = -1;
+        for (int j = 0; j < n; ++j)
+            Wg[t + j*r] = 0;
+    }
+}
+
+/** tslu_gather_tree copies the winners of groups 2p and 2p+1 of the previous level 
+    into W (if there is no group 2p+1, it is replaced by zero rows of index -1) **/
+template <typename T, typename U>
+__global__ void tslu_gather_tree(const rocblas_int n, const rocblas_int ngroups_prev, const rocblas_int ngroups,
+                                 U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                 const rocblas_int* win, T* W, rocblas_int* idx)
+{
+    int t = hipThreadIdx_x;     // 0 <= t < 2n
+    int p = hipBlockIdx_x;
+    int id = hipBlockIdx_y;
+    int g = id * ngroups + p;
+    int s = 2*p + t / n;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* Wg = W + (size_t)g * 2 * n * n;
+    rocblas_int row = (s < ngroups_prev) ? win[(id * ngroups_prev + s) * n + t % n] : -1;
+
+    idx[g * 2 * n + t] = row;
+    for (int j = 0; j < n; ++j)
+        Wg[t + j*2*n] = (row >= 0) ? A[row + j*lda] : T(0);
+}
+
+/** tslu_select keeps the (original) indices of the n pivot rows of every group, 
+    in pivoting order. One thread per group **/
+template <typename T>
+__global__ void tslu_select(const rocblas_int n, const rocblas_int gsize, const rocblas_int ngroups,
+                            rocblas_int* idx, const rocblas_int* gipiv, rocblas_int* win)
+{
+    int g = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (g < ngroups) {
+        rocblas_int* ix = idx + g * gsize;
+        const rocblas_int* gp = gipiv + g * n;
+        for (int k = 0; k < n; ++k) {
+            rocblas_int q = gp[k] - 1;
+            rocblas_int tmp = ix[k];
+            ix[k] = ix[q];
+            ix[q] = tmp;
+            win[g * n + k] = ix[k];
+        }
+    }
+}
+
+/** tslu_set_pivots translates the final n pivot rows into the row interchanges of ipiv
+    (as if they had been chosen one after the other). One thread per instance **/
+template <typename T>
+__global__ void tslu_set_pivots(const rocblas_int n, const rocblas_int* win, rocblas_int* ipivA,
+                                const rocblas_int shiftP, const rocblas_stride strideP, const rocblas_int batch_count)
+{
+    int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (id < batch_count) {
+        rocblas_int* ipiv = ipivA + id*strideP + shiftP;
+        const rocblas_int* w = win + id * n;
+        for (int k = 0; k < n; ++k) {
+            // current position of row w[k] after the previous interchanges
+            rocblas_int pos = w[k];
+            for (int i = 0; i < k; ++i) {
+                if (pos == i) 
+                    pos = ipiv[i] - 1;
+                else if (pos == ipiv[i] - 1) 
+                    pos = i;
+            }
+            ipiv[k] = pos + 1;
+        }
+    }
+}
+
+/** getf2_tslu factorizes a tall-skinny panel (n <= WAVESIZE) with tournament pivoting:
+    the pivot rows are selected first, they are moved to the top of the panel, and then 
+    the panel is factorized without pivoting.
+    (The pivots are in general not the same as with partial pivoting) **/
+template <bool ISBATCHED, typename T, typename S, typename U>
+rocblas_status getf2_tslu(rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftA, 
+                          const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP, 
+                          const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count,
+                          T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // workspace
+    rocblas_int r = GETF2_MAX_THDS;
+    rocblas_int ngroups = (m - 1) / r + 1;
+    size_t offsets[5];
+    getf2_tslu_layout<T>(m, n, batch_count, offsets);
+    T* W = (T*)((char*)work + offsets[0]);
+    rocblas_int* idx = (rocblas_int*)((char*)work + offsets[1]);
+    rocblas_int* win = (rocblas_int*)((char*)work + offsets[2]);
+    rocblas_int* gipiv = (rocblas_int*)((char*)work + offsets[3]);
+    rocblas_int* ginfo = (rocblas_int*)((char*)work + offsets[4]);
+
+    // leaves: groups of contiguous rows
+    hipLaunchKernelGGL(tslu_gather_leaf<T>,dim3(ngroups,batch_count),dim3(r),0,stream,
+                       m,n,ngroups,A,shiftA,lda,strideA,W,idx);
+    LUfact_small<true,T>(handle,r,n,W,0,r,r*n,gipiv,0,n,ginfo,batch_count*ngroups);
+    rocblas_int blocks = (batch_count*ngroups - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(tslu_select<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       n,r,batch_count*ngroups,idx,gipiv,win);
+
+    // reduction tree
+    while (ngroups > 1) {
+        rocblas_int nprev = ngroups;
+        ngroups = (nprev - 1) / 2 + 1;
+        hipLaunchKernelGGL(tslu_gather_tree<T>,dim3(ngroups,batch_count),dim3(2*n),0,stream,
+                           n,nprev,ngroups,A,shiftA,lda,strideA,win,W,idx);
+        LUfact_small<true,T>(handle,2*n,n,W,0,2*n,2*n*n,gipiv,0,n,ginfo,batch_count*ngroups);
+        blocks = (batch_count*ngroups - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(tslu_select<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                           n,2*n,batch_count*ngroups,idx,gipiv,win);
+    }
+
+    // move the pivot rows to the top of the panel
+    blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(tslu_set_pivots<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       n,win,ipiv,shiftP,strideP,batch_count);
+    rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, 1, n, ipiv, shiftP, strideP, 1, batch_count);
+
+    // factorize without pivoting
+    return rocsolver_getf2_template<ISBATCHED,T,S>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                                   batch_count, 0, scalars, pivot_val, pivot_idx, work);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 //                      END OF OPTIMIZED KERNELS                                        //
 //////////////////////////////////////////////////////////////////////////////////////////                                                
 #endif //OPTIMAL
 
 
-template <typename T, typename U>
+template <bool PIVOT, typename T, typename U>
 __global__ void getf2_check_singularity(U AA, const rocblas_int shiftA, const rocblas_stride strideA,
                                         rocblas_int* ipivA, const rocblas_int shiftP,
                                         const rocblas_stride strideP, const rocblas_int j,
                                         const rocblas_int lda,
-                                        T* pivot_val, rocblas_int* pivot_idx, rocblas_int* info, const int pivot)
+                                        T* pivot_val, rocblas_int* pivot_idx, rocblas_int* info)
 {
     int id = hipBlockIdx_x;
     rocblas_int idx;
@@ -534,7 +958,7 @@ __global__ void getf2_check_singularity(U AA, const rocblas_int shiftA, const ro
     T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
     rocblas_int *ipiv;
     
-    if (pivot) { 
+    if (PIVOT) { 
         ipiv = ipivA + id*strideP + shiftP;
         ipiv[j] = pivot_idx[id]+j;  //update pivot index
         idx = j * lda + ipiv[j] - 1;
@@ -548,6 +972,256 @@ __global__ void getf2_check_singularity(U AA, const rocblas_int shiftA, const ro
     else pivot_val[id] = 1.0 / A[idx];
 }
 
+/** getf2_fused_kernel does all the work of column j of getf2_unblocked in a single launch:
+    pivot search, singularity check, interchange of rows j and p (in the nn columns of the block
+    starting at j0), scaling of the column and rank-1 update of the trailing columns of the block.
+    One work-group per instance; the pivot row is shared through LDS. **/
+template <bool PIVOT, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+getf2_fused_kernel(const rocblas_int m, const rocblas_int j0, const rocblas_int nn, const rocblas_int j, 
+                   U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                   rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    int nthds = hipBlockDim_x;
+    rocblas_int jn = j0 + nn;   //first column after the block
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+
+    // shared memory 
+    // (the arrays for the pivot search come first, then the pivot row)
+    extern __shared__ double lmem[];
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + nthds);
+    T *prow = (T*)((char*)lmem + iamax_group_lmem<S>(nthds));
+
+    // search pivot index
+    // (each thread proposes the largest of its rows, then log-depth reduction)
+    rocblas_int p = j;
+    if (PIVOT) {
+        S best = -1;
+        rocblas_int best_index = m;
+        for (rocblas_int i = j + tid; i < m; i += nthds) {
+            S v = aabs(A[i + j*lda]);
+            if (v > best) {
+                best = v;
+                best_index = i;
+            }
+        }
+        p = iamax_group<S>(tid, nthds, best, best_index, sval, sidx);
+        // (no candidate if the column is all NaN: the pivot stays in place)
+        if (p == m)
+            p = j;
+    }
+    T pivot_value = A[p + j*lda];
+
+    // check singularity 
+    if (tid == 0) {
+        if (PIVOT) {
+            rocblas_int *ipiv = ipivA + id*strideP + shiftP;
+            ipiv[j] = p + 1;    //use Fortran 1-based indexing
+        }
+        if (pivot_value == T(0) && info[id] == 0)
+            info[id] = j + 1;   //use Fortran 1-based indexing
+    }
+    pivot_value = (pivot_value != T(0)) ? T(1.0) / pivot_value : T(1.0);
+    __syncthreads();
+
+    // swap rows j and p and share the new row j
+    for (rocblas_int c = j0 + tid; c < jn; c += nthds) {
+        T t = A[p + c*lda];
+        if (PIVOT && p != j) {
+            A[p + c*lda] = A[j + c*lda];
+            A[j + c*lda] = t;
+        }
+        prow[c - j0] = t;
+    }
+    __syncthreads();
+
+    // scale current column and update the trailing columns of the block
+    for (rocblas_int i = j + 1 + tid; i < m; i += nthds) {
+        T l = A[i + j*lda] * pivot_value;
+        A[i + j*lda] = l;
+        for (rocblas_int c = j + 1; c < jn; ++c)
+            A[i + c*lda] -= l * prow[c - j0];
+    }
+}
+
+/** getf2_trsm_kernel solves L * X = B for the n columns of B, where L is the unit lower triangular
+    matrix of order m stored at shiftL and B is stored at shiftB (both in the same matrix A).
+    One thread per column **/
+template <typename T, typename U>
+__global__ void getf2_trsm_kernel(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftL,
+                                  const rocblas_int shiftB, const rocblas_int lda, const rocblas_stride strideA)
+{
+    int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int id = hipBlockIdx_y;
+
+    if (j < n) {
+        T* L = load_ptr_batch<T>(AA,id,shiftL,strideA);
+        T* B = load_ptr_batch<T>(AA,id,shiftB,strideA) + j*lda;
+
+        for (int i = 0; i < m - 1; ++i) {
+            T x = B[i];
+            for (int r = i + 1; r < m; ++r)
+                B[r] -= L[r + i*lda] * x;
+        }
+    }
+}
+
+/** getf2_trsm computes the block row of U of a recursive step: B = inv(L) * B.
+    L is split in halves until it is small enough for getf2_trsm_kernel; the
+    off-diagonal blocks are applied with gemm.
+    (Pointer mode must be device; scalars = {-1,0,1}) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void getf2_trsm(rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftL,
+                const rocblas_int shiftB, const rocblas_int lda, const rocblas_stride strideA,
+                const rocblas_int batch_count, T* scalars)
+{
+    if (m == 0 || n == 0)
+        return;
+
+    if (m <= GETF2_TRSM_BLOCKSIZE) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(getf2_trsm_kernel<T>,dim3(blocks,batch_count),dim3(BLOCKSIZE),0,stream,
+                           m,n,A,shiftL,shiftB,lda,strideA);
+        return;
+    }
+
+    rocblas_int m1 = m / 2;
+    rocblas_int m2 = m - m1;
+
+    // B1 = inv(L11) * B1
+    getf2_trsm<BATCHED,STRIDED,T>(handle, m1, n, A, shiftL, shiftB, lda, strideA, batch_count, scalars);
+
+    // B2 = B2 - L21 * B1
+    rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                        m2, n, m1, scalars,
+                                        A, shiftL + m1, lda, strideA,
+                                        A, shiftB, lda, strideA, scalars + 2,
+                                        A, shiftB + m1, lda, strideA, batch_count, nullptr);
+
+    // B2 = inv(L22) * B2
+    getf2_trsm<BATCHED,STRIDED,T>(handle, m2, n, A, shiftL + idx2D(m1, m1, lda), shiftB + m1, lda, strideA, batch_count, scalars);
+}
+
+/** getf2_unblocked factorizes columns j0 : j0+nn-1 of the panel (rows j0 : m-1) with level-2 operations.
+    Only the first npiv columns get a pivot; interchanges are applied to the nn columns of the block.
+    Pivot indices and info are global to the panel.
+    (Pointer mode must be device; scalars = {-1,0,1}) **/
+template <bool ISBATCHED, typename T, typename S, typename U>
+void getf2_unblocked(rocblas_handle handle, const rocblas_int m, const rocblas_int j0, const rocblas_int nn,
+                     const rocblas_int npiv, U A, const rocblas_int shiftA, const rocblas_int lda,
+                     const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
+                     const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count, const rocblas_int pivot,
+                     T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int jn = j0 + nn;   //first column after the block
+
+    // for batches of medium size panels, every column is processed by a single kernel launch
+    // (the launch overhead of the sequence of rocblas calls below would dominate)
+    if (ISBATCHED && m - j0 <= GETF2_FUSED_MAX_SIZE && nn <= GETF2_FUSED_MAX_SIZE) {
+        size_t lmemsize = iamax_group_lmem<S>(GETF2_MAX_THDS) + nn * sizeof(T);
+        for (rocblas_int j = j0; j < j0 + npiv; ++j) {
+            if (pivot)
+                hipLaunchKernelGGL((getf2_fused_kernel<true,T>), dim3(batch_count), dim3(GETF2_MAX_THDS), lmemsize, stream,
+                                   m, j0, nn, j, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+            else
+                hipLaunchKernelGGL((getf2_fused_kernel<false,T>), dim3(batch_count), dim3(GETF2_MAX_THDS), lmemsize, stream,
+                                   m, j0, nn, j, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+        }
+        return;
+    }
+
+    for (rocblas_int j = j0; j < j0 + npiv; ++j) {
+        
+        if (pivot) 
+            // find pivot. Use Fortran 1-based indexing for the ipiv array as iamax does that as well!
+            rocblasCall_iamax<ISBATCHED,T,S>(handle, m-j, A, shiftA + idx2D(j,j,lda), 1, strideA, batch_count, pivot_idx, work); 
+        
+        // adjust pivot indices and check singularity
+        if (pivot) 
+            hipLaunchKernelGGL((getf2_check_singularity<true,T>), dim3(batch_count), dim3(1), 0, stream,
+                      A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivot_val, pivot_idx, info);
+        else
+            hipLaunchKernelGGL((getf2_check_singularity<false,T>), dim3(batch_count), dim3(1), 0, stream,
+                      A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivot_val, pivot_idx, info);
+
+        if (pivot) 
+            // Swap pivot row and j-th row 
+            rocsolver_laswp_template<T>(handle, nn, A, shiftA + idx2D(0, j0, lda), lda, strideA, j+1, j+1, ipiv, shiftP, strideP, 1, batch_count);
+
+        // Compute elements J+1:M of J'th column
+        rocblasCall_scal<T>(handle, m-j-1, pivot_val, 1, A, shiftA+idx2D(j+1, j, lda), 1, strideA, batch_count);
+
+        // update trailing submatrix
+        if (j < min(m, jn) - 1) {
+            rocblasCall_ger<false,T>(handle, m-j-1, jn-j-1, scalars, 0,
+                                 A, shiftA+idx2D(j+1, j, lda), 1, strideA, 
+                                 A, shiftA+idx2D(j, j+1, lda), lda, strideA, 
+                                 A, shiftA+idx2D(j+1, j+1, lda), lda, strideA,
+                                 batch_count,nullptr); 
+        }
+    }
+}
+
+/** getf2_recursive factorizes columns j0 : j0+nn-1 of the panel (rows j0 : m-1, with nn <= m-j0).
+    The columns are split in halves: the left half is factorized recursively, the right half is 
+    updated with trsm and gemm, and then factorized recursively as well. Most of the work is
+    then done by level-3 operations, even for very tall panels.
+    (Pointer mode must be device; scalars = {-1,0,1}) **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+void getf2_recursive(rocblas_handle handle, const rocblas_int m, const rocblas_int j0, const rocblas_int nn,
+                     U A, const rocblas_int shiftA, const rocblas_int lda,
+                     const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
+                     const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count, const rocblas_int pivot,
+                     T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    if (nn <= GETF2_REC_SWITCHSIZE) {
+        getf2_unblocked<ISBATCHED,T,S>(handle, m, j0, nn, nn, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                       batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+        return;
+    }
+
+    rocblas_int n1 = nn / 2;
+    rocblas_int n2 = nn - n1;
+    rocblas_int j1 = j0 + n1;
+
+    // factorize left half [A11; A21]
+    getf2_recursive<BATCHED,STRIDED,T,S>(handle, m, j0, n1, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                         batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+
+    // apply interchanges to right half
+    if (pivot) 
+        rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, j1, lda), lda, strideA, j0 + 1, j1, ipiv, shiftP, strideP, 1, batch_count);
+
+    // A12 = inv(L11) * A12
+    getf2_trsm<BATCHED,STRIDED,T>(handle, n1, n2, A, shiftA + idx2D(j0, j0, lda), shiftA + idx2D(j0, j1, lda), lda, strideA, batch_count, scalars);
+
+    // A22 = A22 - A21 * A12
+    rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                        m - j1, n2, n1, scalars,
+                                        A, shiftA + idx2D(j1, j0, lda), lda, strideA,
+                                        A, shiftA + idx2D(j0, j1, lda), lda, strideA, scalars + 2,
+                                        A, shiftA + idx2D(j1, j1, lda), lda, strideA, batch_count, nullptr);
+
+    // factorize right half [A22; A32]
+    getf2_recursive<BATCHED,STRIDED,T,S>(handle, m, j1, n2, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                         batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+
+    // apply interchanges of the right half to left half
+    if (pivot) 
+        rocsolver_laswp_template<T>(handle, n1, A, shiftA + idx2D(0, j0, lda), lda, strideA, j1 + 1, j0 + nn, ipiv, shiftP, strideP, 1, batch_count);
+}
+
 template <typename T, typename S>
 void rocsolver_getf2_getMemorySize(const rocblas_int m, const rocblas_int batch_count,
                                   size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
@@ -566,9 +1240,33 @@ void rocsolver_getf2_getMemorySize(const rocblas_int m, const rocblas_int batch_
     
 }
 
+// workspace of getf2 on m-by-n panels when tournament pivoting is enabled
+// (it is only used on tall-skinny panels beyond the optimized sizes)
+template <typename T>
+size_t rocsolver_getf2_tslu_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+{
+    size_t offsets[5];
+    if (m <= GETF2_OPTIM_MAX_SIZE || n > WAVESIZE)
+        return 0;
+    return getf2_tslu_layout<T>(m, n, batch_count, offsets);
+}
+
+// true if getf2 factorizes the whole m-by-n matrices of the batch with one launch of the 
+// tiled kernel (getrf must then call getf2 instead of the blocked algorithm)
+template <bool ISBATCHED>
+inline bool getf2_use_tiled(const rocblas_int m, const rocblas_int n)
+{
+    #ifdef OPTIMAL
+    return ISBATCHED && n > WAVESIZE && n <= GETF2_TILED_MAX_SIZE && m <= GETF2_MAX_THDS;
+    #else
+    return false;
+    #endif
+}
+
 template <typename T>
 rocblas_status rocsolver_getf2_getrf_argCheck(const rocblas_int m, const rocblas_int n, const rocblas_int lda, 
-                                              T A, rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count = 1)
+                                              T A, rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count = 1,
+                                              const int pivot = 1)
 {
     // order is important for unit tests:
 
@@ -580,7 +1278,8 @@ rocblas_status rocsolver_getf2_getrf_argCheck(const rocblas_int m, const rocblas
         return rocblas_status_invalid_size;
 
     // 3. invalid pointers
-    if ((m*n && !A) || (m*n && !ipiv) || (batch_count && !info))
+    // (ipiv is not referenced by the npvt variants)
+    if ((m*n && !A) || (m*n && pivot && !ipiv) || (batch_count && !info))
         return rocblas_status_invalid_pointer;
     
     return rocblas_status_continue;
@@ -591,7 +1290,8 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
                                         const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP, 
                                         const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count, const rocblas_int pivot, 
-                                        T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work)
+                                        T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_index_value_t<S> *work,
+                                        const bool tournament)
 {
     // quick return if zero instances in batch
     if (batch_count == 0)
@@ -615,12 +1315,21 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
 
     #ifdef OPTIMAL
     // Use optimized LU factorization for the right sizes
+    // (the kernels without pivoting are separate instantiations, with no pivot search at all)
     if (n <= WAVESIZE) {
         if (m <= GETF2_MAX_THDS) 
-            return LUfact_small<T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,pivot);
+            return pivot ? LUfact_small<true,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count)
+                         : LUfact_small<false,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count);
         else if ((m <= GETF2_OPTIM_MAX_SIZE && !ISBATCHED) || (m <= GETF2_BATCH_OPTIM_MAX_SIZE && ISBATCHED)) 
-            return LUfact_panel<T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,pivot);
+            return pivot ? LUfact_panel<true,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count)
+                         : LUfact_panel<false,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count);
+        else if (pivot && tournament)
+            return getf2_tslu<ISBATCHED,T,S>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,
+                                             scalars,pivot_val,pivot_idx,work);
     }
+    else if (getf2_use_tiled<ISBATCHED>(m,n))
+        return pivot ? LUfact_tiled<true,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count)
+                     : LUfact_tiled<false,T>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count);
     #endif
 
     // everything must be executed with scalars on the device
@@ -628,30 +1337,23 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
     rocblas_get_pointer_mode(handle,&old_mode);
     rocblas_set_pointer_mode(handle,rocblas_pointer_mode_device);    
 
-    for (rocblas_int j = 0; j < dim; ++j) {
-        
-        if (pivot) 
-            // find pivot. Use Fortran 1-based indexing for the ipiv array as iamax does that as well!
-            rocblasCall_iamax<ISBATCHED,T,S>(handle, m-j, A, shiftA + idx2D(j,j,lda), 1, strideA, batch_count, pivot_idx, work); 
-        
-        // adjust pivot indices and check singularity
-        hipLaunchKernelGGL(getf2_check_singularity<T>, dim3(batch_count), dim3(1), 0, stream,
-                  A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivot_val, pivot_idx, info, pivot);
-
-        if (pivot) 
-            // Swap pivot row and j-th row 
-            rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, j+1, j+1, ipiv, shiftP, strideP, 1, batch_count);
+    static constexpr bool BATCHED = ISBATCHED && !std::is_same<U,T*>::value;
+    static constexpr bool STRIDED = ISBATCHED && !BATCHED;
 
-        // Compute elements J+1:M of J'th column
-        rocblasCall_scal<T>(handle, m-j-1, pivot_val, 1, A, shiftA+idx2D(j+1, j, lda), 1, strideA, batch_count);
+    if (dim <= GETF2_REC_SWITCHSIZE) {
+        // narrow panels are factorized column by column
+        getf2_unblocked<ISBATCHED,T,S>(handle, m, 0, n, dim, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                       batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+    } else {
+        // wider panels are factorized recursively 
+        getf2_recursive<BATCHED,STRIDED,T,S>(handle, m, 0, dim, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, 
+                                             batch_count, pivot, scalars, pivot_val, pivot_idx, work);
 
-        // update trailing submatrix
-        if (j < min(m, n) - 1) {
-            rocblasCall_ger<false,T>(handle, m-j-1, n-j-1, scalars, 0,
-                                 A, shiftA+idx2D(j+1, j, lda), 1, strideA, 
-                                 A, shiftA+idx2D(j, j+1, lda), lda, strideA, 
-                                 A, shiftA+idx2D(j+1, j+1, lda), lda, strideA,
-                                 batch_count,nullptr); 
+        // columns beyond the last pivot (when n > m)
+        if (n > dim) {
+            if (pivot) 
+                rocsolver_laswp_template<T>(handle, n - dim, A, shiftA + idx2D(0, dim, lda), lda, strideA, 1, dim, ipiv, shiftP, strideP, 1, batch_count);
+            getf2_trsm<BATCHED,STRIDED,T>(handle, dim, n - dim, A, shiftA, shiftA + idx2D(0, dim, lda), lda, strideA, batch_count, scalars);
         }
     }
 
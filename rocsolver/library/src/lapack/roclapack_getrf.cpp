@@ -15,7 +15,7 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle, const rocblas_int m,
     //logging is missing ???    
 
     // argument checking
-    rocblas_status st = rocsolver_getf2_getrf_argCheck(m,n,lda,A,ipiv,info);
+    rocblas_status st = rocsolver_getf2_getrf_argCheck(m,n,lda,A,ipiv,info,1,pivot);
     if (st != rocblas_status_continue)
         return st;
 
@@ -23,16 +23,21 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_stride strideP = 0;
     rocblas_int batch_count = 1;
 
+    // tournament pivoting is an option of the handle
+    const bool tournament = pivot && rocsolver_get_handle_data(handle)->tournament_pivoting;
+
     // memory managment
     using S = decltype(std::real(T{}));
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;
     size_t size_3;
     size_t size_4;
     size_t size_5;
-    rocsolver_getrf_getMemorySize<T,S>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+    rocsolver_getrf_getMemorySize<T,S>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,tournament);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
     void *scalars, *pivot_val, *pivot_idx, *iinfo, *work, *x_temp, *x_temp_arr, *invA, *invA_arr;
     // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
     rocblas_status perf_status = rocblasCall_trsm_mem<false,T,U>(handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,n,batch_count,x_temp,x_temp_arr,invA,invA_arr);    
@@ -40,18 +45,19 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle, const rocblas_int m,
         return perf_status;
     bool optim_mem = perf_status == rocblas_status_success;
     
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&pivot_val,size_2);
-    hipMalloc(&pivot_idx,size_3);
-    hipMalloc(&iinfo,size_4);
-    hipMalloc(&work,size_5);
-    if (!scalars || (size_2 && !pivot_val) || (size_3 && !pivot_idx) || (size_4 && !iinfo) || (size_5 && !work))
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5);
+    if (!mem)
         return rocblas_status_memory_error;
+    pivot_val = mem[0];
+    pivot_idx = mem[1];
+    iinfo = mem[2];
+    work = mem[3];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -70,13 +76,9 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle, const rocblas_int m,
                                                     x_temp_arr,
                                                     invA,
                                                     invA_arr,
-                                                    optim_mem);
+                                                    optim_mem,
+                                                    tournament);
 
-    hipFree(scalars);
-    hipFree(pivot_val);
-    hipFree(pivot_idx);
-    hipFree(iinfo);
-    hipFree(work);
     return status;
 }
 
@@ -116,29 +118,25 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf(rocblas_handle handle, const ro
 ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
                  float *A, const rocblas_int lda, rocblas_int* info) 
 {
-    rocblas_int *ipiv;
-    return rocsolver_getrf_impl<float>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getrf_impl<float>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
                  double *A, const rocblas_int lda, rocblas_int* info) 
 {
-    rocblas_int *ipiv;
-    return rocsolver_getrf_impl<double>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getrf_impl<double>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
                  rocblas_float_complex *A, const rocblas_int lda, rocblas_int* info) 
 {
-    rocblas_int *ipiv;
-    return rocsolver_getrf_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getrf_impl<rocblas_float_complex>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_npvt(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
                  rocblas_double_complex *A, const rocblas_int lda, rocblas_int* info) 
 {
-    rocblas_int *ipiv;
-    return rocsolver_getrf_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info, 0);
+    return rocsolver_getrf_impl<rocblas_double_complex>(handle, m, n, A, lda, nullptr, info, 0);
 }
 
 } //extern C
@@ -12,12 +12,14 @@
 
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "handle.hpp"
+#include "host_lu.hpp"
 #include "roclapack_getf2.hpp"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
-template<typename U>
+template<bool PIVOT, typename U>
 __global__ void getrf_check_singularity(const rocblas_int n, const rocblas_int j, rocblas_int *ipivA, const rocblas_int shiftP,
-                                const rocblas_stride strideP, const rocblas_int *iinfo, rocblas_int *info, const int pivot) {
+                                const rocblas_stride strideP, const rocblas_int *iinfo, rocblas_int *info) {
     int id = hipBlockIdx_y;
     rocblas_int *ipiv;
 
@@ -26,17 +28,195 @@ __global__ void getrf_check_singularity(const rocblas_int n, const rocblas_int j
 
     int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    if (tid < n && pivot) {
+    if (PIVOT && tid < n) {
         ipiv = ipivA + id*strideP + shiftP;
         ipiv[tid] += j;
     }
 }
 
+/** getrf_update computes the block row of U and updates the trailing submatrix for the 
+    columns jc : jc+nc-1, once the panel j : j+jb-1 has been factorized and its 
+    interchanges applied **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void getrf_update(rocblas_handle handle, const rocblas_int m, const rocblas_int j, const rocblas_int jb,
+                  const rocblas_int jc, const rocblas_int nc, U A, const rocblas_int shiftA, const rocblas_int lda,
+                  const rocblas_stride strideA, const rocblas_int batch_count, T* one, T* minone, bool optim_mem,
+                  void* x_temp, void* x_temp_arr, void* invA, void* invA_arr)
+{
+    // compute block row of U
+    rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none, rocblas_diagonal_unit,
+                                jb, nc, one,
+                                A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                A, shiftA + idx2D(j, jc, lda), lda, strideA, batch_count, optim_mem, 
+                                x_temp, x_temp_arr, invA, invA_arr);    
+
+    // update trailing submatrix
+    if (j + jb < m) {
+        rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                        m - j - jb, nc, jb, minone,
+                                        A, shiftA+idx2D(j + jb, j, lda), lda, strideA,
+                                        A, shiftA+idx2D(j, jc, lda), lda, strideA, one,
+                                        A, shiftA+idx2D(j + jb, jc, lda), lda, strideA, batch_count, nullptr);
+    }
+}
+
+// true if getrf factorizes the panels on the host (see rocsolver_set_hybrid_getrf)
+template <bool ISBATCHED>
+inline bool getrf_use_hybrid(const rocsolver_handle_data* data, const rocblas_int m, const rocblas_int n)
+{
+    return !ISBATCHED && data->hybrid_threads > 0 && !data->capture_mode && m >= GETRF_HYBRID_MIN_SIZE;
+}
+
+// true if getrf runs the blocked algorithm (otherwise getf2 factorizes the whole matrices)
+template <bool ISBATCHED>
+inline bool getrf_use_blocked(const rocblas_int m, const rocblas_int n)
+{
+    return !(m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE || getf2_use_tiled<ISBATCHED>(m, n));
+}
+
+// size in bytes of each buffer of the hybrid getrf: a panel, its pivots and the info
+template <typename T>
+inline size_t getrf_hybrid_buffer_size(const rocblas_int m)
+{
+    return sizeof(T) * m * GETRF_GETF2_SWITCHSIZE + sizeof(rocblas_int) * (GETRF_GETF2_SWITCHSIZE + 1);
+}
+
+/** rocsolver_getrf_options are the settings of the handle used by the blocked getrf, so that
+    they can be resolved once (per call, or at the creation of a plan) instead of being 
+    looked up in the template **/
+struct rocsolver_getrf_options
+{
+    bool tournament = false;                    // tournament pivoting of the tall-skinny panels
+    rocsolver_side_stream* side = nullptr;      // look-ahead on the side stream (if not null)
+    rocsolver_host_panel* host_panel = nullptr; // hybrid mode with these host buffers (if not null)
+};
+
+/** rocsolver_getrf_get_options reads the options of the handle for the blocked factorization of 
+    m-by-n matrices, and gets the side stream or the host buffers that they need **/
+template <bool ISBATCHED, typename T>
+rocblas_status rocsolver_getrf_get_options(rocsolver_handle_data* data, const rocblas_int m, const rocblas_int n,
+                                           rocsolver_getrf_options* opt)
+{
+    if (getrf_use_hybrid<ISBATCHED>(data, m, n)) {
+        opt->host_panel = rocsolver_get_host_panel(data, getrf_hybrid_buffer_size<T>(m));
+        if (!opt->host_panel)
+            return rocblas_status_memory_error;
+    }
+    // (only worth it if there are at least two panels)
+    else if (data->lookahead && min(m, n) > GETRF_GETF2_SWITCHSIZE)
+        opt->side = rocsolver_get_side_stream(data);
+
+    return rocblas_status_success;
+}
+
+/** getrf_hybrid factorizes the matrix with the panels factorized on the host: while the host 
+    factorizes panel j+1 (copied to a pinned buffer), the device updates the rest of the trailing 
+    matrix with panel j. The two buffers alternate, so that the copy of a factorized panel back to the 
+    device can still be in flight while the next one is factorized.
+    (Pointer mode must be host. The buffers must have at least getrf_hybrid_buffer_size bytes) **/
+template <typename T>
+rocblas_status getrf_hybrid(rocblas_handle handle, const rocblas_int m, const rocblas_int n, T* A, 
+                            const rocblas_int shiftA, const rocblas_int lda, rocblas_int *ipiv, const rocblas_int shiftP, 
+                            rocblas_int *info, const rocblas_int pivot, T* one, T* minone, 
+                            void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                            rocsolver_host_panel* hp)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int nb = GETRF_GETF2_SWITCHSIZE;
+    rocblas_int dim = min(m, n);
+    rocblas_int jb, jnext, nahead;
+
+    // each buffer holds a panel, its pivots and the info
+    size_t panel_size = sizeof(T) * m * nb;
+    T* hA[2] = {(T*)hp->buffer[0], (T*)hp->buffer[1]};
+    rocblas_int* hP[2] = {(rocblas_int*)((char*)hp->buffer[0] + panel_size), (rocblas_int*)((char*)hp->buffer[1] + panel_size)};
+    rocblas_int hinfo = 0;
+
+    T* dA = A + shiftA;
+    rocblas_int* dP = ipiv + shiftP;
+    auto download = [&](rocblas_int j, int b) {
+        return hipMemcpy2DAsync(hA[b], sizeof(T) * (m - j), dA + idx2D(j, j, lda), sizeof(T) * lda,
+                                sizeof(T) * (m - j), min(dim - j, nb), hipMemcpyDeviceToHost, stream) == hipSuccess
+               && hipEventRecord(hp->ready[b], stream) == hipSuccess;
+    };
+
+    if (!download(0, 0))
+        return rocblas_status_internal_error;
+    int b = 0;
+    for (rocblas_int j = 0; j < dim; j += nb, b = 1 - b) {
+        jb = min(dim - j, nb);
+
+        // factorize the panel on the host once it is in the buffer
+        if (hipEventSynchronize(hp->ready[b]) != hipSuccess)
+            return rocblas_status_internal_error;
+        rocblas_int pinfo = rocsolver_host_getrf_panel<T>(m - j, jb, hA[b], m - j, hP[b], pivot, hp->pool.get());
+        if (hinfo == 0 && pinfo > 0)
+            hinfo = pinfo + j;
+        if (pivot) {
+            for (rocblas_int k = 0; k < jb; ++k)
+                hP[b][k] += j;
+        }
+
+        // copy it back with its pivots
+        if (hipMemcpy2DAsync(dA + idx2D(j, j, lda), sizeof(T) * lda, hA[b], sizeof(T) * (m - j), 
+                             sizeof(T) * (m - j), jb, hipMemcpyHostToDevice, stream) != hipSuccess)
+            return rocblas_status_internal_error;
+        if (pivot) {
+            if (hipMemcpyAsync(dP + j, hP[b], sizeof(rocblas_int) * jb, hipMemcpyHostToDevice, stream) != hipSuccess)
+                return rocblas_status_internal_error;
+
+            // apply interchanges to columns 1 : j-1 and j+jb : n
+            rocsolver_laswp_template<T>(handle, j, A, shiftA, lda, 0, j + 1, j + jb, ipiv, shiftP, 0, 1, 1);
+            if (j + jb < n)
+                rocsolver_laswp_template<T>(handle, n - j - jb, A, shiftA + idx2D(0, j + jb, lda), lda, 0, 
+                                            j + 1, j + jb, ipiv, shiftP, 0, 1, 1);
+        }
+
+        if (j + jb < n) {
+            // update the next panel and copy it to the other buffer, then update
+            // the rest of the trailing matrix while the host factorizes it
+            jnext = j + jb;
+            nahead = jnext < dim ? min(n - jnext, nb) : n - jnext;
+            getrf_update<false,false,T>(handle, m, j, jb, jnext, nahead, A, shiftA, lda, 0, 1, 
+                                        one, minone, optim_mem, x_temp, x_temp_arr, invA, invA_arr);
+            if (jnext < dim && !download(jnext, 1 - b))
+                return rocblas_status_internal_error;
+            if (nahead < n - jnext)
+                getrf_update<false,false,T>(handle, m, j, jb, jnext + nahead, n - jnext - nahead, A, shiftA, lda, 0, 1, 
+                                            one, minone, optim_mem, x_temp, x_temp_arr, invA, invA_arr);
+        }
+    }
+
+    // info of the matrix (the buffers can be reused once the stream is done with them)
+    hP[b][nb] = hinfo;
+    if (hipMemcpyAsync(info, hP[b] + nb, sizeof(rocblas_int), hipMemcpyHostToDevice, stream) != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    return rocblas_status_success;
+}
+
+// (only non-batched matrices are factorized in hybrid mode)
+template <typename T, typename U>
+rocblas_status getrf_hybrid(rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A, 
+                            const rocblas_int shiftA, const rocblas_int lda, rocblas_int *ipiv, const rocblas_int shiftP, 
+                            rocblas_int *info, const rocblas_int pivot, T* one, T* minone, 
+                            void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                            rocsolver_host_panel* hp)
+{
+    return rocblas_status_not_implemented;
+}
+
 template <typename T, typename S>
-void rocsolver_getrf_getMemorySize(const rocblas_int n, const rocblas_int m, const rocblas_int batch_count,
-                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5)
+void rocsolver_getrf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5,
+                                  const bool tournament = false)
 {
     rocsolver_getf2_getMemorySize<T,S>(m,batch_count,size_1,size_2,size_3,size_5);
+    if (tournament)
+        *size_5 = std::max(*size_5, rocsolver_getf2_tslu_getMemorySize<T>(m,min(n,GETRF_GETF2_SWITCHSIZE),batch_count));
     if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) {
         *size_4 = 0;
     } else {
@@ -49,17 +229,20 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
                                         rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count,
                                         const rocblas_int pivot, T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_int* iinfo, rocblas_index_value_t<S> *work,
-                                        void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem)
+                                        void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                                        const rocsolver_getrf_options& opt)
 {
     // quick return
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
+    const bool tournament = opt.tournament;
 
     // if the matrix is small, use the unblocked (level-2-blas) variant of the algorithm
-    if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) 
-        return rocsolver_getf2_template<ISBATCHED,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+    // (this includes the batches that getf2 factorizes with the tiled kernel)
+    if (!getrf_use_blocked<ISBATCHED>(m, n)) 
+        return rocsolver_getf2_template<ISBATCHED,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot, scalars, pivot_val, pivot_idx, work, tournament);
     
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
@@ -85,19 +268,42 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
     //info=0 (starting with a nonsingular matrix)
     hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
+    // hybrid mode: the panels are factorized on the host
+    if (opt.host_panel) {
+        rocblas_status status = getrf_hybrid<T>(handle, m, n, A, shiftA, lda, ipiv, shiftP, info, pivot, &one, &minone, 
+                                                x_temp, x_temp_arr, invA, invA_arr, optim_mem, opt.host_panel);
+        rocblas_set_pointer_mode(handle,old_mode);
+        return status;
+    }
+
+    // look-ahead: the next panel is factorized on the side stream while the 
+    // trailing matrix is updated
+    rocsolver_side_stream* side = opt.side;
+    bool factorized = false;    //the current panel was factorized ahead
+    rocblas_int nahead, jnext;
+
     for (rocblas_int j = 0; j < dim; j += GETRF_GETF2_SWITCHSIZE) {
         // Factor diagonal and subdiagonal blocks 
         jb = min(dim - j, GETRF_GETF2_SWITCHSIZE);  //number of columns in the block
-        hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
-        rocsolver_getf2_template<ISBATCHED,T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, 
-                                              batch_count, pivot, scalars, pivot_val, pivot_idx, work);
+        if (factorized) {
+            hipStreamWaitEvent(stream, side->join, 0);
+        } else {
+            hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
+            rocsolver_getf2_template<ISBATCHED,T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, 
+                                                  batch_count, pivot, scalars, pivot_val, pivot_idx, work, tournament);
+        }
+        factorized = false;
         
         // adjust pivot indices and check singularity
         sizePivot = min(m - j, jb);     //number of pivots in the block
         blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1; 
         gridPivot = dim3(blocksPivot, batch_count, 1);
-        hipLaunchKernelGGL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
-			   sizePivot,j,ipiv,shiftP + j,strideP,iinfo,info,pivot);
+        if (pivot)
+            hipLaunchKernelGGL((getrf_check_singularity<true,U>),gridPivot,threads,0,stream,
+                               sizePivot,j,ipiv,shiftP + j,strideP,iinfo,info);
+        else
+            hipLaunchKernelGGL((getrf_check_singularity<false,U>),gridPivot,threads,0,stream,
+                               sizePivot,j,ipiv,shiftP + j,strideP,iinfo,info);
 
         // apply interchanges to columns 1 : j-1
         if (pivot) rocsolver_laswp_template<T>(handle, j, A, shiftA, lda, strideA, j + 1, j + jb, ipiv, shiftP, strideP, 1, batch_count);
@@ -110,21 +316,30 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
                                             ipiv, shiftP, strideP, 1, batch_count);
             }
 
-            // compute block row of U
-            rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none, rocblas_diagonal_unit,
-                                        jb, (n - j - jb), &one,
-                                        A, shiftA + idx2D(j, j, lda), lda, strideA, 
-                                        A, shiftA + idx2D(j, j+jb, lda), lda, strideA, batch_count, optim_mem, 
-                                        x_temp, x_temp_arr, invA, invA_arr);    
-    
-            // update trailing submatrix
-            if (j + jb < m) {
-                rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
-                                                m - j - jb, n - j - jb, jb, &minone,
-                                                A, shiftA+idx2D(j + jb, j, lda), lda, strideA,
-                                                A, shiftA+idx2D(j, j + jb, lda), lda, strideA, &one,
-                                                A, shiftA+idx2D(j + jb, j + jb, lda), lda, strideA, batch_count, nullptr);
+            // columns updated first (only the next panel when using look-ahead)
+            nahead = side ? min(n - j - jb, GETRF_GETF2_SWITCHSIZE) : n - j - jb;
+            getrf_update<BATCHED,STRIDED,T>(handle, m, j, jb, j + jb, nahead, A, shiftA, lda, strideA, batch_count, 
+                                            &one, &minone, optim_mem, x_temp, x_temp_arr, invA, invA_arr);
+
+            // factorize the next panel on the side stream
+            jnext = j + jb;
+            if (side && jnext < dim) {
+                hipEventRecord(side->fork, stream);
+                hipStreamWaitEvent(side->stream, side->fork, 0);
+                rocblas_set_stream(handle, side->stream);
+                hipLaunchKernelGGL(reset_info,gridReset,threads,0,side->stream,iinfo,batch_count,0);
+                rocsolver_getf2_template<ISBATCHED,T>(handle, m - jnext, min(dim - jnext, GETRF_GETF2_SWITCHSIZE), A, shiftA + idx2D(jnext, jnext, lda), 
+                                                      lda, strideA, ipiv, shiftP + jnext, strideP, iinfo, 
+                                                      batch_count, pivot, scalars, pivot_val, pivot_idx, work, tournament);
+                hipEventRecord(side->join, side->stream);
+                rocblas_set_stream(handle, stream);
+                factorized = true;
             }
+
+            // update the rest of the trailing submatrix
+            if (nahead < n - j - jb)
+                getrf_update<BATCHED,STRIDED,T>(handle, m, j, jb, j + jb + nahead, n - j - jb - nahead, A, shiftA, lda, strideA, batch_count, 
+                                                &one, &minone, optim_mem, x_temp, x_temp_arr, invA, invA_arr);
         } 
     }
 
@@ -132,5 +347,27 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
     return rocblas_status_success;
 }
 
+// (the options are read from the handle)
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int m,
+                                        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count,
+                                        const rocblas_int pivot, T* scalars, T* pivot_val, rocblas_int* pivot_idx, rocblas_int* iinfo, rocblas_index_value_t<S> *work,
+                                        void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                                        const bool tournament = false)
+{
+    rocsolver_getrf_options opt;
+    opt.tournament = tournament;
+    if (m && n && batch_count && getrf_use_blocked<BATCHED || STRIDED>(m, n)) {
+        rocblas_status status = rocsolver_getrf_get_options<BATCHED || STRIDED,T>(rocsolver_get_handle_data(handle), m, n, &opt);
+        if (status != rocblas_status_success)
+            return status;
+    }
+
+    return rocsolver_getrf_template<BATCHED,STRIDED,T,S>(handle,m,n,A,shiftA,lda,strideA,ipiv,shiftP,strideP,info,batch_count,
+                                                         pivot,scalars,pivot_val,pivot_idx,iinfo,work,
+                                                         x_temp,x_temp_arr,invA,invA_arr,optim_mem,opt);
+}
+
 
 #endif /* ROCLAPACK_GETRF_HPP */
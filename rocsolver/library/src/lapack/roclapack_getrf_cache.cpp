@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf_cache.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrf_cache_impl(rocblas_handle handle, const rocblas_int n, T *A, const rocblas_int lda,
+                                          rocblas_int *ipiv, T *cache, rocblas_int *info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_getrf_cache_argCheck(n,lda,A,ipiv,cache,info);
+    if (st != rocblas_status_continue)
+        return st;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // tournament pivoting is an option of the handle
+    const bool tournament = rocsolver_get_handle_data(handle)->tournament_pivoting;
+
+    // memory managment
+    using S = decltype(std::real(T{}));
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
+    size_t size_2;
+    size_t size_3;
+    size_t size_4;
+    size_t size_5;
+    rocsolver_getrf_getMemorySize<T,S>(n,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,tournament);
+    size_t size_6;  //workspace for the inversion of the diagonal blocks
+    size_t size_7;  //info of the inversion of the diagonal blocks
+    rocsolver_getrf_cache_getMemorySize<T>(n,&size_6,&size_7);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5,size_6,size_7);
+
+    void *scalars, *pivot_val, *pivot_idx, *iinfo, *work, *trtri_work, *trtri_info, *x_temp, *x_temp_arr, *invA, *invA_arr;
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    rocblas_status perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,n,batch_count,x_temp,x_temp_arr,invA,invA_arr);
+    if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+    bool optim_mem = perf_status == rocblas_status_success;
+
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5,size_6,size_7);
+    if (!mem)
+        return rocblas_status_memory_error;
+    pivot_val = mem[0];
+    pivot_idx = mem[1];
+    iinfo = mem[2];
+    work = mem[3];
+    trtri_work = mem[4];
+    trtri_info = mem[5];
+
+    // scalar constants for rocblas functions calls
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    // execution
+    rocblas_status status =
+           rocsolver_getrf_template<false,false,T,S>(handle,n,n,
+                                                    A,0,
+                                                    lda,strideA,
+                                                    ipiv,0,
+                                                    strideP,
+                                                    info,batch_count,1,
+                                                    (T*)scalars,
+                                                    (T*)pivot_val,
+                                                    (rocblas_int*)pivot_idx,
+                                                    (rocblas_int*)iinfo,
+                                                    (rocblas_index_value_t<S>*)work,
+                                                    x_temp,
+                                                    x_temp_arr,
+                                                    invA,
+                                                    invA_arr,
+                                                    optim_mem,
+                                                    tournament);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getrf_cache_template<T>(handle,n,A,lda,cache,(T*)scalars,(T*)trtri_work,(rocblas_int*)trtri_info);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_factor_cache_size(rocblas_handle handle, const rocblas_int n, size_t *size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if (n < 0)
+        return rocblas_status_invalid_size;
+    if (!size)
+        return rocblas_status_invalid_pointer;
+
+    *size = getrf_cache_size(n);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_cache(rocblas_handle handle, const rocblas_int n,
+                 float *A, const rocblas_int lda, rocblas_int *ipiv, float *cache, rocblas_int* info)
+{
+    return rocsolver_getrf_cache_impl<float>(handle, n, A, lda, ipiv, cache, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_cache(rocblas_handle handle, const rocblas_int n,
+                 double *A, const rocblas_int lda, rocblas_int *ipiv, double *cache, rocblas_int* info)
+{
+    return rocsolver_getrf_cache_impl<double>(handle, n, A, lda, ipiv, cache, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_cache(rocblas_handle handle, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *cache, rocblas_int* info)
+{
+    return rocsolver_getrf_cache_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, cache, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_cache(rocblas_handle handle, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *cache, rocblas_int* info)
+{
+    return rocsolver_getrf_cache_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, cache, info);
+}
+
+} //extern C
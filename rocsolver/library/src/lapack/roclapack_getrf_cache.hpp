@@ -0,0 +1,166 @@
+/************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GETRF_CACHE_HPP
+#define ROCLAPACK_GETRF_CACHE_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "../auxiliary/rocauxiliary_trtri.hpp"
+
+/*
+ * The factor cache keeps the inverses of the ROCBLAS_TRSM_BLOCK x ROCBLAS_TRSM_BLOCK
+ * diagonal blocks of the factors L and U computed by getrf, in the layout used by
+ * rocBLAS trsm for its supplied_invA argument: block i starts at i*BLOCK*BLOCK and
+ * has leading dimension BLOCK. The blocks of L are stored first, followed by the
+ * blocks of U (BLOCK*n elements each). With the cache, the triangular solves in
+ * getrs are (mostly) gemm operations.
+ */
+
+// number of elements of the factor cache of a matrix of order n
+inline size_t getrf_cache_size(const rocblas_int n)
+{
+    return 2 * size_t(ROCBLAS_TRSM_BLOCK) * n;
+}
+
+// getrf_cache_copy writes the diagonal blocks of the factors into the cache.
+// The blocks of L are stored transposed (as unit upper triangular matrices)
+// so that they can be inverted by trtri.
+template <typename T>
+__global__ void getrf_cache_copy(const rocblas_int n, T* A, const rocblas_int lda, T* cacheL, T* cacheU)
+{
+    rocblas_int ii = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if (ii < ROCBLAS_TRSM_BLOCK && j < n)
+    {
+        rocblas_int b = j / ROCBLAS_TRSM_BLOCK;
+        rocblas_int jj = j % ROCBLAS_TRSM_BLOCK;
+        rocblas_int i = b * ROCBLAS_TRSM_BLOCK + ii;
+        size_t c = size_t(ROCBLAS_TRSM_BLOCK) * j + ii;
+
+        if (i < n)
+        {
+            cacheU[c] = (ii <= jj) ? A[i + j*lda] : 0;
+            cacheL[c] = (ii < jj) ? A[j + i*lda] : (ii == jj ? 1 : 0);
+        }
+    }
+}
+
+// getrf_cache_transpose transposes in place the (inverted) diagonal blocks of L
+template <typename T>
+__global__ void getrf_cache_transpose(const rocblas_int n, T* cacheL)
+{
+    rocblas_int ii = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if (ii < ROCBLAS_TRSM_BLOCK && j < n)
+    {
+        rocblas_int b = j / ROCBLAS_TRSM_BLOCK;
+        rocblas_int jj = j % ROCBLAS_TRSM_BLOCK;
+        rocblas_int i = b * ROCBLAS_TRSM_BLOCK + ii;
+
+        if (ii < jj && i < n)
+        {
+            T* block = cacheL + size_t(ROCBLAS_TRSM_BLOCK) * ROCBLAS_TRSM_BLOCK * b;
+            T temp = block[ii + jj*ROCBLAS_TRSM_BLOCK];
+            block[ii + jj*ROCBLAS_TRSM_BLOCK] = block[jj + ii*ROCBLAS_TRSM_BLOCK];
+            block[jj + ii*ROCBLAS_TRSM_BLOCK] = temp;
+        }
+    }
+}
+
+
+template <typename T>
+void rocsolver_getrf_cache_getMemorySize(const rocblas_int n, size_t *size_1, size_t *size_2)
+{
+    // the full diagonal blocks are inverted as a batch
+    // (the last one, if smaller, is inverted afterwards)
+    rocblas_int nblocks = (n - 1) / ROCBLAS_TRSM_BLOCK + 1;
+    size_t unused;
+    rocsolver_trtri_getMemorySize<false,T>(ROCBLAS_TRSM_BLOCK,nblocks,&unused,size_1,&unused);
+
+    // for the info of trtri
+    *size_2 = sizeof(rocblas_int) * nblocks;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_cache_argCheck(const rocblas_int n, const rocblas_int lda, T A,
+                                              rocblas_int *ipiv, T cache, rocblas_int *info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if (n < 0 || lda < n)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if ((n && !A) || (n && !ipiv) || (n && !cache) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_cache_argCheck(const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
+                                              const rocblas_int lda, const rocblas_int ldb, T A, T B,
+                                              const rocblas_int *ipiv, T cache)
+{
+    rocblas_status st = rocsolver_getrs_argCheck(trans,n,nrhs,lda,ldb,A,B,ipiv);
+    if (st != rocblas_status_continue)
+        return st;
+
+    if (n && !cache)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+// rocsolver_getrf_cache_template fills the cache from the factors of the LU factorization
+// stored in A (i.e. it is executed after getrf)
+template <typename T>
+rocblas_status rocsolver_getrf_cache_template(rocblas_handle handle, const rocblas_int n, T* A, const rocblas_int lda,
+                                              T* cache, T* scalars, T* work, rocblas_int* iinfo)
+{
+    // quick return
+    if (n == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    T* cacheL = cache;
+    T* cacheU = cache + size_t(ROCBLAS_TRSM_BLOCK) * n;
+    rocblas_int nfull = n / ROCBLAS_TRSM_BLOCK;
+    rocblas_int rem = n % ROCBLAS_TRSM_BLOCK;
+    rocblas_stride strideC = rocblas_stride(ROCBLAS_TRSM_BLOCK) * ROCBLAS_TRSM_BLOCK;
+
+    dim3 grid((ROCBLAS_TRSM_BLOCK - 1)/32 + 1, (n - 1)/32 + 1, 1);
+    dim3 threads(32, 32, 1);
+    hipLaunchKernelGGL(getrf_cache_copy<T>, grid, threads, 0, stream, n, A, lda, cacheL, cacheU);
+
+    // invert the diagonal blocks
+    // (the blocks of L are inverted as the unit upper triangular matrices L**T;
+    //  if U is singular, the content of the cache is not defined)
+    for (T* C : {cacheL, cacheU}) {
+        if (nfull > 0)
+            rocsolver_trtri_template<false,true,T>(handle,rocblas_fill_upper,rocblas_diagonal_non_unit,ROCBLAS_TRSM_BLOCK,
+                                                   C,0,ROCBLAS_TRSM_BLOCK,strideC,iinfo,nfull,scalars,work,(T**)nullptr);
+        if (rem > 0)
+            rocsolver_trtri_template<false,true,T>(handle,rocblas_fill_upper,rocblas_diagonal_non_unit,rem,
+                                                   C,nfull*strideC,ROCBLAS_TRSM_BLOCK,strideC,iinfo,1,scalars,work,(T**)nullptr);
+    }
+
+    // inv(L**T) = inv(L)**T
+    hipLaunchKernelGGL(getrf_cache_transpose<T>, grid, threads, 0, stream, n, cacheL);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GETRF_CACHE_HPP */
@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf_ooc.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrf_ooc_impl(rocblas_handle handle, const rocblas_int m,
+                                        const rocblas_int n, T *A, const rocblas_int lda,
+                                        rocblas_int *ipiv, rocblas_int* info, const int pivot)
+{
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    // (A, ipiv and info are on the host)
+    rocblas_status st = rocsolver_getf2_getrf_argCheck(m,n,lda,A,ipiv,info,1,pivot);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // quick return
+    if (m == 0 || n == 0) {
+        if (rocsolver_is_workspace_query(handle))
+            return rocsolver_set_workspace_size(handle);
+        *info = 0;
+        return rocblas_status_success;
+    }
+
+    // the transfers and the final interchanges are synchronous
+    rocsolver_handle_data* data = rocsolver_get_handle_data(handle);
+    if (data->capture_mode)
+        return rocblas_status_not_implemented;
+
+    // tournament pivoting is an option of the handle
+    const bool tournament = pivot && data->tournament_pivoting;
+
+    // width of the slabs: as many columns as fit in the memory budget of the handle
+    // (or in the free device memory if there is no budget)
+    size_t budget = data->memory_budget;
+    if (!budget) {
+        size_t free_mem, total_mem;
+        if (hipMemGetInfo(&free_mem, &total_mem) != hipSuccess)
+            return rocblas_status_internal_error;
+        budget = size_t(free_mem * GETRF_OOC_MEMORY_FRACTION);
+    }
+    auto size_of = [&](rocblas_int w) {
+        size_t size_slot, size_ipiv, size_info, size_2, size_3, size_4, size_5;
+        rocsolver_getrf_ooc_getMemorySize<T,S>(m,n,w,&size_slot,&size_ipiv,&size_info,&size_2,&size_3,&size_4,&size_5,tournament);
+        return workspace_total_size(size_slot,size_slot,size_slot,size_ipiv,size_info,size_info,size_2,size_3,size_4,size_5);
+    };
+    rocblas_int w = rocsolver_ooc_slab_width(n, GETRF_GETF2_SWITCHSIZE, budget, size_of);
+    if (w == 0)
+        return rocblas_status_memory_error;
+
+    // memory managment
+    size_t size_slot, size_ipiv, size_info, size_2, size_3, size_4, size_5;
+    rocsolver_getrf_ooc_getMemorySize<T,S>(m,n,w,&size_slot,&size_ipiv,&size_info,&size_2,&size_3,&size_4,&size_5,tournament);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_slot,size_slot,size_slot,size_ipiv,size_info,size_info,size_2,size_3,size_4,size_5);
+
+    void *x_temp, *x_temp_arr, *invA, *invA_arr;
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (the triangular blocks of the updates have up to w columns)
+    rocblas_status perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,max(w,GETRF_GETF2_SWITCHSIZE),w,1,x_temp,x_temp_arr,invA,invA_arr);
+    if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+    bool optim_mem = perf_status == rocblas_status_success;
+
+    rocsolver_device_malloc mem(handle,size_slot,size_slot,size_slot,size_ipiv,size_info,size_info,size_2,size_3,size_4,size_5);
+    if (!mem)
+        return rocblas_status_memory_error;
+
+    // scalar constants for rocblas functions calls
+    // (they live in the handle and are uploaded only the first time)
+    T* scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    // execution
+    return rocsolver_getrf_ooc_template<T,S>(handle,m,n,A,lda,ipiv,info,w,mem,scalars,
+                                             x_temp,x_temp_arr,invA,invA_arr,optim_mem,pivot,tournament);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_ooc(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 float *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<float>(handle, m, n, A, lda, ipiv, info, 1);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_ooc(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 double *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<double>(handle, m, n, A, lda, ipiv, info, 1);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_ooc(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info, 1);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_ooc(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info, 1);
+}
+
+} //extern C
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GETRF_OOC_HPP
+#define ROCLAPACK_GETRF_OOC_HPP
+
+#include "roclapack_getrf.hpp"
+#include "ooc_lu.hpp"
+
+/** getrf_ooc_device does the work of the out-of-core getrf for the slab scheduler
+    (see ooc_lu.hpp): the computations are enqueued in the handle's stream and the
+    transfers in a second stream. The three slots of m-by-w entries (leading dimension m),
+    the pivots and the info live in the workspace. (Pointer mode must be host) **/
+template <typename T, typename S>
+class getrf_ooc_device
+{
+    rocblas_handle handle;
+    hipStream_t stream, copy;
+    hipEvent_t loaded[3], released[3];
+    rocblas_int m, n, lda;
+    T* hA;
+    rocblas_int *hipiv, *hinfo;
+    T* slots[3];
+    rocblas_int *dipiv, *dinfo, *iinfo;     // (iinfo is the info of the slab)
+    bool pivot, tournament;
+    T one = 1, minone = -1;
+
+    // workspace of getrf for the slab
+    T *scalars, *pivot_val;
+    rocblas_int *pivot_idx, *getrf_iinfo;
+    rocblas_index_value_t<S>* work;
+    void *x_temp, *x_temp_arr, *invA, *invA_arr;
+    bool optim_mem;
+
+public:
+    rocblas_status status = rocblas_status_success;
+
+    getrf_ooc_device(rocblas_handle handle, hipStream_t stream, hipStream_t copy, hipEvent_t* events,
+                     const rocblas_int m, const rocblas_int n, T* A, const rocblas_int lda,
+                     rocblas_int* ipiv, rocblas_int* info, const rocblas_int w, const rocsolver_device_malloc& mem,
+                     T* scalars, void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                     const bool pivot, const bool tournament)
+        : handle(handle), stream(stream), copy(copy), m(m), n(n), lda(lda), hA(A), hipiv(ipiv), hinfo(info),
+          pivot(pivot), tournament(tournament), scalars(scalars), x_temp(x_temp), x_temp_arr(x_temp_arr),
+          invA(invA), invA_arr(invA_arr), optim_mem(optim_mem)
+    {
+        for (int s = 0; s < 3; ++s) {
+            slots[s] = (T*)mem[s];
+            loaded[s] = events[s];
+            released[s] = events[3 + s];
+        }
+        dipiv = (rocblas_int*)mem[3];
+        dinfo = (rocblas_int*)mem[4];
+        iinfo = (rocblas_int*)mem[5];
+        pivot_val = (T*)mem[6];
+        pivot_idx = (rocblas_int*)mem[7];
+        getrf_iinfo = (rocblas_int*)mem[8];
+        work = (rocblas_index_value_t<S>*)mem[9];
+
+        hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,dinfo,1,0);
+    }
+
+    void load(int slot, rocblas_int r0, rocblas_int c0, rocblas_int nc)
+    {
+        hipStreamWaitEvent(copy, released[slot], 0);
+        hipMemcpy2DAsync(slots[slot], sizeof(T) * m, hA + idx2D(r0, c0, lda), sizeof(T) * lda,
+                         sizeof(T) * (m - r0), nc, hipMemcpyHostToDevice, copy);
+        hipEventRecord(loaded[slot], copy);
+    }
+
+    void store(int slot, rocblas_int r0, rocblas_int c0, rocblas_int nc)
+    {
+        hipStreamWaitEvent(copy, released[slot], 0);
+        hipMemcpy2DAsync(hA + idx2D(r0, c0, lda), sizeof(T) * lda, slots[slot], sizeof(T) * m,
+                         sizeof(T) * (m - r0), nc, hipMemcpyDeviceToHost, copy);
+    }
+
+    void acquire(int slot)
+    {
+        hipStreamWaitEvent(stream, loaded[slot], 0);
+    }
+
+    void release(int slot)
+    {
+        hipEventRecord(released[slot], stream);
+    }
+
+    void swap(rocblas_int nc, rocblas_int k1, rocblas_int k2)
+    {
+        rocsolver_laswp_template<T>(handle, nc, slots[OOC_SLAB], 0, m, 0, k1 + 1, k2, dipiv, 0, 0, 1, 1);
+    }
+
+    void update(int slot, rocblas_int k0, rocblas_int kw, rocblas_int nc)
+    {
+        // (the slot holds rows k0 : m-1 of the factored columns)
+        rocblasCall_trsm<false,T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none, rocblas_diagonal_unit,
+                                  kw, nc, &one,
+                                  slots[slot], 0, m, 0,
+                                  slots[OOC_SLAB], k0, m, 0, 1, optim_mem,
+                                  x_temp, x_temp_arr, invA, invA_arr);
+        if (k0 + kw < m) {
+            rocblasCall_gemm<false,false,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                            m - k0 - kw, nc, kw, &minone,
+                                            slots[slot], kw, m, 0,
+                                            slots[OOC_SLAB], k0, m, 0, &one,
+                                            slots[OOC_SLAB], k0 + kw, m, 0, 1, nullptr);
+        }
+    }
+
+    void factor(rocblas_int c0, rocblas_int nc)
+    {
+        rocblas_int kw = min(m - c0, nc);
+        rocblas_status st = rocsolver_getrf_template<false,false,T,S>(handle, m - c0, nc, slots[OOC_SLAB], c0, m, 0,
+                                                                      dipiv, c0, 0, iinfo, 1, pivot, scalars,
+                                                                      pivot_val, pivot_idx, getrf_iinfo, work,
+                                                                      x_temp, x_temp_arr, invA, invA_arr, optim_mem, tournament);
+        if (status == rocblas_status_success)
+            status = st;
+
+        // pivots as global row indices, and info of the matrix
+        dim3 grid((kw - 1) / BLOCKSIZE + 1, 1, 1);
+        if (pivot)
+            hipLaunchKernelGGL((getrf_check_singularity<true,T*>),grid,dim3(BLOCKSIZE),0,stream,
+                               kw,c0,dipiv,c0,0,iinfo,dinfo);
+        else
+            hipLaunchKernelGGL((getrf_check_singularity<false,T*>),grid,dim3(BLOCKSIZE),0,stream,
+                               kw,c0,dipiv,c0,0,iinfo,dinfo);
+    }
+
+    void synchronize()
+    {
+        hipMemcpyAsync(hinfo, dinfo, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream);
+        if (pivot)
+            hipMemcpyAsync(hipiv, dipiv, sizeof(rocblas_int) * min(m, n), hipMemcpyDeviceToHost, stream);
+        if ((hipStreamSynchronize(stream) != hipSuccess || hipStreamSynchronize(copy) != hipSuccess)
+            && status == rocblas_status_success)
+            status = rocblas_status_internal_error;
+    }
+
+    void swap_left(rocblas_int c0, rocblas_int nc, rocblas_int k1, rocblas_int k2)
+    {
+        host_lu_laswp<T>(nc, hA + idx2D(0, c0, lda), lda, k1, k2, hipiv);
+    }
+};
+
+// device memory of the out-of-core getrf with slabs of w columns: the three slots, the pivots,
+// the info of the matrix and of the slab, and the workspace of getrf
+template <typename T, typename S>
+void rocsolver_getrf_ooc_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int w,
+                                       size_t *size_slot, size_t *size_ipiv, size_t *size_info,
+                                       size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5,
+                                       const bool tournament = false)
+{
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
+    rocsolver_getrf_getMemorySize<T,S>(m,w,1,&size_1,size_2,size_3,size_4,size_5,tournament);
+    *size_slot = sizeof(T) * m * w;
+    *size_ipiv = sizeof(rocblas_int) * min(m, n);
+    *size_info = sizeof(rocblas_int);
+}
+
+/** rocsolver_getrf_ooc_template factorizes the m-by-n matrix A in host memory by slabs of w columns.
+    The streams and events are created for the call: the function returns once the factorization
+    has finished. **/
+template <typename T, typename S>
+rocblas_status rocsolver_getrf_ooc_template(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                            T* A, const rocblas_int lda, rocblas_int* ipiv, rocblas_int* info,
+                                            const rocblas_int w, const rocsolver_device_malloc& mem, T* scalars,
+                                            void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                                            const bool pivot, const bool tournament)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle,&old_mode);
+    rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
+
+    hipStream_t copy = nullptr;
+    hipEvent_t events[6] = {};
+    rocblas_status status = rocblas_status_success;
+    if (hipStreamCreateWithFlags(&copy, hipStreamNonBlocking) != hipSuccess)
+        status = rocblas_status_internal_error;
+    for (int i = 0; i < 6 && status == rocblas_status_success; ++i) {
+        if (hipEventCreateWithFlags(&events[i], hipEventDisableTiming) != hipSuccess)
+            status = rocblas_status_internal_error;
+    }
+
+    if (status == rocblas_status_success) {
+        getrf_ooc_device<T,S> dev(handle, stream, copy, events, m, n, A, lda, ipiv, info, w, mem,
+                                  scalars, x_temp, x_temp_arr, invA, invA_arr, optim_mem, pivot, tournament);
+        rocsolver_ooc_getrf_schedule(dev, m, n, w, pivot);
+        status = dev.status;
+    }
+
+    for (hipEvent_t e : events) {
+        if (e)
+            hipEventDestroy(e);
+    }
+    if (copy)
+        hipStreamDestroy(copy);
+    rocblas_set_pointer_mode(handle,old_mode);
+    return status;
+}
+
+#endif /* ROCLAPACK_GETRF_OOC_HPP */
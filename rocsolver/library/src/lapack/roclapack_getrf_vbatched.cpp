@@ -0,0 +1,352 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf.hpp"
+#include "roclapack_vbatched.hpp"
+
+/************************************************************************
+    getrf_vbatched_small_kernel factorizes the instances of a size class, i.e.
+    matrices with m_i <= hipBlockDim_x <= GETF2_MAX_THDS and n_i <= DIM <= WAVESIZE,
+    with one work-group per instance and one thread per row (as LUfact_small_kernel).
+    The sizes of every instance are read from the device arrays; the threads
+    and columns beyond the size of the instance are masked.
+    (LUfact_small_kernel cannot be reused: it takes m and lda as arguments and
+    is instantiated with DIM = n, so all the instances of a launch must have the same sizes)
+************************************************************************/
+template <rocblas_int DIM, typename T>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+getrf_vbatched_small_kernel(const rocblas_int* order, const rocblas_int* mm, const rocblas_int* nn,
+                            T* const AA[], const rocblas_int* ldaa, rocblas_int* const ipivA[],
+                            rocblas_int* infoA)
+{
+    int b = order[hipBlockIdx_x];
+    int tid = hipThreadIdx_x;
+    int nthds = hipBlockDim_x;
+
+    // batch instance
+    rocblas_int m = mm[b];
+    rocblas_int n = nn[b];
+    rocblas_int lda = ldaa[b];
+    rocblas_int dim = min(m, n);
+    T* A = AA[b];
+    rocblas_int* ipiv = ipivA[b];
+    bool active = tid < m;
+
+    // shared memory (for communication between threads in group)
+    // (the arrays for the pivot search come first)
+    using S = decltype(std::real(T{}));
+    extern __shared__ double lmem[];
+    S *sval = (S*)lmem;
+    rocblas_int *sidx = (rocblas_int*)(sval + nthds);
+    T *common = (T*)((char*)lmem + iamax_group_lmem<S>(nthds));
+
+    // local variables
+    T pivot_value;
+    int pivot_index;
+    int myrow = tid;        //logical row (after the lazy interchanges)
+    int mypiv = tid + 1;    //to build ipiv
+    int myinfo = 0;         //to build info
+    T rA[DIM];              //to store this-row values
+
+    // read corresponding row from global memory into local array
+    #pragma unroll DIM
+    for (int j = 0; j < DIM; ++j)
+        rA[j] = (active && j < n) ? A[tid + j*lda] : T(0);
+
+    // for each pivot (main loop)
+    // (dim is the same for all the threads of the work-group)
+    #pragma unroll DIM
+    for (int k = 0; k < DIM; ++k) {
+        if (k >= dim)
+            break;
+
+        // share current column
+        if (active)
+            common[myrow] = rA[k];
+        __syncthreads();
+
+        // search pivot index
+        bool cand = active && myrow >= k;
+        pivot_index = iamax_group<S>(tid, nthds, cand ? aabs(rA[k]) : S(-1), cand ? myrow : m, sval, sidx);
+        // (no candidate if the column is all NaN: the pivot stays in place)
+        if (pivot_index == m)
+            pivot_index = k;
+        pivot_value = common[pivot_index];
+        __syncthreads();
+
+        // check singularity and scale value for current column
+        if (pivot_value != T(0.0))
+            pivot_value = 1.0 / pivot_value;
+        else if (myinfo == 0)
+            myinfo = k+1;
+
+        // swap rows (lazy swaping)
+        if (active && myrow == pivot_index) {
+            myrow = k;
+            //share pivot row
+            for (int j = k+1; j < DIM; ++j)
+                common[j] = rA[j];
+        }
+        else if (active && myrow == k) {
+            myrow = pivot_index;
+            mypiv = pivot_index + 1;
+        }
+        __syncthreads();
+
+        // scale current column and update trailing matrix
+        if (active && myrow > k) {
+            rA[k] *= pivot_value;
+            for (int j = k+1; j < DIM; ++j)
+                rA[j] -= rA[k] * common[j];
+        }
+        __syncthreads();
+    }
+
+    // write results to global memory
+    if (tid == 0)
+        infoA[b] = myinfo;
+    if (active) {
+        if (myrow < dim)
+            ipiv[myrow] = mypiv;
+        #pragma unroll DIM
+        for (int j = 0; j < DIM; ++j) {
+            if (j < n)
+                A[myrow + j*lda] = rA[j];
+        }
+    }
+}
+
+/*************************************************************
+    Launcher of getrf_vbatched_small kernels
+*************************************************************/
+template <typename T>
+void getrf_vbatched_small(hipStream_t stream, const rocblas_int dim, const rocblas_int nthds, const rocblas_int count,
+                          const rocblas_int* order, const rocblas_int* m, const rocblas_int* n, T* const A[],
+                          const rocblas_int* lda, rocblas_int* const ipiv[], rocblas_int* info)
+{
+    #define RUN_GETRF_VBATCHED_SMALL(DIM)                                                       \
+        hipLaunchKernelGGL((getrf_vbatched_small_kernel<DIM,T>),grid,block,lmemsize,stream,     \
+                            order,m,n,A,lda,ipiv,info)
+
+    //prepare kernel launch
+    dim3 grid(count,1,1);
+    dim3 block(nthds,1,1);
+    size_t lmemsize = iamax_group_lmem<decltype(std::real(T{}))>(nthds) + max(nthds,dim) * sizeof(T);
+
+    // one instantiation per size class
+    switch (dim) {
+        case  8: RUN_GETRF_VBATCHED_SMALL( 8); break;
+        case 16: RUN_GETRF_VBATCHED_SMALL(16); break;
+        case 32: RUN_GETRF_VBATCHED_SMALL(32); break;
+        case 64: RUN_GETRF_VBATCHED_SMALL(64); break;
+        default: __builtin_unreachable();
+    }
+}
+
+// size class of an instance: the instances with m <= GETF2_MAX_THDS and n <= WAVESIZE
+// are bucketed by the (rounded up) number of columns and rows, and factorized by
+// getrf_vbatched_small_kernel; the others are grouped by their exact sizes
+// and factorized with the blocked algorithm.
+// (The blocked algorithm, and the rocBLAS functions it calls, take a single m, n and lda
+// for the whole batch, so the larger instances cannot be bucketed by size class:
+// every distinct shape is a separate batched call)
+inline rocsolver_vbatched_key getrf_vbatched_class(const rocblas_int m, const rocblas_int n, const rocblas_int lda)
+{
+    if (m <= GETF2_MAX_THDS && n <= WAVESIZE) {
+        rocblas_int dim = 8;
+        while (dim < n)
+            dim <<= 1;
+        rocblas_int nthds = WAVESIZE;
+        while (nthds < m)
+            nthds <<= 1;
+        return {0, dim, nthds, 0};
+    }
+    return {1, m, n, lda};
+}
+
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_impl(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                                             T *const A[], const rocblas_int *lda, rocblas_int *const ipiv[],
+                                             rocblas_int* info, const rocblas_int batch_count)
+{
+    using U = T *const *;
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    // (the sizes of the instances live on the device and can only be checked after they are copied)
+    if (batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (batch_count && (!m || !n || !A || !lda || !ipiv || !info))
+        return rocblas_status_invalid_pointer;
+    if (batch_count == 0)
+        return rocsolver_is_workspace_query(handle) ? rocsolver_set_workspace_size(handle) : rocblas_status_success;
+
+    // the copy of the sizes to the host cannot be captured
+    if (rocsolver_get_handle_data(handle)->capture_mode)
+        return rocblas_status_not_implemented;
+
+    // group the instances by size class
+    std::vector<std::vector<rocblas_int>> hsizes;
+    std::vector<rocblas_int> order;
+    std::vector<rocsolver_vbatched_group> groups;
+    rocblas_status st = rocsolver_vbatched_copy_sizes(handle, batch_count, {m, n, lda}, hsizes);
+    if (st != rocblas_status_success)
+        return st;
+    for (rocblas_int b = 0; b < batch_count; ++b) {
+        if (hsizes[0][b] < 0 || hsizes[1][b] < 0 || hsizes[2][b] < hsizes[0][b])
+            return rocblas_status_invalid_size;
+    }
+    rocsolver_vbatched_group_by(batch_count, [&](rocblas_int b) {
+        return getrf_vbatched_class(hsizes[0][b], hsizes[1][b], hsizes[2][b]);
+    }, order, groups);
+
+    // tournament pivoting is an option of the handle
+    const bool tournament = rocsolver_get_handle_data(handle)->tournament_pivoting;
+
+    // memory managment
+    // (the groups of large matrices are processed one after the other and share the workspace)
+    size_t size_1 = 0;  //size of constants (not allocated, they live in the handle)
+    size_t size_2 = 0, size_3 = 0, size_4 = 0, size_5 = 0;
+    size_t size_6;  //for the sorted pointers
+    size_t size_7;  //for the sorted order
+    size_t size_8 = 0;  //for the pivots of the groups of large matrices (contiguous)
+    size_t size_9;  //for the info of the groups
+    for (const rocsolver_vbatched_group& g : groups) {
+        if (g.sizes[0] == 0)
+            continue;
+        size_t s2, s3, s4, s5;
+        rocsolver_getrf_getMemorySize<T,S>(g.sizes[1],g.sizes[2],g.count,&size_1,&s2,&s3,&s4,&s5,tournament);
+        size_2 = std::max(size_2, s2);
+        size_3 = std::max(size_3, s3);
+        size_4 = std::max(size_4, s4);
+        size_5 = std::max(size_5, s5);
+        size_8 += sizeof(rocblas_int) * g.count * min(g.sizes[1], g.sizes[2]);
+    }
+    size_6 = sizeof(T*) * batch_count;
+    size_7 = sizeof(rocblas_int) * batch_count;
+    size_9 = sizeof(rocblas_int) * batch_count;
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4,size_5,size_6,size_7,size_8,size_9);
+
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4,size_5,size_6,size_7,size_8,size_9);
+    if (!mem)
+        return rocblas_status_memory_error;
+    T** Ap = (T**)mem[4];
+    rocblas_int* dorder = (rocblas_int*)mem[5];
+    rocblas_int* ipivp = (rocblas_int*)mem[6];
+    rocblas_int* infop = (rocblas_int*)mem[7];
+
+    // scalar constants for rocblas functions calls
+    // (they live in the handle and are uploaded only the first time)
+    T* scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // sort the matrices
+    // (order is pageable host memory, so the copy is staged before returning and
+    // order can be released while the copy is still pending in the stream)
+    if (hipMemcpyAsync(dorder, order.data(), size_7, hipMemcpyHostToDevice, stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(vbatched_gather<T*>,dim3(blocks),dim3(BLOCKSIZE),0,stream,Ap,A,dorder,batch_count);
+    hipLaunchKernelGGL(reset_info,dim3(blocks),dim3(BLOCKSIZE),0,stream,infop,batch_count,0);
+
+    // execution
+    // (the size classes of small matrices are factorized directly by one kernel each,
+    // and every group of large matrices is a regular batched problem)
+    rocblas_status status = rocblas_status_success;
+    size_t offP = 0;
+    for (const rocsolver_vbatched_group& g : groups) {
+        if (g.sizes[0] == 0) {
+            getrf_vbatched_small<T>(stream,g.sizes[1],g.sizes[2],g.count,dorder + g.first,m,n,A,lda,ipiv,info);
+            continue;
+        }
+
+        rocblas_int gm = g.sizes[1], gn = g.sizes[2], glda = g.sizes[3];
+        rocblas_int dim = min(gm, gn);
+
+        // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+        void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+        bool optim_mem = true;
+        if (!(gm < GETRF_GETF2_SWITCHSIZE || gn < GETRF_GETF2_SWITCHSIZE)) {
+            rocblas_status perf_status = rocblasCall_trsm_mem<true,T,U>(handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,gn,g.count,x_temp,x_temp_arr,invA,invA_arr);
+            if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+                return perf_status;
+            optim_mem = perf_status == rocblas_status_success;
+        }
+
+        status = rocsolver_getrf_template<true,false,T,S>(handle,gm,gn,
+                                                          (U)(Ap + g.first),0,
+                                                          glda,0,
+                                                          ipivp + offP,0,
+                                                          dim,
+                                                          infop + g.first,g.count,1,
+                                                          scalars,
+                                                          (T*)mem[0],
+                                                          (rocblas_int*)mem[1],
+                                                          (rocblas_int*)mem[2],
+                                                          (rocblas_index_value_t<S>*)mem[3],
+                                                          x_temp,
+                                                          x_temp_arr,
+                                                          invA,
+                                                          invA_arr,
+                                                          optim_mem,
+                                                          tournament);
+        if (status != rocblas_status_success)
+            return status;
+
+        // copy back the pivots and info
+        blocks = (max(dim, 1) - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(vbatched_ipiv_scatter<T>,dim3(blocks,g.count),dim3(BLOCKSIZE),0,stream,
+                           dim,dorder + g.first,ipiv,ipivp + offP,info,infop + g.first);
+        offP += (size_t)g.count * dim;
+    }
+
+    return status;
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 float *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<float>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 double *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<double>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 rocblas_float_complex *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 rocblas_double_complex *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+}
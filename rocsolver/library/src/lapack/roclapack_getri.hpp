@@ -217,6 +217,17 @@ rocblas_status getri_run_small(rocblas_handle handle, const rocblas_int n, U A,
 }
 #endif //OPTIMAL
 
+// getri_broadcast_info copies the info of the first instance to the rest of the batch
+// (when all the instances share the same matrix)
+template <typename T>
+__global__ void getri_broadcast_info(T* info, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b > 0 && b < batch_count)
+        info[b] = info[0];
+}
+
 template <typename T>
 __device__ void copy_and_zero(const rocblas_int m, const rocblas_int n,
                               T *a, const rocblas_int lda, T *w, const rocblas_int ldw)
@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getri.hpp"
 
 template <typename T, typename U>
@@ -23,40 +22,50 @@ rocblas_status rocsolver_getri_batched_impl(rocblas_handle handle, const rocblas
     rocblas_stride strideA = 0;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace 
     size_t size_3;  //size of array of pointers to workspace
-    rocsolver_getri_getMemorySize<true,T>(n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    // the batch is processed in chunks that fit in the memory budget of the handle
+    rocblas_int chunk = rocsolver_batch_chunk(handle,batch_count,[&](rocblas_int bc){
+        rocsolver_getri_getMemorySize<true,T>(n,bc,&size_1,&size_2,&size_3);
+        return workspace_total_size(size_2,size_3);
+    });
+    rocsolver_getri_getMemorySize<true,T>(n,chunk,&size_1,&size_2,&size_3);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3);
+
     void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    rocsolver_device_malloc mem(handle,size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
-    rocblas_status status =
+    rocblas_status status = rocblas_status_success;
+    for (rocblas_int b = 0; b < batch_count && status == rocblas_status_success; b += chunk)
+    {
+        status =
            rocsolver_getri_template<true,false,T>(handle,n,
-                                                  A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                                  A + b,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                                   lda, strideA,
-                                                  ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
+                                                  ipiv + b*strideP,0, //the vector is shifted 0 entries (will work on the entire vector)
                                                   strideP,
-                                                  info,
-                                                  batch_count,
+                                                  info + b,
+                                                  min(chunk, batch_count - b),
                                                   (T*)scalars,
                                                   (T*)work,
                                                   (T**)workArr);
+    }
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
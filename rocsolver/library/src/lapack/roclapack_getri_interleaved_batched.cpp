@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_interleaved.hpp"
+#include "roclapack_getri.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getri_interleaved_batched_impl(rocblas_handle handle, const rocblas_int n, T *A, const rocblas_int lda,
+                                                        rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_getri_argCheck(n,lda,A,ipiv,info,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // memory managment
+    size_t size_1;  //size of workspace
+    rocsolver_getri_interleaved_getMemorySize<T>(n,batch_count,&size_1);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_1);
+
+    rocsolver_device_malloc mem(handle,size_1);
+    if (!mem)
+        return rocblas_status_memory_error;
+
+    // execution
+    return rocsolver_getri_interleaved_template<T>(handle,n,A,lda,ipiv,info,(T*)mem[0],batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri_interleaved_batched(rocblas_handle handle, const rocblas_int n, float *A, const rocblas_int lda,
+                 rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_getri_interleaved_batched_impl<float>(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri_interleaved_batched(rocblas_handle handle, const rocblas_int n, double *A, const rocblas_int lda,
+                 rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_getri_interleaved_batched_impl<double>(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri_interleaved_batched(rocblas_handle handle, const rocblas_int n, rocblas_float_complex *A, const rocblas_int lda,
+                 rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_getri_interleaved_batched_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_interleaved_batched(rocblas_handle handle, const rocblas_int n, rocblas_double_complex *A, const rocblas_int lda,
+                 rocblas_int *ipiv, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_getri_interleaved_batched_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+}
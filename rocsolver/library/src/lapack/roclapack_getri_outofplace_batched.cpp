@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getri.hpp"
 
 /*
@@ -49,29 +48,32 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle, co
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // copy A into C for out-of-place inversion
-    rocblas_int blocks = (n - 1)/32 + 1;
-    hipLaunchKernelGGL(copy_batch<T>, dim3(batch_count,blocks,blocks), dim3(1,32,32), 0, stream,
-                       n, n, A, 0, lda, 0, C, 0, ldc, 0);
-
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace 
     size_t size_3;  //size of array of pointers to workspace
     rocsolver_getri_getMemorySize<true,T>(n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3);
+
     void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    rocsolver_device_malloc mem(handle,size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
+
+    // copy A into C for out-of-place inversion
+    rocblas_int blocks = (n - 1)/32 + 1;
+    hipLaunchKernelGGL(copy_batch<T>, dim3(batch_count,blocks,blocks), dim3(1,32,32), 0, stream,
+                       n, n, A, 0, lda, 0, C, 0, ldc, 0);
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -86,9 +88,6 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle, co
                                                   (T*)work,
                                                   (T**)workArr);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
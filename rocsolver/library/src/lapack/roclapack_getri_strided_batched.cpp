@@ -19,41 +19,63 @@ rocblas_status rocsolver_getri_strided_batched_impl(rocblas_handle handle, const
     if (st != rocblas_status_continue)
         return st;
         
+    // broadcast of the factors: if all the instances share A and ipiv (strideA = strideP = 0)
+    // the matrix is inverted only once (and the info is copied to the other instances)
+    const bool broadcast = strideA == 0 && strideP == 0 && batch_count > 1;
+    const rocblas_int bc = broadcast ? 1 : batch_count;
+
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
-    rocsolver_getri_getMemorySize<false,T>(n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    // the batch is processed in chunks that fit in the memory budget of the handle
+    rocblas_int chunk = rocsolver_batch_chunk(handle,bc,[&](rocblas_int c){
+        rocsolver_getri_getMemorySize<false,T>(n,c,&size_1,&size_2,&size_3);
+        return workspace_total_size(size_2,size_3);
+    });
+    rocsolver_getri_getMemorySize<false,T>(n,chunk,&size_1,&size_2,&size_3);
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3);
+
     void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    rocsolver_device_malloc mem(handle,size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    workArr = mem[1];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
-    rocblas_status status = 
+    rocblas_status status = rocblas_status_success;
+    for (rocblas_int b = 0; b < bc && status == rocblas_status_success; b += chunk)
+    {
+        status =
            rocsolver_getri_template<false,true,T>(handle,n,
-                                                  A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                                  A + b*strideA,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                                   lda,strideA,
-                                                  ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
+                                                  ipiv + b*strideP,0, //the vector is shifted 0 entries (will work on the entire vector)
                                                   strideP,
-                                                  info,
-                                                  batch_count,
+                                                  info + b,
+                                                  min(chunk, bc - b),
                                                   (T*)scalars,
                                                   (T*)work,
                                                   (T**)workArr);
+    }
+
+    if (broadcast && status == rocblas_status_success) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(getri_broadcast_info<rocblas_int>,dim3(blocks),dim3(BLOCKSIZE),0,stream,info,batch_count);
+    }
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
@@ -26,16 +26,33 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operati
 
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (it is not needed for small systems, see getrs_kernel_small)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (!getrs_use_small(n, nrhs)) {
+        rocblas_status perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,n,nrhs,batch_count,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
 
     // execution
-    return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
+    return rocsolver_getrs_template<false,T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
                                         ipiv,strideP,
                                         B,0,
                                         ldb,strideB,
-                                        batch_count);
+                                        batch_count,
+                                        x_temp,
+                                        x_temp_arr,
+                                        invA,
+                                        invA_arr,
+                                        optim_mem);
 }
 
 
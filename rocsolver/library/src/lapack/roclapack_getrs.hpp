@@ -14,6 +14,220 @@
 #include "rocsolver.h"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
+#ifdef OPTIMAL
+/*************************************************************************
+    getrs_kernel_small takes care of systems with n <= GETRS_SMALL_MAX_SIZE
+    and nrhs <= GETRS_SMALL_MAX_NRHS. Every thread keeps a row of op(A) and
+    the same row of B in registers, so that the interchanges and the two
+    triangular solves are done with a single launch for the whole batch:
+    op(A) = L*U is solved as L then U, and op(A) = U'*L' as U' then L'.
+    The rows of the solutions are shared through LDS.
+*************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS)
+getrs_kernel_small(const rocblas_operation trans, const rocblas_int nrhs,
+                   U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                   const rocblas_int* ipivA, const rocblas_stride strideP,
+                   U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                   const rocblas_int batch_count)
+{
+    constexpr int NRHS = GETRS_SMALL_MAX_NRHS;
+    int ty = hipThreadIdx_y;
+    int i = hipThreadIdx_x;
+    int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if (id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* B = load_ptr_batch<T>(BB,id,shiftB,strideB);
+    const rocblas_int *ipiv = ipivA + id*strideP;
+
+    // shared memory (for communication between threads in group)
+    // (the rows of the solution come first, then the permutation)
+    extern __shared__ double lmem[];
+    T *sB = (T*)lmem + ty * DIM * NRHS;
+    rocblas_int *perm = (rocblas_int*)((T*)lmem + hipBlockDim_y * DIM * NRHS) + ty * DIM;
+
+    const bool notrans = (trans == rocblas_operation_none);
+    const bool cj = (trans == rocblas_operation_conjugate_transpose);
+    T rA[DIM];          //to store row i of op(A)
+    T rB[NRHS];         //to store row i of B
+    T diag;
+
+    // row i of op(A)
+    #pragma unroll
+    for (int j = 0; j < DIM; ++j)
+        rA[j] = notrans ? A[i + j*lda] : (cj ? conj(A[j + i*lda]) : A[j + i*lda]);
+    diag = rA[i];
+
+    // the interchanges as a permutation: row i of P*B is row perm[i] of B
+    if (i == 0) {
+        for (int k = 0; k < DIM; ++k)
+            perm[k] = k;
+        for (int k = 0; k < DIM; ++k) {
+            rocblas_int p = ipiv[k] - 1;
+            rocblas_int t = perm[k];
+            perm[k] = perm[p];
+            perm[p] = t;
+        }
+    }
+    __syncthreads();
+
+    // row i of P*B (no transpose) or of B
+    rocblas_int myrow = notrans ? perm[i] : i;
+    #pragma unroll
+    for (int j = 0; j < NRHS; ++j)
+        if (j < nrhs) rB[j] = B[myrow + j*ldb];
+
+    // forward substitution with L (unit diagonal) or U' (non-unit diagonal)
+    #pragma unroll
+    for (int k = 0; k < DIM; ++k) {
+        if (i == k) {
+            #pragma unroll
+            for (int j = 0; j < NRHS; ++j) {
+                if (!notrans) rB[j] = rB[j] / diag;
+                sB[k*NRHS + j] = rB[j];
+            }
+        }
+        __syncthreads();
+        if (i > k) {
+            #pragma unroll
+            for (int j = 0; j < NRHS; ++j)
+                rB[j] -= rA[k] * sB[k*NRHS + j];
+        }
+    }
+    __syncthreads();
+
+    // backward substitution with U (non-unit diagonal) or L' (unit diagonal)
+    #pragma unroll
+    for (int k = DIM-1; k >= 0; --k) {
+        if (i == k) {
+            #pragma unroll
+            for (int j = 0; j < NRHS; ++j) {
+                if (notrans) rB[j] = rB[j] / diag;
+                sB[k*NRHS + j] = rB[j];
+            }
+        }
+        __syncthreads();
+        if (i < k) {
+            #pragma unroll
+            for (int j = 0; j < NRHS; ++j)
+                rB[j] -= rA[k] * sB[k*NRHS + j];
+        }
+    }
+
+    // write results to global memory
+    // (undoing the interchanges in the transposed case: row i of the solution is row perm[i] of X)
+    myrow = notrans ? i : perm[i];
+    #pragma unroll
+    for (int j = 0; j < NRHS; ++j)
+        if (j < nrhs) B[myrow + j*ldb] = rB[j];
+}
+
+/*************************************************************
+    Launcher of getrs_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status getrs_run_small(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
+                               U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                               const rocblas_int *ipiv, const rocblas_stride strideP,
+                               U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                               const rocblas_int batch_count)
+{
+    #define RUN_GETRS_SMALL(DIM)                                                            \
+        hipLaunchKernelGGL((getrs_kernel_small<DIM,T>), grid, block, lmemsize, stream,      \
+                           trans, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count)
+
+    // determine sizes
+    // (several small systems are solved by the same work-group, with the same
+    // groups as LUfact_small for the factorization of matrices of this size)
+    static constexpr int opval[] = {GETF2_OPTIM_NGRP};
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n-1];
+    rocblas_int blocks = (batch_count - 1)/ngrp + 1;
+
+    dim3 grid(blocks,1,1);
+    dim3 block(n,ngrp,1);
+    size_t lmemsize = ngrp * n * (GETRS_SMALL_MAX_NRHS * sizeof(T) + sizeof(rocblas_int));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    switch (n) {
+        case  1: RUN_GETRS_SMALL( 1); break;
+        case  2: RUN_GETRS_SMALL( 2); break;
+        case  3: RUN_GETRS_SMALL( 3); break;
+        case  4: RUN_GETRS_SMALL( 4); break;
+        case  5: RUN_GETRS_SMALL( 5); break;
+        case  6: RUN_GETRS_SMALL( 6); break;
+        case  7: RUN_GETRS_SMALL( 7); break;
+        case  8: RUN_GETRS_SMALL( 8); break;
+        case  9: RUN_GETRS_SMALL( 9); break;
+        case 10: RUN_GETRS_SMALL(10); break;
+        case 11: RUN_GETRS_SMALL(11); break;
+        case 12: RUN_GETRS_SMALL(12); break;
+        case 13: RUN_GETRS_SMALL(13); break;
+        case 14: RUN_GETRS_SMALL(14); break;
+        case 15: RUN_GETRS_SMALL(15); break;
+        case 16: RUN_GETRS_SMALL(16); break;
+        case 17: RUN_GETRS_SMALL(17); break;
+        case 18: RUN_GETRS_SMALL(18); break;
+        case 19: RUN_GETRS_SMALL(19); break;
+        case 20: RUN_GETRS_SMALL(20); break;
+        case 21: RUN_GETRS_SMALL(21); break;
+        case 22: RUN_GETRS_SMALL(22); break;
+        case 23: RUN_GETRS_SMALL(23); break;
+        case 24: RUN_GETRS_SMALL(24); break;
+        case 25: RUN_GETRS_SMALL(25); break;
+        case 26: RUN_GETRS_SMALL(26); break;
+        case 27: RUN_GETRS_SMALL(27); break;
+        case 28: RUN_GETRS_SMALL(28); break;
+        case 29: RUN_GETRS_SMALL(29); break;
+        case 30: RUN_GETRS_SMALL(30); break;
+        case 31: RUN_GETRS_SMALL(31); break;
+        case 32: RUN_GETRS_SMALL(32); break;
+        case 33: RUN_GETRS_SMALL(33); break;
+        case 34: RUN_GETRS_SMALL(34); break;
+        case 35: RUN_GETRS_SMALL(35); break;
+        case 36: RUN_GETRS_SMALL(36); break;
+        case 37: RUN_GETRS_SMALL(37); break;
+        case 38: RUN_GETRS_SMALL(38); break;
+        case 39: RUN_GETRS_SMALL(39); break;
+        case 40: RUN_GETRS_SMALL(40); break;
+        case 41: RUN_GETRS_SMALL(41); break;
+        case 42: RUN_GETRS_SMALL(42); break;
+        case 43: RUN_GETRS_SMALL(43); break;
+        case 44: RUN_GETRS_SMALL(44); break;
+        case 45: RUN_GETRS_SMALL(45); break;
+        case 46: RUN_GETRS_SMALL(46); break;
+        case 47: RUN_GETRS_SMALL(47); break;
+        case 48: RUN_GETRS_SMALL(48); break;
+        case 49: RUN_GETRS_SMALL(49); break;
+        case 50: RUN_GETRS_SMALL(50); break;
+        case 51: RUN_GETRS_SMALL(51); break;
+        case 52: RUN_GETRS_SMALL(52); break;
+        case 53: RUN_GETRS_SMALL(53); break;
+        case 54: RUN_GETRS_SMALL(54); break;
+        case 55: RUN_GETRS_SMALL(55); break;
+        case 56: RUN_GETRS_SMALL(56); break;
+        case 57: RUN_GETRS_SMALL(57); break;
+        case 58: RUN_GETRS_SMALL(58); break;
+        case 59: RUN_GETRS_SMALL(59); break;
+        case 60: RUN_GETRS_SMALL(60); break;
+        case 61: RUN_GETRS_SMALL(61); break;
+        case 62: RUN_GETRS_SMALL(62); break;
+        case 63: RUN_GETRS_SMALL(63); break;
+        case 64: RUN_GETRS_SMALL(64); break;
+        default: __builtin_unreachable();
+    }
+
+    return rocblas_status_success;
+}
+#endif //OPTIMAL
+
 template <typename T>
 rocblas_status rocsolver_getrs_argCheck(const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
                                         const rocblas_int lda, const rocblas_int ldb,
@@ -37,81 +251,226 @@ rocblas_status rocsolver_getrs_argCheck(const rocblas_operation trans, const roc
 }
 
 
+/** getrs_trsm_kernel solves op(L) * X = B or op(U) * X = B for the nrhs columns of B,
+    where L (unit lower triangular) or U (upper triangular) are the factors returned by getrf
+    for a diagonal block of order m. One thread per column and one row of the grid per instance **/
 template <typename T, typename U>
+__global__ void getrs_trsm_kernel(const rocblas_fill uplo, const rocblas_operation trans,
+                                  const rocblas_int m, const rocblas_int nrhs,
+                                  U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                  U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB)
+{
+    int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int id = hipBlockIdx_y;
+
+    if (j >= nrhs)
+        return;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* B = load_ptr_batch<T>(BB,id,shiftB,strideB) + j*ldb;
+    const bool cj = (trans == rocblas_operation_conjugate_transpose);
+    T t;
+
+    if (trans == rocblas_operation_none) {
+        if (uplo == rocblas_fill_lower) {
+            // solve L*x = b (unit diagonal)
+            for (rocblas_int k = 0; k < m - 1; ++k) {
+                t = B[k];
+                for (rocblas_int i = k + 1; i < m; ++i)
+                    B[i] -= A[i + k*lda] * t;
+            }
+        } else {
+            // solve U*x = b
+            for (rocblas_int k = m - 1; k >= 0; --k) {
+                t = B[k] / A[k + k*lda];
+                B[k] = t;
+                for (rocblas_int i = 0; i < k; ++i)
+                    B[i] -= A[i + k*lda] * t;
+            }
+        }
+    } else {
+        if (uplo == rocblas_fill_upper) {
+            // solve U'*x = b
+            for (rocblas_int i = 0; i < m; ++i) {
+                t = B[i];
+                for (rocblas_int k = 0; k < i; ++k)
+                    t -= (cj ? conj(A[k + i*lda]) : A[k + i*lda]) * B[k];
+                B[i] = t / (cj ? conj(A[i + i*lda]) : A[i + i*lda]);
+            }
+        } else {
+            // solve L'*x = b (unit diagonal)
+            for (rocblas_int i = m - 2; i >= 0; --i) {
+                t = B[i];
+                for (rocblas_int k = i + 1; k < m; ++k)
+                    t -= (cj ? conj(A[k + i*lda]) : A[k + i*lda]) * B[k];
+                B[i] = t;
+            }
+        }
+    }
+}
+
+/** getrs_trsm solves op(L) * X = B or op(U) * X = B for all the instances of the batch.
+    The triangular matrix is split in halves until the diagonal blocks are small enough for
+    getrs_trsm_kernel; the off-diagonal blocks are applied with gemm. The number of launches
+    depends on m only, and no workspace is needed.
+    (Pointer mode must be host) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void getrs_trsm(rocblas_handle handle, const rocblas_fill uplo, const rocblas_operation trans,
+                const rocblas_int m, const rocblas_int nrhs,
+                U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                const rocblas_int batch_count, T* one, T* minone)
+{
+    if (m <= GETRS_TRSM_BLOCKSIZE) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        rocblas_int blocks = (nrhs - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(getrs_trsm_kernel<T>,dim3(blocks,batch_count),dim3(BLOCKSIZE),0,stream,
+                           uplo,trans,m,nrhs,A,shiftA,lda,strideA,B,shiftB,ldb,strideB);
+        return;
+    }
+
+    rocblas_int m1 = m / 2;
+    rocblas_int m2 = m - m1;
+    rocblas_int shift11 = shiftA;
+    rocblas_int shift21 = shiftA + m1;
+    rocblas_int shift12 = shiftA + idx2D(0, m1, lda);
+    rocblas_int shift22 = shiftA + idx2D(m1, m1, lda);
+
+    // op(L) and op(U)' are solved from the top, op(U) and op(L)' from the bottom
+    if ((uplo == rocblas_fill_lower) == (trans == rocblas_operation_none)) {
+        // B1 = inv(op(A11)) * B1
+        getrs_trsm<BATCHED,STRIDED,T>(handle, uplo, trans, m1, nrhs, A, shift11, lda, strideA, B, shiftB, ldb, strideB, batch_count, one, minone);
+
+        // B2 = B2 - op(A)21 * B1
+        rocblasCall_gemm<BATCHED,STRIDED,T>(handle, trans, rocblas_operation_none,
+                                            m2, nrhs, m1, minone,
+                                            A, trans == rocblas_operation_none ? shift21 : shift12, lda, strideA,
+                                            B, shiftB, ldb, strideB, one,
+                                            B, shiftB + m1, ldb, strideB, batch_count, nullptr);
+
+        // B2 = inv(op(A22)) * B2
+        getrs_trsm<BATCHED,STRIDED,T>(handle, uplo, trans, m2, nrhs, A, shift22, lda, strideA, B, shiftB + m1, ldb, strideB, batch_count, one, minone);
+    } else {
+        // B2 = inv(op(A22)) * B2
+        getrs_trsm<BATCHED,STRIDED,T>(handle, uplo, trans, m2, nrhs, A, shift22, lda, strideA, B, shiftB + m1, ldb, strideB, batch_count, one, minone);
+
+        // B1 = B1 - op(A)12 * B2
+        rocblasCall_gemm<BATCHED,STRIDED,T>(handle, trans, rocblas_operation_none,
+                                            m1, nrhs, m2, minone,
+                                            A, trans == rocblas_operation_none ? shift12 : shift21, lda, strideA,
+                                            B, shiftB + m1, ldb, strideB, one,
+                                            B, shiftB, ldb, strideB, batch_count, nullptr);
+
+        // B1 = inv(op(A11)) * B1
+        getrs_trsm<BATCHED,STRIDED,T>(handle, uplo, trans, m1, nrhs, A, shift11, lda, strideA, B, shiftB, ldb, strideB, batch_count, one, minone);
+    }
+}
+
+// true if getrs solves the systems with getrs_kernel_small
+inline bool getrs_use_small(const rocblas_int n, const rocblas_int nrhs)
+{
+    #ifdef OPTIMAL
+    return n <= GETRS_SMALL_MAX_SIZE && nrhs <= GETRS_SMALL_MAX_NRHS;
+    #else
+    return false;
+    #endif
+}
+
+// true if the triangular solves of getrs are done with getrs_trsm instead of rocblas trsm
+// (for batches of small matrices, it avoids the workspace of trsm and the inversion of the
+// diagonal blocks of every instance)
+inline bool getrs_use_batched_trsm(const rocblas_int n, const rocblas_int batch_count)
+{
+    return batch_count > 1 && n <= GETRS_BATCH_TRSM_MAX_SIZE;
+}
+
+
+template <bool BATCHED, typename T, typename U>
 rocblas_status rocsolver_getrs_template(rocblas_handle handle, const rocblas_operation trans,
                          const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int shiftA,
                          const rocblas_int lda, const rocblas_stride strideA, const rocblas_int *ipiv, const rocblas_stride strideP, U B,
-                         const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count) 
+                         const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count,
+                         void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem,
+                         U invL = nullptr, U invU = nullptr) 
 {
     // quick return
     if (n == 0 || nrhs == 0 || batch_count == 0) {
       return rocblas_status_success;
     }
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-    
+    #ifdef OPTIMAL
+    // small systems (with a few right hand sides) are solved by a single kernel
+    if (getrs_use_small(n, nrhs))
+        return getrs_run_small<T>(handle,trans,n,nrhs,A,shiftA,lda,strideA,ipiv,strideP,B,shiftB,ldb,strideB,batch_count);
+    #endif
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle,&old_mode);
     rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        T* BB[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-        hipMemcpy(BB, B, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-        T* BB = B;
-    #endif
-
     //constants to use when calling rocablas functions
     T one = 1;            //constant 1 in host
+    T minone = -1;        //constant -1 in host
+
+    // batches of small matrices
+    if (getrs_use_batched_trsm(n, batch_count)) {
+        static constexpr bool STRIDED = !BATCHED;
+        rocblas_fill first = (trans == rocblas_operation_none) ? rocblas_fill_lower : rocblas_fill_upper;
+        rocblas_fill second = (trans == rocblas_operation_none) ? rocblas_fill_upper : rocblas_fill_lower;
 
-    T *Ap, *Bp;
+        if (trans == rocblas_operation_none)
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, 1, batch_count);
+        getrs_trsm<BATCHED,STRIDED,T>(handle, first, trans, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, &one, &minone);
+        getrs_trsm<BATCHED,STRIDED,T>(handle, second, trans, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, &one, &minone);
+        if (trans != rocblas_operation_none)
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, -1, batch_count);
 
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL
-    //      FUNCITONALITY IS ENABLED. ****
+        rocblas_set_pointer_mode(handle,old_mode);
+        return rocblas_status_success;
+    }
 
+    // (when the inverses of the diagonal blocks of L and U are supplied in invL and invU,
+    //  see getrf_cache, trsm does not need to compute them)
     if (trans == rocblas_operation_none) {
 
         // first apply row interchanges to the right hand sides
         rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, 1, batch_count);
 
-        for (int b = 0; b < batch_count; ++b) {
-            Ap = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            Bp = load_ptr_batch<T>(BB,b,shiftB,strideB);
-            
-            // solve L*X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
-                    trans, rocblas_diagonal_unit, n, nrhs,
-                    &one, Ap, lda, Bp, ldb);
-
-            // solve U*X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
-                    trans, rocblas_diagonal_non_unit, n, nrhs,
-                    &one, Ap, lda, Bp, ldb);
-        }
+        // solve L*X = B, overwriting B with X
+        rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_lower, trans, rocblas_diagonal_unit,
+                                    n, nrhs, &one,
+                                    A, shiftA, lda, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                    x_temp, x_temp_arr, invA, invA_arr,
+                                    invL, invL ? ROCBLAS_TRSM_BLOCK * n : 0);
+
+        // solve U*X = B, overwriting B with X
+        rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_upper, trans, rocblas_diagonal_non_unit,
+                                    n, nrhs, &one,
+                                    A, shiftA, lda, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                    x_temp, x_temp_arr, invA, invA_arr,
+                                    invU, invU ? ROCBLAS_TRSM_BLOCK * n : 0);
     
     } else {
 
-        for (int b = 0; b < batch_count; ++b) {
-            Ap = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            Bp = load_ptr_batch<T>(BB,b,shiftB,strideB);
-            
-            // solve U**T *X = B or U**H *X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper, trans,
-                    rocblas_diagonal_non_unit, n, nrhs,
-                    &one, Ap, lda, Bp, ldb);
-
-            // solve L**T *X = B, or L**H *X = B overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, trans,
-                    rocblas_diagonal_unit, n, nrhs, &one,
-                    Ap, lda, Bp, ldb);
-        }
+        // solve U**T *X = B or U**H *X = B, overwriting B with X
+        rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_upper, trans, rocblas_diagonal_non_unit,
+                                    n, nrhs, &one,
+                                    A, shiftA, lda, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                    x_temp, x_temp_arr, invA, invA_arr,
+                                    invU, invU ? ROCBLAS_TRSM_BLOCK * n : 0);
+
+        // solve L**T *X = B, or L**H *X = B overwriting B with X
+        rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, rocblas_fill_lower, trans, rocblas_diagonal_unit,
+                                    n, nrhs, &one,
+                                    A, shiftA, lda, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                    x_temp, x_temp_arr, invA, invA_arr,
+                                    invL, invL ? ROCBLAS_TRSM_BLOCK * n : 0);
 
         // then apply row interchanges to the solution vectors
         rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, -1, batch_count);
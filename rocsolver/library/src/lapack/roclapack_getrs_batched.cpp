@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getrs.hpp"
 
 template <typename T, typename U>
@@ -25,16 +24,33 @@ rocblas_status rocsolver_getrs_batched_impl(rocblas_handle handle, const rocblas
 
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (it is not needed for batches of small matrices, see getrs_kernel_small and getrs_trsm)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (!getrs_use_small(n, nrhs) && !getrs_use_batched_trsm(n, batch_count)) {
+        rocblas_status perf_status = rocblasCall_trsm_mem<true,T,U>(handle,rocblas_side_left,n,nrhs,batch_count,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
 
     // execution
-    return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
+    return rocsolver_getrs_template<true,T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
                                         ipiv,strideP,
                                         B,0,
                                         ldb,strideB,
-                                        batch_count);
+                                        batch_count,
+                                        x_temp,
+                                        x_temp_arr,
+                                        invA,
+                                        invA_arr,
+                                        optim_mem);
 }
 
 
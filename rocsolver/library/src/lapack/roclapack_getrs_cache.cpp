@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf_cache.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrs_cache_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, T *A, const rocblas_int lda,
+                 const rocblas_int *ipiv, T *cache, T *B, const rocblas_int ldb)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_cache_argCheck(trans,n,nrhs,lda,ldb,A,B,ipiv,cache);
+    if (st != rocblas_status_continue)
+        return st;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    T *invL = cache;
+    T *invU = cache + size_t(ROCBLAS_TRSM_BLOCK) * n;
+
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (invA is not needed as the inverses of the diagonal blocks are supplied by the cache)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (!getrs_use_small(n, nrhs)) {
+        rocblas_status perf_status = rocblasCall_trsm_mem<false,T,T*>(handle,rocblas_side_left,n,nrhs,batch_count,x_temp,x_temp_arr,invA,invA_arr,
+                                                                      invL,ROCBLAS_TRSM_BLOCK*n);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
+
+    // execution
+    return rocsolver_getrs_template<false,T>(handle,trans,n,nrhs,
+                                        A,0,
+                                        lda,strideA,
+                                        ipiv,strideP,
+                                        B,0,
+                                        ldb,strideB,
+                                        batch_count,
+                                        x_temp,
+                                        x_temp_arr,
+                                        invA,
+                                        invA_arr,
+                                        optim_mem,
+                                        invL,
+                                        invU);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_cache(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, float *A, const rocblas_int lda, const rocblas_int *ipiv, float *cache,
+                 float *B, const rocblas_int ldb)
+{
+    return rocsolver_getrs_cache_impl<float>(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_cache(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, double *A, const rocblas_int lda, const rocblas_int *ipiv, double *cache,
+                 double *B, const rocblas_int ldb)
+{
+    return rocsolver_getrs_cache_impl<double>(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_cache(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_float_complex *cache, rocblas_float_complex *B, const rocblas_int ldb)
+{
+    return rocsolver_getrs_cache_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_cache(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_double_complex *cache, rocblas_double_complex *B, const rocblas_int ldb)
+{
+    return rocsolver_getrs_cache_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, ipiv, cache, B, ldb);
+}
+
+} //extern C
@@ -0,0 +1,68 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_interleaved.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrs_interleaved_batched_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                                                        const rocblas_int nrhs, T *A, const rocblas_int lda, const rocblas_int *ipiv,
+                                                        T *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_interleaved_argCheck(trans,n,nrhs,lda,ldb,A,B,ipiv,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // execution
+    return rocsolver_getrs_interleaved_template<T>(handle,trans,n,nrhs,A,lda,ipiv,B,ldb,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_interleaved_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, float *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 float *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_interleaved_batched_impl<float>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_interleaved_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, double *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 double *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_interleaved_batched_impl<double>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_interleaved_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_float_complex *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_interleaved_batched_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_interleaved_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_double_complex *B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_interleaved_batched_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+}
@@ -19,18 +19,46 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle, const
     if (st != rocblas_status_continue)
         return st;
 
+    // broadcast of the factors: if all the systems share A and ipiv (strideA = strideP = 0)
+    // and the right hand sides are contiguous, the batch is solved as a single system
+    // with nrhs*batch_count right hand sides (the factors are then read only once)
+    rocblas_int nrhs_all = nrhs;
+    rocblas_int bc = batch_count;
+    if (strideA == 0 && strideP == 0 && batch_count > 1 && strideB == rocblas_stride(ldb) * nrhs
+        && int64_t(nrhs) * batch_count <= std::numeric_limits<rocblas_int>::max()) {
+        nrhs_all = nrhs * batch_count;
+        bc = 1;
+    }
+
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    // (it is not needed for batches of small matrices, see getrs_kernel_small and getrs_trsm)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (!getrs_use_small(n, nrhs_all) && !getrs_use_batched_trsm(n, bc)) {
+        rocblas_status perf_status = rocblasCall_trsm_mem<false,T,U>(handle,rocblas_side_left,n,nrhs_all,bc,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
 
     // execution
-    return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
+    return rocsolver_getrs_template<false,T>(handle,trans,n,nrhs_all,
                                         A,0,
                                         lda,strideA,
                                         ipiv,strideP,
                                         B,0,
                                         ldb,strideB,
-                                        batch_count);
+                                        bc,
+                                        x_temp,
+                                        x_temp_arr,
+                                        invA,
+                                        invA_arr,
+                                        optim_mem);
 }
 
 
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrs.hpp"
+#include "roclapack_vbatched.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrs_vbatched_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int *n,
+                                             const rocblas_int *nrhs, T *const A[], const rocblas_int *lda,
+                                             const rocblas_int *const ipiv[], T *const B[], const rocblas_int *ldb,
+                                             const rocblas_int batch_count)
+{
+    using U = T *const *;
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    // (the sizes of the instances live on the device and can only be checked after they are copied)
+    if (trans != rocblas_operation_none && trans != rocblas_operation_transpose && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if (batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (batch_count && (!n || !nrhs || !A || !lda || !ipiv || !B || !ldb))
+        return rocblas_status_invalid_pointer;
+    if (batch_count == 0)
+        return rocsolver_is_workspace_query(handle) ? rocsolver_set_workspace_size(handle) : rocblas_status_success;
+
+    // the copy of the sizes to the host cannot be captured
+    if (rocsolver_get_handle_data(handle)->capture_mode)
+        return rocblas_status_not_implemented;
+
+    // group the instances with the same sizes
+    std::vector<std::vector<rocblas_int>> hsizes;
+    std::vector<rocblas_int> order;
+    std::vector<rocsolver_vbatched_group> groups;
+    rocblas_status st = rocsolver_vbatched_sort(handle, batch_count, {n, nrhs, lda, ldb}, hsizes, order, groups);
+    if (st != rocblas_status_success)
+        return st;
+    for (const rocsolver_vbatched_group& g : groups) {
+        if (g.sizes[0] < 0 || g.sizes[1] < 0 || g.sizes[2] < g.sizes[0] || g.sizes[3] < g.sizes[0])
+            return rocblas_status_invalid_size;
+    }
+
+    // memory managment
+    size_t size_1;  //for the sorted pointers to A
+    size_t size_2;  //for the sorted pointers to B
+    size_t size_3;  //for the sorted order
+    size_t size_4 = 0;  //for the pivots of the groups (contiguous)
+    for (const rocsolver_vbatched_group& g : groups)
+        size_4 += sizeof(rocblas_int) * g.count * g.sizes[0];
+    size_1 = sizeof(T*) * batch_count;
+    size_2 = sizeof(T*) * batch_count;
+    size_3 = sizeof(rocblas_int) * batch_count;
+
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_1,size_2,size_3,size_4);
+
+    rocsolver_device_malloc mem(handle,size_1,size_2,size_3,size_4);
+    if (!mem)
+        return rocblas_status_memory_error;
+    T** Ap = (T**)mem[0];
+    T** Bp = (T**)mem[1];
+    rocblas_int* dorder = (rocblas_int*)mem[2];
+    rocblas_int* ipivp = (rocblas_int*)mem[3];
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // sort the matrices and gather the pivots of every group
+    // (order is pageable host memory, so the copy is staged before returning and
+    // order can be released while the copy is still pending in the stream)
+    if (hipMemcpyAsync(dorder, order.data(), size_3, hipMemcpyHostToDevice, stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(vbatched_gather<T*>,dim3(blocks),dim3(BLOCKSIZE),0,stream,Ap,A,dorder,batch_count);
+    hipLaunchKernelGGL(vbatched_gather<T*>,dim3(blocks),dim3(BLOCKSIZE),0,stream,Bp,B,dorder,batch_count);
+
+    // execution
+    rocblas_status status = rocblas_status_success;
+    size_t offP = 0;
+    for (const rocsolver_vbatched_group& g : groups) {
+        rocblas_int gn = g.sizes[0], gnrhs = g.sizes[1], glda = g.sizes[2], gldb = g.sizes[3];
+        if (gn == 0 || gnrhs == 0)
+            continue;
+
+        blocks = (gn - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(vbatched_ipiv_gather<T>,dim3(blocks,g.count),dim3(BLOCKSIZE),0,stream,
+                           gn,dorder + g.first,ipiv,ipivp + offP);
+
+        // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+        void *x_temp, *x_temp_arr, *invA, *invA_arr;
+        rocblas_status perf_status = rocblasCall_trsm_mem<true,T,U>(handle,rocblas_side_left,gn,gnrhs,g.count,x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        bool optim_mem = perf_status == rocblas_status_success;
+
+        status = rocsolver_getrs_template<true,T>(handle,trans,gn,gnrhs,
+                                                  (U)(Ap + g.first),0,
+                                                  glda,0,
+                                                  ipivp + offP,gn,
+                                                  (U)(Bp + g.first),0,
+                                                  gldb,0,
+                                                  g.count,
+                                                  x_temp,
+                                                  x_temp_arr,
+                                                  invA,
+                                                  invA_arr,
+                                                  optim_mem);
+        if (status != rocblas_status_success)
+            return status;
+        offP += (size_t)g.count * gn;
+    }
+
+    return status;
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_vbatched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int *n,
+                 const rocblas_int *nrhs, float *const A[], const rocblas_int *lda, const rocblas_int *const ipiv[],
+                 float *const B[], const rocblas_int *ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<float>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_vbatched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int *n,
+                 const rocblas_int *nrhs, double *const A[], const rocblas_int *lda, const rocblas_int *const ipiv[],
+                 double *const B[], const rocblas_int *ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<double>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_vbatched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int *n,
+                 const rocblas_int *nrhs, rocblas_float_complex *const A[], const rocblas_int *lda, const rocblas_int *const ipiv[],
+                 rocblas_float_complex *const B[], const rocblas_int *ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_vbatched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int *n,
+                 const rocblas_int *nrhs, rocblas_double_complex *const A[], const rocblas_int *lda, const rocblas_int *const ipiv[],
+                 rocblas_double_complex *const B[], const rocblas_int *ldb, const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+}
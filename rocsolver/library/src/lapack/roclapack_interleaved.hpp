@@ -0,0 +1,397 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routines (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_INTERLEAVED_HPP
+#define ROCLAPACK_INTERLEAVED_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "common_device.hpp"
+
+/*******************************************************************************
+ *! \brief   kernels of the interleaved batched functions.
+ *
+ *           In the interleaved layout the entry (i,j) of the instance b is stored in
+ *           A[b + (i + j*lda)*batch_count], i.e. the same entry of all the instances is
+ *           contiguous in memory. Every thread takes care of one instance, so all the
+ *           accesses of a wavefront are to consecutive addresses (coalesced). This is
+ *           intended for large batches of tiny matrices (up to 16x16 or so), for which
+ *           the usual layouts cannot use the memory bandwidth.
+ ******************************************************************************/
+
+// entry (i,j) of the current instance of an interleaved matrix with leading dimension ld
+#define ILV(A, ld, i, j) A[(size_t(i) + size_t(j) * (ld)) * batch_count]
+
+/** ILV_REAL returns the real part of x (x itself for real types) **/
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline T ilv_real(const T x)
+{
+    return x;
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline auto ilv_real(const T x)
+{
+    return x.real();
+}
+
+/** GETRF_INTERLEAVED_KERNEL computes the LU factorization with partial pivoting
+    of one instance per thread (unblocked right-looking algorithm, as in getf2) **/
+template <typename T>
+__global__ void getrf_interleaved_kernel(const rocblas_int m, const rocblas_int n, T* AA, const rocblas_int lda,
+                                         rocblas_int* ipivA, rocblas_int* info, const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b >= batch_count)
+        return;
+
+    T* A = AA + b;
+    rocblas_int* ipiv = ipivA + b;
+    rocblas_int myinfo = 0;
+    rocblas_int dim = min(m, n);
+
+    for (rocblas_int k = 0; k < dim; ++k) {
+        // find pivot
+        rocblas_int p = k;
+        S vmax = aabs(ILV(A, lda, k, k));
+        for (rocblas_int i = k + 1; i < m; ++i) {
+            S v = aabs(ILV(A, lda, i, k));
+            if (v > vmax) {
+                vmax = v;
+                p = i;
+            }
+        }
+        ipiv[size_t(k) * batch_count] = p + 1;  //use fortran 1-based index
+
+        T pivot_value = ILV(A, lda, p, k);
+        if (pivot_value == 0) {
+            // singular matrix: the column is already zero below the diagonal
+            if (myinfo == 0)
+                myinfo = k + 1;
+            continue;
+        }
+
+        // swap rows
+        if (p != k) {
+            for (rocblas_int j = 0; j < n; ++j) {
+                T t = ILV(A, lda, k, j);
+                ILV(A, lda, k, j) = ILV(A, lda, p, j);
+                ILV(A, lda, p, j) = t;
+            }
+        }
+
+        // scale column and update trailing matrix
+        T r = T(1) / pivot_value;
+        for (rocblas_int i = k + 1; i < m; ++i)
+            ILV(A, lda, i, k) *= r;
+        for (rocblas_int j = k + 1; j < n; ++j) {
+            T t = ILV(A, lda, k, j);
+            for (rocblas_int i = k + 1; i < m; ++i)
+                ILV(A, lda, i, j) -= ILV(A, lda, i, k) * t;
+        }
+    }
+
+    info[b] = myinfo;
+}
+
+/** GETRS_INTERLEAVED_KERNEL solves the system of one instance per thread with the
+    factors computed by getrf_interleaved_kernel **/
+template <typename T>
+__global__ void getrs_interleaved_kernel(const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
+                                         T* AA, const rocblas_int lda, const rocblas_int* ipivA,
+                                         T* BB, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b >= batch_count)
+        return;
+
+    T* A = AA + b;
+    T* B = BB + b;
+    const rocblas_int* ipiv = ipivA + b;
+    const bool cj = (trans == rocblas_operation_conjugate_transpose);
+
+    if (trans == rocblas_operation_none) {
+        for (rocblas_int j = 0; j < nrhs; ++j) {
+            // apply row interchanges
+            for (rocblas_int k = 0; k < n; ++k) {
+                rocblas_int p = ipiv[size_t(k) * batch_count] - 1;
+                if (p != k) {
+                    T t = ILV(B, ldb, k, j);
+                    ILV(B, ldb, k, j) = ILV(B, ldb, p, j);
+                    ILV(B, ldb, p, j) = t;
+                }
+            }
+            // solve L*y = b (unit diagonal)
+            for (rocblas_int k = 0; k < n; ++k) {
+                T t = ILV(B, ldb, k, j);
+                for (rocblas_int i = k + 1; i < n; ++i)
+                    ILV(B, ldb, i, j) -= ILV(A, lda, i, k) * t;
+            }
+            // solve U*x = y
+            for (rocblas_int k = n - 1; k >= 0; --k) {
+                ILV(B, ldb, k, j) /= ILV(A, lda, k, k);
+                T t = ILV(B, ldb, k, j);
+                for (rocblas_int i = 0; i < k; ++i)
+                    ILV(B, ldb, i, j) -= ILV(A, lda, i, k) * t;
+            }
+        }
+    } else {
+        for (rocblas_int j = 0; j < nrhs; ++j) {
+            // solve U'*y = b
+            for (rocblas_int i = 0; i < n; ++i) {
+                T t = ILV(B, ldb, i, j);
+                for (rocblas_int k = 0; k < i; ++k)
+                    t -= (cj ? conj(ILV(A, lda, k, i)) : ILV(A, lda, k, i)) * ILV(B, ldb, k, j);
+                ILV(B, ldb, i, j) = t / (cj ? conj(ILV(A, lda, i, i)) : ILV(A, lda, i, i));
+            }
+            // solve L'*x = y (unit diagonal)
+            for (rocblas_int i = n - 1; i >= 0; --i) {
+                T t = ILV(B, ldb, i, j);
+                for (rocblas_int k = i + 1; k < n; ++k)
+                    t -= (cj ? conj(ILV(A, lda, k, i)) : ILV(A, lda, k, i)) * ILV(B, ldb, k, j);
+                ILV(B, ldb, i, j) = t;
+            }
+            // apply row interchanges in reverse order
+            for (rocblas_int k = n - 1; k >= 0; --k) {
+                rocblas_int p = ipiv[size_t(k) * batch_count] - 1;
+                if (p != k) {
+                    T t = ILV(B, ldb, k, j);
+                    ILV(B, ldb, k, j) = ILV(B, ldb, p, j);
+                    ILV(B, ldb, p, j) = t;
+                }
+            }
+        }
+    }
+}
+
+/** GETRI_INTERLEAVED_KERNEL computes the inverse of one instance per thread from the
+    factors computed by getrf_interleaved_kernel (as in getri: inv(U) is computed first and
+    then inv(A)*L = inv(U) is solved for inv(A)). work holds n entries per instance,
+    also interleaved. **/
+template <typename T>
+__global__ void getri_interleaved_kernel(const rocblas_int n, T* AA, const rocblas_int lda, const rocblas_int* ipivA,
+                                         rocblas_int* info, T* workA, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b >= batch_count)
+        return;
+
+    T* A = AA + b;
+    T* work = workA + b;
+    const rocblas_int* ipiv = ipivA + b;
+
+    // check for singularity (the matrix is not modified)
+    for (rocblas_int j = 0; j < n; ++j) {
+        if (ILV(A, lda, j, j) == 0) {
+            info[b] = j + 1;    //use fortran 1-based index
+            return;
+        }
+    }
+    info[b] = 0;
+
+    // compute inv(U) in place
+    for (rocblas_int j = 0; j < n; ++j) {
+        ILV(A, lda, j, j) = T(1) / ILV(A, lda, j, j);
+        T ajj = -ILV(A, lda, j, j);
+        for (rocblas_int i = 0; i < j; ++i) {
+            T t = 0;
+            for (rocblas_int k = i; k < j; ++k)
+                t += ILV(A, lda, i, k) * ILV(A, lda, k, j);
+            ILV(A, lda, i, j) = t * ajj;
+        }
+    }
+
+    // solve inv(A)*L = inv(U)
+    for (rocblas_int j = n - 2; j >= 0; --j) {
+        for (rocblas_int i = j + 1; i < n; ++i) {
+            work[size_t(i) * batch_count] = ILV(A, lda, i, j);
+            ILV(A, lda, i, j) = 0;
+        }
+        for (rocblas_int r = 0; r < n; ++r) {
+            T t = ILV(A, lda, r, j);
+            for (rocblas_int i = j + 1; i < n; ++i)
+                t -= ILV(A, lda, r, i) * work[size_t(i) * batch_count];
+            ILV(A, lda, r, j) = t;
+        }
+    }
+
+    // apply column interchanges in reverse order
+    for (rocblas_int j = n - 2; j >= 0; --j) {
+        rocblas_int p = ipiv[size_t(j) * batch_count] - 1;
+        if (p != j) {
+            for (rocblas_int i = 0; i < n; ++i) {
+                T t = ILV(A, lda, i, j);
+                ILV(A, lda, i, j) = ILV(A, lda, i, p);
+                ILV(A, lda, i, p) = t;
+            }
+        }
+    }
+}
+
+/** POTRF_INTERLEAVED_KERNEL computes the Cholesky factorization of one instance per
+    thread (unblocked algorithm, as in potf2) **/
+template <typename T>
+__global__ void potrf_interleaved_kernel(const rocblas_fill uplo, const rocblas_int n, T* AA, const rocblas_int lda,
+                                         rocblas_int* info, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b >= batch_count)
+        return;
+
+    T* A = AA + b;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // entry (i,j) of U (upper) or entry (j,i) of L (lower)
+    auto F = [&](rocblas_int i, rocblas_int j) -> T& {
+        return upper ? ILV(A, lda, i, j) : ILV(A, lda, j, i);
+    };
+
+    for (rocblas_int j = 0; j < n; ++j) {
+        // compute diagonal element
+        T t = F(j, j);
+        for (rocblas_int k = 0; k < j; ++k)
+            t -= conj(F(k, j)) * F(k, j);
+        auto ajj = ilv_real(t);
+
+        // error for non-positive definiteness
+        if (ajj <= 0) {
+            F(j, j) = ajj;
+            info[b] = j + 1;    //use fortran 1-based index
+            return;
+        }
+        ajj = sqrt(ajj);
+        F(j, j) = ajj;
+
+        // compute the rest of the row of U (column of L)
+        for (rocblas_int i = j + 1; i < n; ++i) {
+            T s = F(j, i);
+            for (rocblas_int k = 0; k < j; ++k)
+                s -= conj(F(k, j)) * F(k, i);
+            F(j, i) = s / T(ajj);
+        }
+    }
+
+    info[b] = 0;
+}
+
+#undef ILV
+
+
+template <typename T>
+rocblas_status rocsolver_getrs_interleaved_argCheck(const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
+                                                    const rocblas_int lda, const rocblas_int ldb, T A, T B,
+                                                    const rocblas_int *ipiv, const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if (trans != rocblas_operation_none && trans != rocblas_operation_transpose && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if ((n*batch_count && !A) || (n*batch_count && !ipiv) || (nrhs*n*batch_count && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+void rocsolver_getri_interleaved_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // size of the work array (n entries per instance)
+    *size = sizeof(T) * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_interleaved_template(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                                    T* A, const rocblas_int lda, rocblas_int* ipiv, rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    // quick return
+    if (m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(getrf_interleaved_kernel<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       m,n,A,lda,ipiv,info,batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_interleaved_template(rocblas_handle handle, const rocblas_operation trans,
+                                                    const rocblas_int n, const rocblas_int nrhs, T* A, const rocblas_int lda,
+                                                    const rocblas_int* ipiv, T* B, const rocblas_int ldb,
+                                                    const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(getrs_interleaved_kernel<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       trans,n,nrhs,A,lda,ipiv,B,ldb,batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_getri_interleaved_template(rocblas_handle handle, const rocblas_int n, T* A, const rocblas_int lda,
+                                                    const rocblas_int* ipiv, rocblas_int* info, T* work,
+                                                    const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(getri_interleaved_kernel<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       n,A,lda,ipiv,info,work,batch_count);
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_interleaved_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                                    T* A, const rocblas_int lda, rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(potrf_interleaved_kernel<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,
+                       uplo,n,A,lda,info,batch_count);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_INTERLEAVED_HPP */
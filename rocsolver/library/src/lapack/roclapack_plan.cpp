@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf.hpp"
+#include "roclapack_getri.hpp"
+#include "roclapack_geqrf.hpp"
+#include <type_traits>
+
+/*******************************************************************************
+ *! \brief   solver plans: everything that only depends on the sizes (and the 
+ *           options of the handle) is done once at creation, so that the execution 
+ *           only has to enqueue the work.
+ ******************************************************************************/
+
+struct rocsolver_plan_
+{
+    rocblas_handle handle;
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int lda;
+    rocblas_stride strideA;
+    rocblas_stride strideP;
+    rocblas_int batch_count;
+    rocblas_int pivot;
+
+    // resolved at creation
+    bool blocked;                       // blocked algorithm (it needs trsm memory in the rocblas handle)
+    rocsolver_getrf_options getrf_opt;  // options of the handle at creation
+    void* scalars = nullptr;
+    void* workspace = nullptr;  // owned by the plan
+    void* work[4] = {};         // pieces of the workspace
+
+    // the side stream and host buffers used by getrf_opt are shared with the handle data,
+    // which could replace them after the creation
+    std::shared_ptr<rocsolver_side_stream> side;
+    std::shared_ptr<rocsolver_host_panel> host_panel;
+
+    rocblas_status (*execute)(rocsolver_plan_*, void*, void*, rocblas_int*) = nullptr;
+
+    ~rocsolver_plan_()
+    {
+        if (workspace)
+            hipFree(workspace);
+    }
+};
+
+// allocates the workspace of the plan and carves the pieces
+template <typename... Ss>
+static rocblas_status plan_malloc(rocsolver_plan_* plan, Ss... sizes)
+{
+    size_t total = workspace_total_size(sizes...);
+    if (total && hipMalloc(&plan->workspace, total) != hipSuccess)
+    {
+        plan->workspace = nullptr;
+        return rocblas_status_memory_error;
+    }
+
+    size_t list[] = {size_t(sizes)...};
+    size_t offset = 0;
+    for (size_t i = 0; i < sizeof...(sizes); ++i)
+    {
+        plan->work[i] = list[i] ? (char*)plan->workspace + offset : nullptr;
+        offset += workspace_align(list[i]);
+    }
+    return rocblas_status_success;
+}
+
+
+/************** GETRF / GETRF_NPVT ********************************************/
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_getrf_execute(rocsolver_plan_* plan, void* AA, void* P, rocblas_int* info)
+{
+    using U = typename std::conditional<BATCHED, T* const*, T*>::type;
+    using S = decltype(std::real(T{}));
+    U A = (U)AA;
+    rocblas_int* ipiv = (rocblas_int*)P;
+    rocblas_int m = plan->m, n = plan->n;
+
+    if ((m*n && !A) || (m*n && plan->pivot && !ipiv) || (plan->batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    // the trsm memory lives in the rocblas handle and could have been moved by
+    // other rocblas calls since the creation, so it is retrieved every time
+    // (this is a rocblas call; the rocsolver data of the handle is not looked up)
+    void *x_temp = nullptr, *x_temp_arr = nullptr, *invA = nullptr, *invA_arr = nullptr;
+    bool optim_mem = true;
+    if (plan->blocked)
+    {
+        rocblas_status perf_status = rocblasCall_trsm_mem<BATCHED,T,U>(plan->handle,rocblas_side_left,GETRF_GETF2_SWITCHSIZE,n,plan->batch_count,
+                                                                       x_temp,x_temp_arr,invA,invA_arr);
+        if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+            return perf_status;
+        optim_mem = perf_status == rocblas_status_success;
+    }
+
+    // the hybrid mode waits for the copies of the panels, which is not possible while 
+    // the stream is being captured (the capture mode of the handle was only checked at creation):
+    // the panels are then factorized on the device (the workspace is the same)
+    rocsolver_getrf_options opt = plan->getrf_opt;
+    if (opt.host_panel)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(plan->handle, &stream);
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        if (hipStreamIsCapturing(stream, &capture) != hipSuccess || capture != hipStreamCaptureStatusNone)
+            opt.host_panel = nullptr;
+    }
+
+    return rocsolver_getrf_template<BATCHED,STRIDED,T,S>(plan->handle,m,n,
+                                                         A,0,plan->lda,plan->strideA,
+                                                         ipiv,0,plan->strideP,
+                                                         info,plan->batch_count,plan->pivot,
+                                                         (T*)plan->scalars,
+                                                         (T*)plan->work[0],
+                                                         (rocblas_int*)plan->work[1],
+                                                         (rocblas_int*)plan->work[2],
+                                                         (rocblas_index_value_t<S>*)plan->work[3],
+                                                         x_temp,x_temp_arr,invA,invA_arr,optim_mem,
+                                                         opt);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_getrf_setup(rocsolver_plan_* plan)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int m = plan->m, n = plan->n;
+
+    if (m < 0 || n < 0 || plan->lda < m || plan->batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // the options of the handle are fixed at creation (the workspace depends on the pivoting strategy)
+    rocsolver_handle_data* data = rocsolver_get_handle_data(plan->handle);
+    plan->getrf_opt.tournament = plan->pivot && data->tournament_pivoting;
+    plan->blocked = m && n && plan->batch_count && getrf_use_blocked<BATCHED || STRIDED>(m, n);
+    if (plan->blocked)
+    {
+        rocblas_status status = rocsolver_getrf_get_options<BATCHED || STRIDED,T>(data,m,n,&plan->getrf_opt);
+        if (status != rocblas_status_success)
+            return status;
+        if (plan->getrf_opt.side)
+            plan->side = data->side;
+        if (plan->getrf_opt.host_panel)
+            plan->host_panel = data->host_panel;
+    }
+
+    size_t size_1, size_2, size_3, size_4, size_5;
+    rocsolver_getrf_getMemorySize<T,S>(m,n,plan->batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,plan->getrf_opt.tournament);
+
+    plan->execute = plan_getrf_execute<BATCHED,STRIDED,T>;
+    return plan_malloc(plan,size_2,size_3,size_4,size_5);
+}
+
+
+/************** GETRI *********************************************************/
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_getri_execute(rocsolver_plan_* plan, void* AA, void* P, rocblas_int* info)
+{
+    using U = typename std::conditional<BATCHED, T* const*, T*>::type;
+    U A = (U)AA;
+    rocblas_int* ipiv = (rocblas_int*)P;
+    rocblas_int n = plan->n;
+
+    if ((n && !A) || (n && !ipiv) || (plan->batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocsolver_getri_template<BATCHED,STRIDED,T>(plan->handle,n,
+                                                       A,0,plan->lda,plan->strideA,
+                                                       ipiv,0,plan->strideP,
+                                                       info,plan->batch_count,
+                                                       (T*)plan->scalars,
+                                                       (T*)plan->work[0],
+                                                       (T**)plan->work[1]);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_getri_setup(rocsolver_plan_* plan)
+{
+    rocblas_int n = plan->n;
+
+    if (plan->m != n || n < 0 || plan->lda < n || plan->batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    size_t size_1, size_2, size_3;
+    rocsolver_getri_getMemorySize<BATCHED,T>(n,plan->batch_count,&size_1,&size_2,&size_3);
+
+    plan->execute = plan_getri_execute<BATCHED,STRIDED,T>;
+    return plan_malloc(plan,size_2,size_3);
+}
+
+
+/************** GEQRF *********************************************************/
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_geqrf_execute(rocsolver_plan_* plan, void* AA, void* P, rocblas_int* info)
+{
+    using U = typename std::conditional<BATCHED, T* const*, T*>::type;
+    U A = (U)AA;
+    T* tau = (T*)P;
+    rocblas_int m = plan->m, n = plan->n;
+
+    if ((m*n && !A) || (m*n && !tau))
+        return rocblas_status_invalid_pointer;
+
+    return rocsolver_geqrf_template<BATCHED,STRIDED,T>(plan->handle,m,n,
+                                                       A,0,plan->lda,plan->strideA,
+                                                       tau,plan->strideP,
+                                                       plan->batch_count,
+                                                       (T*)plan->scalars,
+                                                       (T*)plan->work[0],
+                                                       (T**)plan->work[1],
+                                                       (T*)plan->work[2],
+                                                       (T*)plan->work[3]);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+static rocblas_status plan_geqrf_setup(rocsolver_plan_* plan)
+{
+    rocblas_int m = plan->m, n = plan->n;
+
+    if (m < 0 || n < 0 || plan->lda < m || plan->batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    size_t size_1, size_2, size_3, size_4, size_5;
+    rocsolver_geqrf_getMemorySize<T,BATCHED>(m,n,plan->batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    plan->execute = plan_geqrf_execute<BATCHED,STRIDED,T>;
+    return plan_malloc(plan,size_2,size_3,size_4,size_5);
+}
+
+
+template <typename T>
+static rocblas_status plan_setup(rocsolver_plan_* plan, const rocsolver_plan_routine routine)
+{
+    plan->scalars = rocsolver_get_constants<T>(plan->handle);
+    if (!plan->scalars)
+        return rocblas_status_memory_error;
+
+    switch (routine)
+    {
+        case rocsolver_plan_getrf:
+        case rocsolver_plan_getrf_npvt:
+            return plan_getrf_setup<false,false,T>(plan);
+        case rocsolver_plan_getrf_batched:
+        case rocsolver_plan_getrf_npvt_batched:
+            return plan_getrf_setup<true,false,T>(plan);
+        case rocsolver_plan_getrf_strided_batched:
+        case rocsolver_plan_getrf_npvt_strided_batched:
+            return plan_getrf_setup<false,true,T>(plan);
+        case rocsolver_plan_getri:
+            return plan_getri_setup<false,false,T>(plan);
+        case rocsolver_plan_getri_batched:
+            return plan_getri_setup<true,false,T>(plan);
+        case rocsolver_plan_getri_strided_batched:
+            return plan_getri_setup<false,true,T>(plan);
+        case rocsolver_plan_geqrf:
+            return plan_geqrf_setup<false,false,T>(plan);
+        case rocsolver_plan_geqrf_batched:
+            return plan_geqrf_setup<true,false,T>(plan);
+        case rocsolver_plan_geqrf_strided_batched:
+            return plan_geqrf_setup<false,true,T>(plan);
+        default:
+            return rocblas_status_invalid_value;
+    }
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_create(rocblas_handle handle, const rocsolver_plan_routine routine,
+                 const rocblas_datatype type, const rocblas_int m, const rocblas_int n, const rocblas_int lda,
+                 const rocblas_stride strideA, const rocblas_stride strideP, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+
+    std::unique_ptr<rocsolver_plan_> p(new rocsolver_plan_);
+    p->handle = handle;
+    p->m = m;
+    p->n = n;
+    p->lda = lda;
+    p->pivot = 1;
+    p->blocked = false;
+
+    // normalize the arguments that do not apply to the routine
+    switch (routine)
+    {
+        case rocsolver_plan_getrf_npvt:
+        case rocsolver_plan_getrf_npvt_batched:
+        case rocsolver_plan_getrf_npvt_strided_batched:
+            p->pivot = 0;
+            break;
+        default:
+            break;
+    }
+    switch (routine)
+    {
+        case rocsolver_plan_getrf:
+        case rocsolver_plan_getrf_npvt:
+        case rocsolver_plan_getri:
+        case rocsolver_plan_geqrf:
+            p->strideA = 0;
+            p->strideP = 0;
+            p->batch_count = 1;
+            break;
+        case rocsolver_plan_getrf_batched:
+        case rocsolver_plan_getrf_npvt_batched:
+        case rocsolver_plan_getri_batched:
+        case rocsolver_plan_geqrf_batched:
+            p->strideA = 0;
+            p->strideP = p->pivot ? strideP : 0;
+            p->batch_count = batch_count;
+            break;
+        default:
+            p->strideA = strideA;
+            p->strideP = p->pivot ? strideP : 0;
+            p->batch_count = batch_count;
+            break;
+    }
+
+    rocblas_status status;
+    switch (type)
+    {
+        case rocblas_datatype_f32_r:
+            status = plan_setup<float>(p.get(), routine);
+            break;
+        case rocblas_datatype_f64_r:
+            status = plan_setup<double>(p.get(), routine);
+            break;
+        case rocblas_datatype_f32_c:
+            status = plan_setup<rocblas_float_complex>(p.get(), routine);
+            break;
+        case rocblas_datatype_f64_c:
+            status = plan_setup<rocblas_double_complex>(p.get(), routine);
+            break;
+        default:
+            status = rocblas_status_invalid_value;
+    }
+    if (status != rocblas_status_success)
+        return status;
+
+    *plan = p.release();
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_execute(rocsolver_plan plan, void *A, void *P, rocblas_int *info)
+{
+    if(!plan)
+        return rocblas_status_invalid_handle;
+
+    return plan->execute(plan, A, P, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_plan_destroy(rocsolver_plan plan)
+{
+    if(!plan)
+        return rocblas_status_invalid_handle;
+
+    delete plan;
+    return rocblas_status_success;
+}
+
+} //extern C
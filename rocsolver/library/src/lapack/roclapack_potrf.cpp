@@ -22,41 +22,53 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle, const rocblas_fill up
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not allocated, they live in the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  
     size_t size_4;  
     rocsolver_potrf_getMemorySize<T>(n,batch_count,&size_1,&size_2,&size_3,&size_4);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *pivotGPU, *iinfo;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&pivotGPU,size_3);
-    hipMalloc(&iinfo,size_4);
-    if (!scalars || (size_2 && !work) || (size_3 && !pivotGPU) || (size_4 && !iinfo))
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle,size_2,size_3,size_4);
+
+    void *scalars, *work, *pivotGPU, *iinfo, *x_temp, *x_temp_arr, *invA, *invA_arr;
+    // (CAUTION: THIS PART IS ACTUALLY ALLOCATED IN THE ROBLAS HANDLE)
+    rocblas_status perf_status = (uplo == rocblas_fill_upper) ?
+        rocblasCall_trsm_mem<false,T,U>(handle,rocblas_side_left,POTRF_POTF2_SWITCHSIZE,n,batch_count,x_temp,x_temp_arr,invA,invA_arr) :
+        rocblasCall_trsm_mem<false,T,U>(handle,rocblas_side_right,n,POTRF_POTF2_SWITCHSIZE,batch_count,x_temp,x_temp_arr,invA,invA_arr);
+    if (perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+        return perf_status;
+    bool optim_mem = perf_status == rocblas_status_success;
+
+    rocsolver_device_malloc mem(handle,size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    work = mem[0];
+    pivotGPU = mem[1];
+    iinfo = mem[2];
 
     // scalar constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3*sizeof(T))
-    T sca[] = { -1, 0, 1 };
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca, size_1, hipMemcpyHostToDevice));
+    // (they live in the handle and are uploaded only the first time)
+    scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
-           rocsolver_potrf_template<S,T>(handle,uplo,n,
+           rocsolver_potrf_template<false,S,T>(handle,uplo,n,
                                          A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                          lda,strideA,
                                          info,batch_count,
                                          (T*)scalars,
                                          (T*)work,
                                          (T*)pivotGPU,
-                                         (rocblas_int*)iinfo);
+                                         (rocblas_int*)iinfo,
+                                         x_temp,
+                                         x_temp_arr,
+                                         invA,
+                                         invA_arr,
+                                         optim_mem);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(pivotGPU);
-    hipFree(iinfo);
     return status;
 }
 
@@ -36,13 +36,14 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n, const rocblas_int batch_
     }   
 }
 
-template <typename S, typename T, typename U, bool COMPLEX = is_complex<T>>
+template <bool BATCHED, typename S, typename T, typename U, bool COMPLEX = is_complex<T>>
 rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                         const rocblas_fill uplo, const rocblas_int n, U A,
                                         const rocblas_int shiftA,
                                         const rocblas_int lda, const rocblas_stride strideA,
                                         rocblas_int *info, const rocblas_int batch_count,
-                                        T*scalars, T* work, T* pivotGPU, rocblas_int *iinfo)
+                                        T*scalars, T* work, T* pivotGPU, rocblas_int *iinfo,
+                                        void* x_temp, void* x_temp_arr, void* invA, void* invA_arr, bool optim_mem)
 {
     // quick return
     if (n == 0 || batch_count == 0) 
@@ -60,15 +61,6 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     if (n < POTRF_POTF2_SWITCHSIZE) 
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, scalars, work, pivotGPU);
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-
     //constants for rocblas functions calls
     T t_one = 1;
     S s_one = 1;
@@ -77,15 +69,11 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BLOCKSIZE, 1, 1);
-    T* M;
     rocblas_int jb;
 
     //info=0 (starting with a positive definite matrix)
     hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
-
     if (uplo == rocblas_fill_upper) { // Compute the Cholesky factorization A = U'*U.
         for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
             // Factor diagonal and subdiagonal blocks 
@@ -98,12 +86,11 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
             
             if (j + jb < n) {
                 // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
-                             rocblas_diagonal_non_unit, jb, (n - j - jb), &t_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j, j + jb, lda)), lda);
-                }
+                rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                                            rocblas_diagonal_non_unit, jb, (n - j - jb), &t_one,
+                                            A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                            A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, optim_mem,
+                                            x_temp, x_temp_arr, invA, invA_arr);
 
                 rocblasCall_herk<S,T>(handle, uplo, rocblas_operation_conjugate_transpose, n-j-jb, jb, &s_minone,
                                 A, shiftA + idx2D(j,j+jb,lda), lda, strideA, &s_one,
@@ -123,12 +110,11 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
             
             if (j + jb < n) {
                 // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
-                             rocblas_diagonal_non_unit, (n - j - jb), jb, &t_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j + jb, j, lda)), lda);
-                }
+                rocblasCall_trsm<BATCHED,T>(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                                            rocblas_diagonal_non_unit, (n - j - jb), jb, &t_one,
+                                            A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                            A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count, optim_mem,
+                                            x_temp, x_temp_arr, invA, invA_arr);
 
                 rocblasCall_herk<S,T>(handle, uplo, rocblas_operation_none, n-j-jb, jb, &s_minone,
                                 A, shiftA + idx2D(j+jb,j,lda), lda, strideA, &s_one,
@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_interleaved.hpp"
+#include "roclapack_potf2.hpp"
+
+template <typename T>
+rocblas_status rocsolver_potrf_interleaved_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                                        T *A, const rocblas_int lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    // argument checking
+    rocblas_status st = rocsolver_potf2_potrf_argCheck(uplo,n,lda,A,info,batch_count);
+    if (st != rocblas_status_continue)
+        return st;
+
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_workspace_query(handle))
+        return rocsolver_set_workspace_size(handle);
+
+    // execution
+    return rocsolver_potrf_interleaved_template<T>(handle,uplo,n,A,lda,info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_interleaved_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 float *A, const rocblas_int lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_interleaved_batched_impl<float>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_interleaved_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 double *A, const rocblas_int lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_interleaved_batched_impl<double>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_interleaved_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_interleaved_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_interleaved_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_interleaved_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_VBATCHED_HPP
+#define ROCLAPACK_VBATCHED_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/*******************************************************************************
+ *! \brief   helpers of the variable-size batched (vbatched) functions:
+ *           the instances are sorted on the host by a key computed from their sizes,
+ *           and every group of instances with the same key is processed together
+ *           (either as a regular batched problem, when the key holds the exact sizes,
+ *           or by kernels that read the sizes of every instance from the device arrays).
+ ******************************************************************************/
+
+// maximum number of size arguments of a vbatched function
+#define VBATCHED_MAX_SIZES 4
+
+using rocsolver_vbatched_key = std::array<rocblas_int, VBATCHED_MAX_SIZES>;
+
+struct rocsolver_vbatched_group
+{
+    rocblas_int first;      // position of the first instance of the group in the sorted order
+    rocblas_int count;      // number of instances in the group
+    rocsolver_vbatched_key sizes;
+};
+
+/*! \brief rocsolver_vbatched_staging holds the pinned host buffer where the sizes are copied.
+
+    \details
+    A copy from the device to pageable memory is done by the runtime through its own pinned
+    buffer, in pieces, and cannot overlap with anything; copying to pinned memory is a single
+    DMA transfer. The buffer is kept by every host thread (the host waits for the copies, so
+    it is free again when rocsolver_vbatched_copy_sizes returns) and it only grows.
+******************************************************************************/
+struct rocsolver_vbatched_staging
+{
+    void* buffer = nullptr;
+    size_t size = 0;
+
+    ~rocsolver_vbatched_staging()
+    {
+        if (buffer)
+            hipHostFree(buffer);
+    }
+
+    // returns a buffer of at least size bytes, or nullptr if it could not be allocated
+    void* get(size_t bytes)
+    {
+        if (bytes <= size)
+            return buffer;
+        if (buffer)
+            hipHostFree(buffer);
+        buffer = nullptr;
+        size = 0;
+        if (hipHostMalloc(&buffer, bytes) != hipSuccess)
+            return nullptr;
+        size = bytes;
+        return buffer;
+    }
+};
+
+/*! \brief rocsolver_vbatched_copy_sizes copies the arrays of sizes to the host.
+
+    \details
+    The copies are done after the work already enqueued in the handle's stream, and the host
+    waits for them. dsizes holds the device arrays of sizes (at most VBATCHED_MAX_SIZES); on exit,
+    hsizes holds their host copies. (The copies go through the pinned staging buffer of
+    the calling thread, see rocsolver_vbatched_staging.)
+******************************************************************************/
+inline rocblas_status rocsolver_vbatched_copy_sizes(rocblas_handle handle, const rocblas_int batch_count,
+                                                    const std::vector<const rocblas_int*>& dsizes,
+                                                    std::vector<std::vector<rocblas_int>>& hsizes)
+{
+    static thread_local rocsolver_vbatched_staging staging;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t nsizes = dsizes.size();
+    rocblas_int* pinned = (rocblas_int*)staging.get(sizeof(rocblas_int) * batch_count * nsizes);
+    if (!pinned)
+        return rocblas_status_memory_error;
+    for (size_t k = 0; k < nsizes; ++k) {
+        if (hipMemcpyAsync(pinned + k*batch_count, dsizes[k], sizeof(rocblas_int)*batch_count, hipMemcpyDeviceToHost, stream) != hipSuccess)
+            return rocblas_status_internal_error;
+    }
+    if (hipStreamSynchronize(stream) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    hsizes.resize(nsizes);
+    for (size_t k = 0; k < nsizes; ++k)
+        hsizes[k].assign(pinned + k*batch_count, pinned + (k+1)*batch_count);
+
+    return rocblas_status_success;
+}
+
+/*! \brief rocsolver_vbatched_group_by sorts the instances by the given key and groups
+    the (consecutive) instances of order that have the same key.
+
+    \details
+    key(b) returns the rocsolver_vbatched_key of instance b. The sort is stable, so the
+    instances of a group keep their relative order.
+******************************************************************************/
+template <typename K>
+void rocsolver_vbatched_group_by(const rocblas_int batch_count, K key,
+                                 std::vector<rocblas_int>& order,
+                                 std::vector<rocsolver_vbatched_group>& groups)
+{
+    std::vector<rocsolver_vbatched_key> keys(batch_count);
+    for (rocblas_int b = 0; b < batch_count; ++b)
+        keys[b] = key(b);
+
+    order.resize(batch_count);
+    for (rocblas_int b = 0; b < batch_count; ++b)
+        order[b] = b;
+    std::stable_sort(order.begin(), order.end(), [&](rocblas_int a, rocblas_int b) { return keys[a] < keys[b]; });
+
+    groups.clear();
+    for (rocblas_int i = 0; i < batch_count; ++i) {
+        if (i == 0 || keys[order[i]] != groups.back().sizes)
+            groups.push_back({i, 0, keys[order[i]]});
+        groups.back().count++;
+    }
+}
+
+/*! \brief rocsolver_vbatched_sort copies the arrays of sizes to the host and groups the
+    instances with the same sizes (see rocsolver_vbatched_copy_sizes).
+******************************************************************************/
+inline rocblas_status rocsolver_vbatched_sort(rocblas_handle handle, const rocblas_int batch_count,
+                                              const std::vector<const rocblas_int*>& dsizes,
+                                              std::vector<std::vector<rocblas_int>>& hsizes,
+                                              std::vector<rocblas_int>& order,
+                                              std::vector<rocsolver_vbatched_group>& groups)
+{
+    rocblas_status st = rocsolver_vbatched_copy_sizes(handle, batch_count, dsizes, hsizes);
+    if (st != rocblas_status_success)
+        return st;
+
+    size_t nsizes = dsizes.size();
+    rocsolver_vbatched_group_by(batch_count, [&](rocblas_int b) {
+        rocsolver_vbatched_key s = {};
+        for (size_t k = 0; k < nsizes; ++k)
+            s[k] = hsizes[k][b];
+        return s;
+    }, order, groups);
+
+    return rocblas_status_success;
+}
+
+/** vbatched_gather copies the entries of array in to out, in the given order **/
+template <typename P>
+__global__ void vbatched_gather(P* out, P const* in, const rocblas_int* order, const rocblas_int batch_count)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < batch_count)
+        out[i] = in[order[i]];
+}
+
+/** vbatched_ipiv_gather copies the pivot vectors of the instances of a group into
+    a contiguous array (with stride dim) **/
+template <typename T>
+__global__ void vbatched_ipiv_gather(const rocblas_int dim, const rocblas_int* order,
+                                     const rocblas_int* const ipiv[], rocblas_int* tmp)
+{
+    int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int i = hipBlockIdx_y;
+
+    if (k < dim)
+        tmp[i*dim + k] = ipiv[order[i]][k];
+}
+
+/** vbatched_ipiv_scatter copies the pivot vectors and info of the instances of a group
+    from the contiguous arrays where they were computed **/
+template <typename T>
+__global__ void vbatched_ipiv_scatter(const rocblas_int dim, const rocblas_int* order,
+                                      rocblas_int* const ipiv[], const rocblas_int* tmp,
+                                      rocblas_int* info, const rocblas_int* itmp)
+{
+    int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int i = hipBlockIdx_y;
+
+    if (k < dim)
+        ipiv[order[i]][k] = tmp[i*dim + k];
+    if (k == 0)
+        info[order[i]] = itmp[i];
+}
+
+#endif /* ROCLAPACK_VBATCHED_HPP */
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver.h"
+#include "workspace.hpp"
+
+/*******************************************************************************
+ *! \brief   workspace size queries and user provided workspace.
+ ******************************************************************************/
+
+// settings of the handle (the default ones if it has no data; the getters do not create it)
+static const rocsolver_handle_data& rocsolver_handle_settings(rocblas_handle handle)
+{
+    static const rocsolver_handle_data defaults;
+    rocsolver_handle_data* data = rocsolver_find_handle_data(handle);
+    return data ? *data : defaults;
+}
+
+extern "C" rocblas_status rocsolver_start_workspace_size_query(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_data* data = rocsolver_create_handle_data(handle);
+    if(data->size_query)
+        return rocblas_status_size_query_mismatch;
+
+    data->size_query = true;
+    data->query_size = 0;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_stop_workspace_size_query(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data* data = rocsolver_find_handle_data(handle);
+    if(!data || !data->size_query)
+        return rocblas_status_size_query_mismatch;
+
+    *size = data->query_size;
+    data->size_query = false;
+    data->query_size = 0;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_workspace(rocblas_handle handle, void* workspace, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(size && !workspace)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data* data = rocsolver_create_handle_data(handle);
+    data->workspace = size ? workspace : nullptr;
+    data->workspace_size = size;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_release_handle_resources(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_release_handle_data(handle);
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_memory_stats(rocblas_handle handle, rocsolver_memory_stats* stats)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    // (the handles without data have no memory cache)
+    rocsolver_handle_data* data = rocsolver_find_handle_data(handle);
+    rocsolver_arena_stats as;
+    if(data)
+        as = data->arena->get_stats();
+    stats->bytes_in_use = as.bytes_in_use;
+    stats->peak_bytes_in_use = as.peak_bytes_in_use;
+    stats->bytes_reserved = as.bytes_reserved;
+    stats->allocations = as.allocations;
+    stats->allocations_avoided = as.allocations_avoided;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_capture_mode(rocblas_handle handle, rocsolver_capture_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocsolver_capture_disabled && mode != rocsolver_capture_enabled)
+        return rocblas_status_invalid_value;
+
+    rocsolver_handle_data* data = rocsolver_create_handle_data(handle);
+    if(!rocsolver_set_capture(data, mode == rocsolver_capture_enabled))
+        return rocblas_status_memory_error;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_capture_mode(rocblas_handle handle, rocsolver_capture_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver_handle_settings(handle).capture_mode ? rocsolver_capture_enabled
+                                                            : rocsolver_capture_disabled;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_memory_budget(rocblas_handle handle, size_t budget, rocblas_int min_chunk)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(min_chunk < 1)
+        return rocblas_status_invalid_size;
+
+    rocsolver_handle_data* data = rocsolver_create_handle_data(handle);
+    data->memory_budget = budget;
+    data->min_chunk = min_chunk;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_memory_budget(rocblas_handle handle, size_t* budget,
+                                                      rocblas_int* min_chunk, rocblas_int* last_chunk)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!budget || !min_chunk || !last_chunk)
+        return rocblas_status_invalid_pointer;
+
+    const rocsolver_handle_data& data = rocsolver_handle_settings(handle);
+    *budget = data.memory_budget;
+    *min_chunk = data.min_chunk;
+    *last_chunk = data.last_chunk;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_lookahead(rocblas_handle handle, rocsolver_lookahead_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocsolver_lookahead_disabled && mode != rocsolver_lookahead_enabled)
+        return rocblas_status_invalid_value;
+
+    rocsolver_create_handle_data(handle)->lookahead = mode == rocsolver_lookahead_enabled;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_lookahead(rocblas_handle handle, rocsolver_lookahead_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver_handle_settings(handle).lookahead ? rocsolver_lookahead_enabled
+                                                        : rocsolver_lookahead_disabled;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_pivot_strategy(rocblas_handle handle, rocsolver_pivot_strategy strategy)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(strategy != rocsolver_pivot_partial && strategy != rocsolver_pivot_tournament)
+        return rocblas_status_invalid_value;
+
+    rocsolver_create_handle_data(handle)->tournament_pivoting = strategy == rocsolver_pivot_tournament;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_pivot_strategy(rocblas_handle handle, rocsolver_pivot_strategy* strategy)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!strategy)
+        return rocblas_status_invalid_pointer;
+
+    *strategy = rocsolver_handle_settings(handle).tournament_pivoting ? rocsolver_pivot_tournament
+                                                                       : rocsolver_pivot_partial;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_hybrid_getrf(rocblas_handle handle, rocblas_int host_threads)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(host_threads < 0)
+        return rocblas_status_invalid_size;
+
+    rocsolver_create_handle_data(handle)->hybrid_threads = host_threads;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_hybrid_getrf(rocblas_handle handle, rocblas_int* host_threads)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!host_threads)
+        return rocblas_status_invalid_pointer;
+
+    *host_threads = rocsolver_handle_settings(handle).hybrid_threads;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_refinement_iterations(rocblas_handle handle, rocblas_int max_iter)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(max_iter < 0)
+        return rocblas_status_invalid_size;
+
+    rocsolver_create_handle_data(handle)->refinement_iterations = max_iter;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_refinement_iterations(rocblas_handle handle, rocblas_int* max_iter)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!max_iter)
+        return rocblas_status_invalid_pointer;
+
+    *max_iter = rocsolver_handle_settings(handle).refinement_iterations;
+    return rocblas_status_success;
+}